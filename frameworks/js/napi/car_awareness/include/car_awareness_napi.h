@@ -20,6 +20,7 @@
 
 #include "car_awareness_mgr_napi.h"
 #include "car_awareness_type.h"
+#include "napi_event_dispatcher.h"
 
 #ifdef CAR_AWARENESS_ENABLE
 #include "car_awareness_callback_stub.h"
@@ -123,6 +124,8 @@ private:
     bool UnSubscribeToSa(napi_env env, int32_t type, const CarAwarenessOption &option);
     bool DoUnSubscription(napi_env env, int32_t type,
         const CarAwarenessOption &option, const sptr<CarAwarenessCallback> cb);
+
+    std::shared_ptr<DeviceStatus::NapiEventDispatcher> dispatcher_;
 #endif // CAR_AWARENESS_ENABLE
 };
 } // namespace Msdp
@@ -70,6 +70,9 @@ auto &g_carAwarenessMgr = DeviceStatus::CarAwarenessMgr::GetInstance();
 CarAwarenessNapi::CarAwarenessNapi(napi_env env, napi_value thisVar) : CarAwarenessMgrNapi(env, thisVar)
 {
     env_ = env;
+#ifdef CAR_AWARENESS_ENABLE
+    dispatcher_ = DeviceStatus::NapiEventDispatcher::GetInstance(env);
+#endif // CAR_AWARENESS_ENABLE
 }
 
 CarAwarenessNapi::~CarAwarenessNapi()
@@ -925,7 +928,9 @@ void CarAwarenessNapi::PostAwarenessEvent(const CarAwarenessEvent &event)
         }
         self->TriggerEvent(type, data);
     };
-    if (napi_send_event(env_, task, napi_eprio_immediate, "carAwareness.postEvent") != napi_ok) {
+    // Awareness events carry their own payload, so they are queued instead of coalesced.
+    if (dispatcher_ == nullptr ||
+        !dispatcher_->Post("carAwareness.postEvent", type, task, DeviceStatus::CoalescePolicy::BOUNDED_QUEUE)) {
         FI_HILOGE("Failed to postEvent");
     }
 }
@@ -24,6 +24,7 @@
 #include "devicestatus_callback_stub.h"
 #include "device_status_napi_event.h"
 #include "iremote_dev_sta_callback.h"
+#include "napi_event_dispatcher.h"
 #include "stationary_data.h"
 
 namespace OHOS {
@@ -31,12 +32,14 @@ namespace Msdp {
 namespace DeviceStatusV1 {
 class DeviceStatusCallback : public DeviceStatus::DeviceStatusCallbackStub {
 public:
-    explicit DeviceStatusCallback(napi_env env) : env_(env) {}
+    explicit DeviceStatusCallback(napi_env env)
+        : env_(env), dispatcher_(DeviceStatus::NapiEventDispatcher::GetInstance(env)) {}
     virtual ~DeviceStatusCallback() {}
     void OnDeviceStatusChanged(const DeviceStatus::Data &devicestatusData) override;
     static void EmitOnEvent(DeviceStatus::Data data);
 private:
     napi_env env_;
+    std::shared_ptr<DeviceStatus::NapiEventDispatcher> dispatcher_;
 };
 
 struct AsyncContext {
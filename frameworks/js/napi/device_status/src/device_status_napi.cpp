@@ -59,11 +59,12 @@ void DeviceStatusCallback::OnDeviceStatusChanged(const DeviceStatus::Data &event
     data.type = event.type;
     data.value = event.value;
 
+    CHKPV(dispatcher_);
     auto task = [data]() {
         FI_HILOGI("Execute lamdba");
         EmitOnEvent(data);
     };
-    if (napi_status::napi_ok != napi_send_event(env_, task, napi_eprio_immediate, "device.changed")) {
+    if (!dispatcher_->Post("device.changed", static_cast<int32_t>(data.type), task)) {
         FI_HILOGE("Failed to SendEvent");
     }
     FI_HILOGD("Exit");
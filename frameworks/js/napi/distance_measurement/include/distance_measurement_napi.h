@@ -21,6 +21,7 @@
 
 #include "distance_measurement_event_napi.h"
 #include "distance_measurement_callback.h"
+#include "napi_event_dispatcher.h"
 
 namespace OHOS {
 namespace Msdp {
@@ -45,13 +46,16 @@ typedef int32_t (*SubscribeDistanceMeasurementFunc)(
 typedef int32_t (*UnsubscribeDistanceMeasurementFunc)(const CDistMeasureData &cdistMeasureData);
 class DistMeasureListener : public IDistanceMeasurementListener {
 public:
-    explicit DistMeasureListener(napi_env env) : env_(env) {}
+    explicit DistMeasureListener(napi_env env)
+        : env_(env), dispatcher_(DeviceStatus::NapiEventDispatcher::GetInstance(env)) {}
     virtual ~DistMeasureListener() = default;
     void OnDistanceMeasurementChanged(const CDistMeasureResponse &distMeasureRes) const;
     void OnDoorIdentifyChanged(const CDoorPositionResponse &indentifyRes) const;
     void UpdateEnv(const napi_env &env);
 private:
     std::atomic<napi_env> env_;
+    // Swapped by UpdateEnv on the JS thread, read with atomic_load on the service thread.
+    std::shared_ptr<DeviceStatus::NapiEventDispatcher> dispatcher_;
 };
 
 class DistanceMeasurementNapi : public DistanceMeasurementEventNapi {
@@ -408,6 +408,7 @@ void DistanceMeasurementNapi::OnDistanceMeasurementChangedDone(const CDistMeasur
 void DistMeasureListener::UpdateEnv(const napi_env &env)
 {
     env_ = env;
+    std::atomic_store(&dispatcher_, DeviceStatus::NapiEventDispatcher::GetInstance(env));
 }
 
 void DistMeasureListener::OnDoorIdentifyChanged(const CDoorPositionResponse &identifyRes) const
@@ -439,7 +440,13 @@ void DistMeasureListener::OnDoorIdentifyChanged(const CDoorPositionResponse &ide
         } while (0);
         napi_close_handle_scope(env, scope);
     };
-    if (napi_status::napi_ok != napi_send_event(env_, task, napi_eprio_immediate, "distance.identifyChanged")) {
+    auto dispatcher = std::atomic_load(&dispatcher_);
+    if (dispatcher == nullptr) {
+        FI_HILOGE("dispatcher is nullptr");
+        return;
+    }
+    if (!dispatcher->Post(INPUT_TYPE_INDOOR_OR_OUTDOOR_IDENTIFY, 0, task,
+        DeviceStatus::CoalescePolicy::BOUNDED_QUEUE)) {
         FI_HILOGE("Failed to send event for auth");
         return;
     }
@@ -476,7 +483,13 @@ void DistMeasureListener::OnDistanceMeasurementChanged(const CDistMeasureRespons
         } while (0);
         napi_close_handle_scope(env, scope);
     };
-    if (napi_status::napi_ok != napi_send_event(env_, task, napi_eprio_immediate, "distance.measurementChanged")) {
+    auto dispatcher = std::atomic_load(&dispatcher_);
+    if (dispatcher == nullptr) {
+        FI_HILOGE("dispatcher is nullptr");
+        return;
+    }
+    // Only the latest distance of each peer device is worth delivering.
+    if (!dispatcher->Post(INPUT_TYPE_RANK_MEASUREMENT + ":" + staticDistMeasureRes.deviceId, 0, task)) {
         FI_HILOGE("Failed to send event for auth");
         return;
     }
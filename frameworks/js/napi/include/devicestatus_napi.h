@@ -24,6 +24,7 @@
 
 #include "devicestatus_callback_stub.h"
 #include "devicestatus_event.h"
+#include "napi_event_dispatcher.h"
 #include "stationary_data.h"
 
 namespace OHOS {
@@ -31,14 +32,13 @@ namespace Msdp {
 namespace DeviceStatus {
 class DeviceStatusCallback : public DeviceStatusCallbackStub {
 public:
-    explicit DeviceStatusCallback(napi_env env) : env_(env) {}
+    explicit DeviceStatusCallback(napi_env env) : env_(env), dispatcher_(NapiEventDispatcher::GetInstance(env)) {}
     virtual ~DeviceStatusCallback() {};
     void OnDeviceStatusChanged(const Data &devicestatusData) override;
     static void EmitOnEvent(Data* data);
 private:
     napi_env env_ { nullptr };
-    std::mutex mutex_;
-    Data data_;
+    std::shared_ptr<NapiEventDispatcher> dispatcher_;
 };
 
 class DeviceStatusNapi : public DeviceStatusEvent {
@@ -29,6 +29,7 @@
 #include "motion_callback_stub.h"
 #endif
 #include "motion_event_napi.h"
+#include "napi_event_dispatcher.h"
 
 namespace OHOS {
 namespace Msdp {
@@ -109,7 +110,9 @@ private:
     static napi_value UnSubscribeNamedMotion(napi_env env, napi_callback_info info, int32_t type);
     static void SetInt32Property(napi_env env, napi_value targetObj, int32_t value, const char *propName);
     static void SetPropertyName(napi_env env, napi_value targetObj, const char *propName, napi_value propValue);
-
+#ifdef MOTION_ENABLE
+    std::shared_ptr<DeviceStatus::NapiEventDispatcher> dispatcher_;
+#endif
 };
 } // namespace Msdp
 } // namespace OHOS
@@ -23,6 +23,7 @@
 #include "hover_hand_data.h"
 #include "napi/native_api.h"
 #include "napi/native_node_api.h"
+#include "napi_event_dispatcher.h"
 #include "user_status_data.h"
 #include "hover_hand_data.h"
 
@@ -43,7 +44,8 @@ struct JsHoverHandDetectionArea {
 
 class UserStatusDataCallback {
 public:
-    explicit UserStatusDataCallback(napi_env env) : env_(env)
+    explicit UserStatusDataCallback(napi_env env)
+        : env_(env), dispatcher_(DeviceStatus::NapiEventDispatcher::GetInstance(env))
     {
     }
     ~UserStatusDataCallback(){};
@@ -51,6 +53,7 @@ public:
 
 private:
     napi_env env_;
+    std::shared_ptr<DeviceStatus::NapiEventDispatcher> dispatcher_;
 };
 
 struct JsUserStatusEventCallback {
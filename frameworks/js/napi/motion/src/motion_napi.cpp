@@ -218,6 +218,9 @@ void MotionCallback::OnMotionChanged(const MotionEvent &event)
 MotionNapi::MotionNapi(napi_env env, napi_value thisVar) : MotionEventNapi(env, thisVar)
 {
     env_ = env;
+#ifdef MOTION_ENABLE
+    dispatcher_ = DeviceStatus::NapiEventDispatcher::GetInstance(env);
+#endif
 }
 
 MotionNapi::~MotionNapi()
@@ -441,7 +444,6 @@ void MotionNapi::PostMotionEvent(const MotionEvent &event)
 {
     // 从 binder/service线程投递回 env对应的JS线程再触发js回调。
     auto selfW = weak_from_this();
-    napi_env env = env_;
     int32_t type = event.type;
     int32_t status = event.status;
     int32_t logicalData = INVALID_LOGICAL_DATA;
@@ -462,7 +464,7 @@ void MotionNapi::PostMotionEvent(const MotionEvent &event)
         ev.data = nullptr;
         self->OnEventOperatingHand(type, 1, ev, logicalData);
     };
-    if (napi_send_event(env, task, napi_eprio_immediate, "motion.postEvent") != napi_ok) {
+    if (dispatcher_ == nullptr || !dispatcher_->Post("motion.postEvent", type, task)) {
         FI_HILOGE("Failed to SendEvent");
     }
 }
@@ -47,7 +47,7 @@ const std::string_view UNSUBSCRIBE_FUNC_NAME = { "UnsubscribeHoverHandEvent" };
 const std::map<const std::string, int32_t> FEATURE_ID_MAP = {
     { "hoverHandChanged", HOVER_HAND_FEATURE_ID },
 };
-std::mutex g_mutex; // mutex:Subscribe/Unsubscribe/OnListener
+std::mutex g_mutex; // mutex:Subscribe/Unsubscribe
 UserStatusEventNapi *g_userStatusEventObj = nullptr;
 
 bool JsHoverHandDetectionArea::Read(napi_env env, napi_value object, HoverHandDetectionArea &area)
@@ -101,12 +101,14 @@ bool JsHoverHandDetectionArea::Read(napi_env env, napi_value object, HoverHandDe
 
 void UserStatusDataCallback::OnReceiveData(int32_t callbackId, std::shared_ptr<UserStatusData> userStatusData)
 {
+    CHKPV(dispatcher_);
+    // Runs on the JS thread that owns g_userStatusEventObj; OnReceiveData() takes the object's own lock.
     auto task = [callbackId, userStatusData]() {
-        std::lock_guard<std::mutex> guard(g_mutex);
         CHKPV(g_userStatusEventObj);
         g_userStatusEventObj->OnReceiveData(callbackId, userStatusData);
     };
-    if (napi_send_event(env_, task, napi_eprio_immediate, "userStatus.listener") != napi_status::napi_ok) {
+    // Hover hand actions are transitions, so every one of them is kept rather than the latest.
+    if (!dispatcher_->Post("userStatus.listener", callbackId, task, DeviceStatus::CoalescePolicy::BOUNDED_QUEUE)) {
         FI_HILOGE("Failed to SendEvent");
     }
 }
@@ -35,7 +35,8 @@ namespace OnScreen {
 #ifndef DEVICE_STATUS_PHONE_STANDARD_LITE
 class OnScreenAwarenessCallback : public OnScreenCallbackStub {
 public:
-    explicit OnScreenAwarenessCallback(napi_env env) : env_(env) {}
+    explicit OnScreenAwarenessCallback(napi_env env)
+        : env_(env), dispatcher_(NapiEventDispatcher::GetInstance(env)) {}
     ~OnScreenAwarenessCallback();
     void OnScreenAwareness(const OnscreenAwarenessInfo& info) override;
 
@@ -43,6 +44,7 @@ public:
     sptr<IRemoteOnScreenCallback> callback;
     std::set<napi_ref> onRef;
     napi_env env_ { nullptr };
+    std::shared_ptr<NapiEventDispatcher> dispatcher_;
 };
 #endif
 
@@ -22,6 +22,7 @@
 #include "napi/native_api.h"
 #include "napi/native_node_api.h"
 
+#include "napi_event_dispatcher.h"
 #include "on_screen_callback_stub.h"
 #include "on_screen_data.h"
 #include "on_screen_manager.h"
@@ -34,7 +35,8 @@ namespace DeviceStatus {
 namespace OnScreen {
 class OnScreenCallback : public OnScreenCallbackStub {
 public:
-    explicit OnScreenCallback(napi_env env) : env_(env) {}
+    explicit OnScreenCallback(napi_env env)
+        : env_(env), dispatcher_(NapiEventDispatcher::GetInstance(env)) {}
     ~OnScreenCallback();
     void OnScreenChange(const std::string& changeInfo) override;
 
@@ -54,6 +56,7 @@ public:
     std::string event;
     sptr<IRemoteOnScreenCallback> callback;
     napi_env env_ { nullptr };
+    std::shared_ptr<NapiEventDispatcher> dispatcher_;
 
 private:
     std::atomic<bool> disabled_ { false };
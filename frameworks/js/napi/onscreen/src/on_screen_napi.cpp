@@ -751,7 +751,8 @@ void OnScreenAwarenessCallback::OnScreenAwareness(const OnscreenAwarenessInfo& i
             napi_call_function(self->env_, nullptr, handler, 1, &result, &callResult);
         }
     };
-    if (napi_send_event(self->env_, task, napi_eprio_immediate, "onScreen.awareness") != napi_ok) {
+    if (self->dispatcher_ == nullptr ||
+        !self->dispatcher_->Post("onScreen.awareness", 0, task, CoalescePolicy::BOUNDED_QUEUE)) {
         FI_HILOGE("Failed to SendEvent");
     }
 }
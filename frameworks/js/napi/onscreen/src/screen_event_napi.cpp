@@ -207,7 +207,9 @@ void OnScreenCallback::OnScreenChange(const std::string& changeInfo)
             napi_call_function(self->env_, nullptr, handler, 1, &result, &callResult);
         }
     };
-    if (napi_send_event(self->env_, task, napi_eprio_immediate, "screen.changed") != napi_ok) {
+    // A newer change of the same window and event supersedes one the JS thread has not seen yet.
+    if (self->dispatcher_ == nullptr ||
+        !self->dispatcher_->Post("screen.changed:" + self->event, self->windowId, task)) {
         FI_HILOGE("Failed to SendEvent");
     }
 }
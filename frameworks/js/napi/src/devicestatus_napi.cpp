@@ -51,16 +51,14 @@ napi_ref DeviceStatusNapi::devicestatusValueRef_ = nullptr;
 void DeviceStatusCallback::OnDeviceStatusChanged(const Data& devicestatusData)
 {
     CALL_DEBUG_ENTER;
-    std::lock_guard<std::mutex> guard(mutex_);
     FI_HILOGD("devicestatusData.type:%{public}d, devicestatusData.value:%{public}d",
         devicestatusData.type, devicestatusData.value);
-    data_ = devicestatusData;
-
-    auto task = [this]() {
+    CHKPV(dispatcher_);
+    auto task = [data = devicestatusData]() mutable {
         FI_HILOGI("Execute lamdba");
-        EmitOnEvent(&this->data_);
+        EmitOnEvent(&data);
     };
-    if (napi_status::napi_ok != napi_send_event(env_, task, napi_eprio_immediate, "device_status.changed")) {
+    if (!dispatcher_->Post("device_status.changed", static_cast<int32_t>(devicestatusData.type), task)) {
         FI_HILOGE("Failed to SendEvent");
     }
 }
@@ -22,6 +22,7 @@
 
 #include "device_info.h"
 #include "iunderage_model_listener.h"
+#include "napi_event_dispatcher.h"
 #include "user_status_data.h"
 #include "user_status_napi_util.h"
 
@@ -44,22 +45,24 @@ typedef int32_t (*QueryCapabilitiesFunc)(std::vector<std::int32_t>& capabilities
 
 class UnderageModelListener : public UserStatusAwareness::IUnderageModelListener {
 public:
-    explicit UnderageModelListener(napi_env env) : env_(env) {}
+    explicit UnderageModelListener(napi_env env) : env_(env), dispatcher_(NapiEventDispatcher::GetInstance(env)) {}
     ~UnderageModelListener() {};
     void OnUnderageModelListener(uint32_t eventType, int32_t result, float confidence) const override;
 
 private:
     napi_env env_;
+    std::shared_ptr<NapiEventDispatcher> dispatcher_;
 };
 
 class UserStatusDataCallback {
 public:
-    explicit UserStatusDataCallback(napi_env env) : env_(env) {}
+    explicit UserStatusDataCallback(napi_env env) : env_(env), dispatcher_(NapiEventDispatcher::GetInstance(env)) {}
     ~UserStatusDataCallback() {};
     void OnReceiveData(int32_t callbackId, std::shared_ptr<UserStatusData> userStatusData);
 
 private:
     napi_env env_;
+    std::shared_ptr<NapiEventDispatcher> dispatcher_;
 };
 
 class UnderageModelNapi : public UnderageModelNapiEvent {
@@ -47,7 +47,7 @@ constexpr int32_t NOT_SYSTEM_ERR = 0x3A10006;
 constexpr int32_t ARG_1 = 1;
 constexpr int32_t ARG_2 = 2;
 constexpr int32_t ARG_3 = 3;
-std::mutex g_mutex; // mutex:Subscribe/Unsubscribe/OnListener
+std::mutex g_mutex; // mutex:Subscribe/Unsubscribe
 const std::array<napi_valuetype, 2> EXPECTED_SUB_ARG_TYPES = { napi_string, napi_function };
 const std::array<napi_valuetype, 1> EXPECTED_UNSUB_ONE_ARG_TYPES = { napi_string };
 const std::array<napi_valuetype, 2> EXPECTED_UNSUB_TWO_ARG_TYPES = { napi_string, napi_function };
@@ -79,12 +79,13 @@ bool UnderageModelNapi::LoadLibrary()
 void UnderageModelListener::OnUnderageModelListener(uint32_t eventType, int32_t result, float confidence) const
 {
     FI_HILOGD("Enter");
+    CHKPV(dispatcher_);
+    // Runs on the JS thread that owns g_underageModelObj; OnEventChanged() takes the object's own lock.
     auto task = [eventType, result, confidence]() {
-        std::lock_guard<std::mutex> guard(g_mutex);
         CHKPV(g_underageModelObj);
         g_underageModelObj->OnEventChanged(eventType, result, confidence);
     };
-    if (napi_send_event(env_, task, napi_eprio_immediate, "underage.listener") != napi_status::napi_ok) {
+    if (!dispatcher_->Post("underage.listener", static_cast<int32_t>(eventType), task)) {
         FI_HILOGE("Failed to SendEvent");
     }
     FI_HILOGD("Exit");
@@ -93,12 +94,12 @@ void UnderageModelListener::OnUnderageModelListener(uint32_t eventType, int32_t
 void UserStatusDataCallback::OnReceiveData(int32_t callbackId, std::shared_ptr<UserStatusData> userStatusData)
 {
     FI_HILOGI("Enter");
+    CHKPV(dispatcher_);
     auto task = [callbackId, userStatusData]() {
-        std::lock_guard<std::mutex> guard(g_mutex);
         CHKPV(g_underageModelObj);
         g_underageModelObj->OnReceiveData(callbackId, userStatusData);
     };
-    if (napi_send_event(env_, task, napi_eprio_immediate, "userStatus.listener") != napi_status::napi_ok) {
+    if (!dispatcher_->Post("underage.userStatus", callbackId, task)) {
         FI_HILOGE("Failed to SendEvent");
     }
     FI_HILOGD("Exit");
@@ -36,7 +36,7 @@ void DeviceStatusCallbackProxy::OnDeviceStatusChanged(const Data& devicestatusDa
     CHKPV(remote);
     MessageParcel data;
     MessageParcel reply;
-    MessageOption option;
+    MessageOption option(MessageOption::TF_ASYNC);
 
     if (!data.WriteInterfaceToken(DeviceStatusCallbackProxy::GetDescriptor())) {
         FI_HILOGE("Write descriptor failed");
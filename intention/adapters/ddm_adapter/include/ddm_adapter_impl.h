@@ -23,6 +23,7 @@
 #include "nocopyable.h"
 
 #include "i_ddm_adapter.h"
+#include "trusted_device_snapshot.h"
 
 namespace OHOS {
 namespace Msdp {
@@ -86,7 +87,11 @@ private:
         ~DmInitCb() = default;
         DISALLOW_COPY_AND_MOVE(DmInitCb);
 
-        void OnRemoteDied() override {}
+        void OnRemoteDied() override
+        {
+            // State callbacks stop with device manager, so the snapshot can no longer be kept fresh.
+            TrustedDeviceSnapshot::GetInstance().StopTracking();
+        }
     };
 
     class DmBoardStateCb final : public DistributedHardware::DeviceStateCallback {
@@ -111,7 +116,10 @@ private:
             }
         }
 
-        void OnDeviceChanged(const DistributedHardware::DmDeviceInfo &deviceInfo) override {}
+        void OnDeviceChanged(const DistributedHardware::DmDeviceInfo &deviceInfo) override
+        {
+            TrustedDeviceSnapshot::GetInstance().OnDeviceOnline(deviceInfo.networkId);
+        }
         void OnDeviceReady(const DistributedHardware::DmDeviceInfo &deviceInfo) override {}
 
     private:
@@ -22,6 +22,7 @@
 #include "ipc_skeleton.h"
 #include "ohos_account_kits.h"
 #include "os_account_manager.h"
+#include "trusted_device_snapshot.h"
 #include "utility.h"
 
 #undef LOG_TAG
@@ -58,6 +59,7 @@ int32_t DDMAdapterImpl::Enable()
         FI_HILOGE("DM::RegisterDevStateCallback fail, ret: %{public}d", ret);
         goto REG_FAIL;
     }
+    TrustedDeviceSnapshot::GetInstance().StartTracking();
     return RET_OK;
 
 REG_FAIL:
@@ -79,6 +81,7 @@ void DDMAdapterImpl::Disable()
     std::string pkgName(FI_PKG_NAME);
 
     if (boardStateCb_ != nullptr) {
+        TrustedDeviceSnapshot::GetInstance().StopTracking();
         boardStateCb_.reset();
         int32_t ret = D_DEV_MGR.UnRegisterDevStateCallback(pkgName);
         if (ret != 0) {
@@ -311,6 +314,7 @@ void DDMAdapterImpl::OnBoardOnline(const std::string &networkId)
     CALL_DEBUG_ENTER;
     std::lock_guard guard(lock_);
     FI_HILOGI("Board \'%{public}s\' is online", Utility::Anonymize(networkId).c_str());
+    TrustedDeviceSnapshot::GetInstance().OnDeviceOnline(networkId);
     std::for_each(observers_.cbegin(), observers_.cend(),
         [&networkId](const auto &item) {
             if (auto observer = item.Lock(); observer != nullptr) {
@@ -324,6 +328,7 @@ void DDMAdapterImpl::OnBoardOffline(const std::string &networkId)
     CALL_DEBUG_ENTER;
     std::lock_guard guard(lock_);
     FI_HILOGI("Board \'%{public}s\' is offline", Utility::Anonymize(networkId).c_str());
+    TrustedDeviceSnapshot::GetInstance().OnDeviceOffline(networkId);
     std::for_each(observers_.cbegin(), observers_.cend(),
         [&networkId](const auto &item) {
             if (auto observer = item.Lock(); observer != nullptr) {
@@ -19,6 +19,8 @@
 #include <chrono>
 #endif // ENABLE_PERFORMANCE_CHECK
 
+#include <algorithm>
+
 #include <netinet/in.h>
 #include <netinet/tcp.h>
 #include "device_manager.h"
@@ -29,6 +31,7 @@
 
 #include "devicestatus_define.h"
 #include "i_ddm_adapter.h"
+#include "trusted_device_snapshot.h"
 #include "utility.h"
 #include "inner_socket.h"
 
@@ -126,19 +129,29 @@ void DSoftbusAdapterImpl::RemoveObserver(std::shared_ptr<IDSoftbusObserver> obse
 int32_t DSoftbusAdapterImpl::CheckDeviceOnline(const std::string &networkId)
 {
     CALL_DEBUG_ENTER;
+    bool trusted = false;
+    // Only a hit is trusted; a miss is confirmed against device manager in case a state callback was lost.
+    if (TrustedDeviceSnapshot::GetInstance().Lookup(networkId, trusted) && trusted) {
+        return RET_OK;
+    }
+    uint64_t generation = TrustedDeviceSnapshot::GetInstance().GetGeneration();
     std::vector<DistributedHardware::DmDeviceInfo> deviceList;
     if (D_DEV_MGR.GetTrustedDeviceList(FI_PKG_NAME, "", deviceList) != RET_OK) {
         FI_HILOGE("GetTrustedDeviceList failed");
         return RET_ERR;
     }
-    if (deviceList.empty()) {
+    std::vector<std::string> networkIds;
+    networkIds.reserve(deviceList.size());
+    for (const auto &deviceInfo : deviceList) {
+        networkIds.emplace_back(deviceInfo.networkId);
+    }
+    TrustedDeviceSnapshot::GetInstance().Sync(generation, networkIds);
+    if (networkIds.empty()) {
         FI_HILOGE("Trust device list size is invalid");
         return RET_ERR;
     }
-    for (const auto &deviceInfo : deviceList) {
-        if (std::string(deviceInfo.networkId) == networkId) {
-            return RET_OK;
-        }
+    if (std::find(networkIds.cbegin(), networkIds.cend(), networkId) != networkIds.cend()) {
+        return RET_OK;
     }
     return RET_ERR;
 }
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef COOPERATE_ASYNC_STEP_H
+#define COOPERATE_ASYNC_STEP_H
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "nocopyable.h"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace Cooperate {
+// Runs handshake steps, one at a time, on a thread owned by the state that issues them.
+// Stop() drops the steps not yet started and joins the thread, so a step may refer to
+// anything that outlives the owner of the executor.
+class StepExecutor final {
+public:
+    StepExecutor() = default;
+    ~StepExecutor();
+    DISALLOW_COPY_AND_MOVE(StepExecutor);
+
+    void Post(std::function<void()> task);
+    void Stop();
+
+private:
+    void Run();
+
+    std::mutex mutex_;
+    std::condition_variable cond_;
+    std::deque<std::function<void()>> tasks_;
+    std::thread thread_;
+    bool stopped_ { false };
+};
+
+// One step of a handshake run on a StepExecutor, while the caller goes on with other steps.
+// The caller waits for the result with a deadline. A step that misses it, or is no longer waited
+// for, is abandoned: its late result is handed to @onAbandoned, which is to undo what @work did.
+template<typename T>
+class AsyncStep final {
+public:
+    AsyncStep(StepExecutor &executor, std::function<T()> work, std::function<void(T)> onAbandoned = nullptr);
+    ~AsyncStep();
+    DISALLOW_COPY_AND_MOVE(AsyncStep);
+
+    // Returns false if the step did not finish within @deadline.
+    bool Wait(std::chrono::milliseconds deadline, T &result);
+    // Time from launch to completion, or -1 if the step has not finished.
+    int64_t GetElapsed() const;
+
+private:
+    struct State {
+        std::mutex mutex;
+        std::condition_variable cond;
+        bool done { false };
+        bool abandoned { false };
+        T result {};
+        int64_t elapsed { -1 };
+    };
+    void Abandon();
+
+    std::shared_ptr<State> state_ { std::make_shared<State>() };
+};
+
+template<typename T>
+AsyncStep<T>::AsyncStep(StepExecutor &executor, std::function<T()> work, std::function<void(T)> onAbandoned)
+{
+    executor.Post([state = state_, work = std::move(work), onAbandoned = std::move(onAbandoned),
+        begin = std::chrono::steady_clock::now()] {
+        T result = work();
+        {
+            std::lock_guard guard(state->mutex);
+            state->elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - begin).count();
+            if (!state->abandoned) {
+                state->result = std::move(result);
+                state->done = true;
+                state->cond.notify_all();
+                return;
+            }
+        }
+        if (onAbandoned != nullptr) {
+            onAbandoned(std::move(result));
+        }
+    });
+}
+
+template<typename T>
+AsyncStep<T>::~AsyncStep()
+{
+    Abandon();
+}
+
+template<typename T>
+bool AsyncStep<T>::Wait(std::chrono::milliseconds deadline, T &result)
+{
+    std::unique_lock lock(state_->mutex);
+    if (!state_->cond.wait_for(lock, deadline, [this] { return state_->done; })) {
+        state_->abandoned = true;
+        return false;
+    }
+    result = state_->result;
+    return true;
+}
+
+template<typename T>
+int64_t AsyncStep<T>::GetElapsed() const
+{
+    std::lock_guard guard(state_->mutex);
+    return state_->elapsed;
+}
+
+template<typename T>
+void AsyncStep<T>::Abandon()
+{
+    std::lock_guard guard(state_->mutex);
+    if (!state_->done) {
+        state_->abandoned = true;
+    }
+}
+} // namespace Cooperate
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+#endif // COOPERATE_ASYNC_STEP_H
@@ -172,6 +172,7 @@ public:
 
     void OnDeviceAdded(std::shared_ptr<IDevice> dev) override;
     void OnDeviceRemoved(std::shared_ptr<IDevice> dev) override;
+    void OnDevicesChanged(const DeviceChanges &changes) override;
 
 private:
     Channel<CooperateEvent>::Sender sender_;
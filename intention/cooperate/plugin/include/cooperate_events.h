@@ -19,6 +19,7 @@
 #include <future>
 #include <string>
 #include <variant>
+#include <vector>
 #include <set>
 
 #include "coordination_message.h"
@@ -61,6 +62,7 @@ enum class CooperateEventType {
     DDM_BOARD_OFFLINE,
     DDP_COOPERATE_SWITCH_CHANGED,
     INPUT_HOTPLUG_EVENT,
+    INPUT_HOTPLUG_BATCH_EVENT,
     INPUT_POINTER_EVENT,
     DSOFTBUS_SESSION_OPENED,
     DSOFTBUS_SESSION_CLOSED,
@@ -176,6 +178,11 @@ struct InputHotplugEvent {
     bool isKeyboard { false };
 };
 
+// One settled batch of local hot-plug changes, removals first.
+struct InputHotplugBatchEvent {
+    std::vector<InputHotplugEvent> changes;
+};
+
 struct InputPointerEvent {
     int32_t deviceId;
     int32_t pointerAction;
@@ -259,9 +266,25 @@ struct DSoftbusSyncMouseLocation {
     LocationInfo mouseLocation;
 };
 
+enum class InputDevSyncType : int32_t {
+    // Whole device list, sent by peers without inventory digests.
+    FULL,
+    // Digest of the inventory of the peer.
+    DIGEST,
+    // The peer asks for what it is missing, given the id and hash of devices it holds.
+    PULL,
+    // Added or changed devices and ids of removed ones.
+    DELTA,
+};
+
 struct DSoftbusSyncInputDevice {
     std::string networkId;
     std::vector<std::shared_ptr<IDevice>> devices;
+    InputDevSyncType type { InputDevSyncType::FULL };
+    uint64_t baseDigest { 0 };
+    uint64_t digest { 0 };
+    std::vector<std::pair<int32_t, uint64_t>> entries;
+    std::vector<int32_t> removedIds;
 };
 
 struct DSoftbusHotPlugEvent {
@@ -334,6 +357,7 @@ struct CooperateEvent {
         DumpEvent,
         DDMBoardOnlineEvent,
         InputHotplugEvent,
+        InputHotplugBatchEvent,
         InputPointerEvent,
         DSoftbusStartCooperate,
         DSoftbusRelayCooperate,
@@ -18,6 +18,7 @@
 
 #include "nocopyable.h"
 
+#include "async_step.h"
 #include "i_cooperate_state.h"
 
 namespace OHOS {
@@ -73,6 +74,7 @@ private:
 
     IContext *env_ { nullptr };
     std::shared_ptr<Initial> initial_ { nullptr };
+    StepExecutor executor_;
 };
 } // namespace Cooperate
 } // namespace DeviceStatus
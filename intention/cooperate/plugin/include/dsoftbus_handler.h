@@ -16,6 +16,8 @@
 #ifndef DSOFTBUS_HANDLER_H
 #define DSOFTBUS_HANDLER_H
 
+#include <chrono>
+
 #include "nocopyable.h"
 
 #include "channel.h"
@@ -72,6 +74,7 @@ public:
     void CloseAllSessions();
 
     int32_t StartCooperate(const std::string &networkId, const DSoftbusStartCooperate &event);
+    int32_t StartCooperateResponse(const std::string &networkId);
     int32_t StartCooperateWithOptions(const std::string &networkId, const DSoftbusCooperateOptions &event);
     int32_t StopCooperate(const std::string &networkId, const DSoftbusStopCooperate &event);
     int32_t ComeBack(const std::string &networkId, const DSoftbusComeBack &event);
@@ -92,6 +95,7 @@ private:
     void SendEvent(const CooperateEvent &event);
     void OnCommunicationFailure(const std::string &networkId);
     void OnStartCooperate(const std::string &networkId, NetPacket &packet);
+    void OnStartCooperateResponse(const std::string &networkId, NetPacket &packet);
     void OnStopCooperate(const std::string &networkId, NetPacket &packet);
     void OnStartCooperateWithOptions(const std::string &networkId, NetPacket &packet);
     void OnComeBack(const std::string &networkId, NetPacket &packet);
@@ -104,6 +108,9 @@ private:
     void OnReplyUnSubscribeLocation(const std::string& networKId, NetPacket &packet);
     void OnRemoteMouseLocation(const std::string& networKId, NetPacket &packet);
     void OnRemoteInputDevice(const std::string& networKId, NetPacket &packet);
+    void OnRemoteInputDeviceDigest(const std::string &networkId, NetPacket &packet);
+    void OnRemoteInputDevicePull(const std::string &networkId, NetPacket &packet);
+    void OnRemoteInputDeviceDelta(const std::string &networkId, NetPacket &packet);
     void OnRemoteHotPlug(const std::string& networKId, NetPacket &packet);
     int32_t DeserializeDevice(std::shared_ptr<IDevice> device, NetPacket &packet);
     void OnRelayCooperateWithOptions(const std::string &networkId, NetPacket &packet);
@@ -115,6 +122,7 @@ private:
     Channel<CooperateEvent>::Sender sender_;
     std::shared_ptr<DSoftbusObserver> observer_;
     std::map<int32_t, std::function<void(const std::string &networkId, NetPacket &packet)>> handles_;
+    std::map<std::string, std::chrono::steady_clock::time_point> startTimes_;
 };
 } // namespace Cooperate
 } // namespace DeviceStatus
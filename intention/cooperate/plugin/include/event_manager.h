@@ -16,7 +16,7 @@
 #ifndef COOPERATE_EVENT_MANAGER_H
 #define COOPERATE_EVENT_MANAGER_H
 
-#include <list>
+#include <map>
 #include <mutex>
 
 #include "nocopyable.h"
@@ -47,6 +47,15 @@ public:
         std::string networkId;
         CoordinationMessage msg { CoordinationMessage::PREPARE };
         bool state { false };
+        std::weak_ptr<ISocketSession> session;
+        size_t nBackpressured { 0 };
+    };
+
+    struct EncodedNotice {
+        explicit EncodedNotice(MessageId msgId) : pkt(msgId) {}
+
+        NetPacket pkt;
+        StreamBuffer buf;
     };
 
     struct CooperateNotice {
@@ -98,10 +107,13 @@ private:
     void OnCooperateMessage(CoordinationMessage msg, const std::string &networkId);
     void NotifyCooperateMessage(const CooperateNotice &notice);
     void NotifyCooperateState(const CooperateStateNotice &notice);
+    bool EncodeCooperateMessage(const CooperateNotice &notice, NetPacket &pkt, StreamBuffer &buf);
+    SocketSessionPtr FindSession(int32_t pid);
+    void MulticastToListener(EventInfo &listener, NetPacket &pkt, const StreamBuffer &buf);
 
 private:
     IContext *env_ { nullptr };
-    std::list<std::shared_ptr<EventInfo>> listeners_;
+    std::map<int32_t, std::shared_ptr<EventInfo>> listeners_;
     std::map<EventType, std::shared_ptr<EventInfo>> calls_ {
         { EventType::ENABLE, nullptr },
         { EventType::START, nullptr },
@@ -16,8 +16,12 @@
 #ifndef COOPERATE_HOTAREA_H
 #define COOPERATE_HOTAREA_H
 
+#include <atomic>
+#include <map>
 #include <set>
+#include <vector>
 
+#include "display_manager.h"
 #include "nocopyable.h"
 #include "pointer_event.h"
 
@@ -44,34 +48,81 @@ public:
         }
     };
 
+    struct HotRegion {
+        HotAreaType type { HotAreaType::AREA_NONE };
+        int32_t left { 0 };
+        int32_t top { 0 };
+        int32_t right { 0 };
+        int32_t bottom { 0 };
+
+        bool Contains(int32_t x, int32_t y) const
+        {
+            return ((x >= left) && (x <= right) && (y >= top) && (y <= bottom));
+        }
+    };
+
+    struct DisplayHotRegions {
+        int32_t width { 0 };
+        int32_t height { 0 };
+        std::vector<HotRegion> regions;
+    };
+
+    // Immutable snapshot of the hot regions of all displays, swapped as a whole on display changes.
+    struct HotAreaLayout {
+        uint64_t defaultDisplayId { 0 };
+        std::map<uint64_t, DisplayHotRegions> displays;
+    };
+
     HotArea(IContext *env) : env_(env) {}
-    ~HotArea() = default;
+    ~HotArea();
     DISALLOW_COPY_AND_MOVE(HotArea);
 
     void AddListener(const RegisterHotareaListenerEvent &event);
     void RemoveListener(const UnregisterHotareaListenerEvent &event);
 
     void EnableCooperate(const EnableCooperateEvent &event);
+    void DisableCooperate(const DisableCooperateEvent &event);
     int32_t ProcessData(std::shared_ptr<MMI::PointerEvent> pointerEvent);
     void OnClientDied(const ClientDiedEvent &event);
 
+    static DisplayHotRegions BuildHotRegions(int32_t width, int32_t height);
+
 private:
-    void CheckInHotArea();
-    void CheckPointerToEdge(HotAreaType type);
+    class DisplayListener final : public Rosen::DisplayManager::IDisplayListener {
+    public:
+        explicit DisplayListener(HotArea &hotArea) : hotArea_(hotArea) {}
+        void OnCreate(Rosen::DisplayId displayId) override;
+        void OnDestroy(Rosen::DisplayId displayId) override;
+        void OnChange(Rosen::DisplayId displayId) override;
+
+    private:
+        HotArea &hotArea_;
+    };
+
+    void UpdateLayout();
+    const DisplayHotRegions* FindDisplay(const HotAreaLayout &layout, int32_t displayId) const;
+    void CheckInHotArea(const DisplayHotRegions &display);
+    void CheckPointerToEdge(const DisplayHotRegions &display, HotAreaType type);
+    bool IsTransition();
     void NotifyMessage();
     void OnHotAreaMessage(HotAreaType msg, bool isEdge);
     void NotifyHotAreaMessage(int32_t pid, MessageId msgId, HotAreaType msg, bool isEdge);
 
 private:
     IContext *env_ { nullptr };
-    int32_t width_ { 720 };
-    int32_t height_ { 1280 };
     int32_t displayX_ { 0 };
     int32_t displayY_ { 0 };
     int32_t deltaX_ { 0 };
     int32_t deltaY_ { 0 };
     bool isEdge_ { false };
     HotAreaType type_ { HotAreaType::AREA_NONE };
+    bool lastIsEdge_ { false };
+    HotAreaType lastType_ { HotAreaType::AREA_NONE };
+    // Set when a listener is added, so that it learns the current region on the next pointer event.
+    std::atomic_bool forceNotify_ { false };
+    // Read with std::atomic_load on the pointer event path, replaced with std::atomic_store.
+    std::shared_ptr<const HotAreaLayout> layout_;
+    sptr<DisplayListener> displayListener_;
     std::mutex lock_;
     std::set<HotAreaInfo> callbacks_;
 };
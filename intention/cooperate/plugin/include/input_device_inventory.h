@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef COOPERATE_INPUT_DEVICE_INVENTORY_H
+#define COOPERATE_INPUT_DEVICE_INVENTORY_H
+
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "i_device.h"
+#include "net_packet.h"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace Cooperate {
+using InputDeviceEntries = std::vector<std::pair<int32_t, uint64_t>>;
+
+struct InputDeviceDelta {
+    uint64_t baseDigest { 0 };
+    uint64_t digest { 0 };
+    std::vector<std::shared_ptr<IDevice>> devices;
+    std::vector<int32_t> removedIds;
+};
+
+// Input devices of one side of a cooperation, identified by device id and hashed by content.
+// The digest of the whole inventory lets peers tell in one round whether their copies agree,
+// and only added, changed and removed devices are transferred when they do not.
+class InputDeviceInventory final {
+public:
+    InputDeviceInventory();
+    ~InputDeviceInventory() = default;
+
+    void Reset(const std::vector<std::shared_ptr<IDevice>> &devices);
+    void Clear();
+    uint64_t GetDigest() const;
+    size_t GetSize() const;
+    InputDeviceEntries GetEntries() const;
+    std::vector<std::shared_ptr<IDevice>> GetDevices() const;
+    // Devices a peer holding @known is missing to reach this inventory, split into deltas that
+    // each fit in one packet. Every delta applies on top of the digest the previous one left.
+    std::vector<InputDeviceDelta> Diff(const InputDeviceEntries &known, uint64_t baseDigest) const;
+    // Ids of replaced and removed devices are appended to @touchedIds.
+    int32_t Apply(const InputDeviceDelta &delta, std::vector<int32_t> &touchedIds);
+
+    static uint64_t HashDevice(std::shared_ptr<IDevice> device);
+    static int32_t SerializeDevice(std::shared_ptr<IDevice> device, NetPacket &packet);
+    static int32_t DeserializeDevice(std::shared_ptr<IDevice> device, NetPacket &packet);
+    static int32_t WriteEntries(uint64_t digest, const InputDeviceEntries &entries, NetPacket &packet);
+    static int32_t ReadEntries(NetPacket &packet, uint64_t &digest, InputDeviceEntries &entries);
+    static int32_t WriteDelta(const InputDeviceDelta &delta, NetPacket &packet);
+    static int32_t ReadDelta(NetPacket &packet, InputDeviceDelta &delta);
+
+private:
+    struct Entry {
+        uint64_t hash { 0 };
+        std::shared_ptr<IDevice> device;
+    };
+    void UpdateDigest();
+
+    std::map<int32_t, Entry> entries_;
+    uint64_t digest_ { 0 };
+};
+} // namespace Cooperate
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+#endif // COOPERATE_INPUT_DEVICE_INVENTORY_H
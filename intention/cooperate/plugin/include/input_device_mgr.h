@@ -20,12 +20,14 @@
 #include <mutex>
 #include <set>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "nocopyable.h"
 
 #include "channel.h"
 #include "cooperate_events.h"
 #include "i_context.h"
+#include "input_device_inventory.h"
 #include "net_packet.h"
 
 namespace OHOS {
@@ -44,6 +46,7 @@ public:
     void OnSoftbusSessionOpened(const DSoftbusSessionOpened &notice);
     void OnSoftbusSessionClosed(const DSoftbusSessionClosed &notice);
     void OnLocalHotPlug(const InputHotplugEvent &notice);
+    void OnLocalHotPlug(const InputHotplugBatchEvent &batch);
     void AddVirtualInputDevice(const std::string &networkId);
     void RemoveVirtualInputDevice(const std::string &networkId);
     void HandleRemoteHotPlug(const DSoftbusHotPlugEvent &notice);
@@ -53,7 +56,18 @@ public:
 
 private:
     void NotifyInputDeviceToRemote(const std::string &remoteNetworkId);
-    void BroadcastHotPlugToRemote(const InputHotplugEvent &notice);
+    void NotifyFullInputDeviceToRemote(const std::string &remoteNetworkId);
+    void MarkDigestPeer(const std::string &networkId);
+    std::vector<std::shared_ptr<IDevice>> GetLocalInputDevices();
+    void OnRemoteInputDeviceFull(const DSoftbusSyncInputDevice &notice);
+    void OnRemoteInputDeviceDigest(const DSoftbusSyncInputDevice &notice);
+    void OnRemoteInputDevicePull(const DSoftbusSyncInputDevice &notice);
+    void OnRemoteInputDeviceDelta(const DSoftbusSyncInputDevice &notice);
+    void PullRemoteInputDevice(const std::string &networkId);
+    InputDeviceInventory& GetRemoteInventory(const std::string &networkId);
+    void RefreshRemoteInputDevice(const std::string &networkId, const std::vector<int32_t> &touchedIds);
+    void BroadcastHotPlugToRemote(const std::vector<InputHotplugEvent> &changes);
+    void SendHotPlugToLegacyRemote(const std::string &networkId, const InputHotplugEvent &notice);
     void AddRemoteInputDevice(const std::string &networkId, std::shared_ptr<IDevice> device);
     void RemoveRemoteInputDevice(const std::string &networkId, std::shared_ptr<IDevice> device);
     void RemoveAllRemoteInputDevice(const std::string &networkId);
@@ -79,6 +93,15 @@ private:
     std::unordered_map<std::string, std::set<std::shared_ptr<IDevice>, IDeviceCmp>> remoteDevices_;
     std::unordered_map<std::string, std::set<int32_t>> virtualInputDevicesAdded_;
     std::unordered_map<int32_t, int32_t> remote2VirtualIds_;
+    // What was last advertised to peers, and what peers advertised, kept across sessions.
+    InputDeviceInventory localInventory_;
+    std::unordered_map<std::string, InputDeviceInventory> remoteInventories_;
+    std::unordered_set<std::string> pendingPulls_;
+    // Peers known to take digests and deltas, kept across sessions. Others get the full list and
+    // hot plug records of old.
+    std::unordered_set<std::string> digestPeers_;
+    // Peers with an open session, and whether each sent a digest, pull or delta within it.
+    std::unordered_map<std::string, bool> openPeers_;
 };
 
 } // namespace Cooperate
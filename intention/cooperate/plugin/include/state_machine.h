@@ -83,6 +83,7 @@ private:
     void OnSoftbusSessionClosed(Context &context, const CooperateEvent &event);
     void OnSoftbusSessionOpened(Context &context, const CooperateEvent &event);
     void OnHotPlugEvent(Context &context, const CooperateEvent &event);
+    void OnHotPlugBatchEvent(Context &context, const CooperateEvent &event);
     void OnRemoteStart(Context &context, const CooperateEvent &event);
     void OnRemoteHotPlug(Context &context, const CooperateEvent &event);
     void OnRemoteInputDevice(Context &context, const CooperateEvent &event);
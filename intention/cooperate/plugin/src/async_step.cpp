@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "async_step.h"
+
+#include "devicestatus_define.h"
+
+#undef LOG_TAG
+#define LOG_TAG "AsyncStep"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace Cooperate {
+
+StepExecutor::~StepExecutor()
+{
+    Stop();
+}
+
+void StepExecutor::Post(std::function<void()> task)
+{
+    CHKPV(task);
+    std::lock_guard guard(mutex_);
+    if (stopped_) {
+        FI_HILOGW("Executor has been stopped");
+        return;
+    }
+    if (!thread_.joinable()) {
+        thread_ = std::thread([this] { this->Run(); });
+    }
+    tasks_.push_back(std::move(task));
+    cond_.notify_one();
+}
+
+void StepExecutor::Stop()
+{
+    {
+        std::lock_guard guard(mutex_);
+        stopped_ = true;
+        if (!tasks_.empty()) {
+            FI_HILOGI("Drop %{public}zu pending steps", tasks_.size());
+            tasks_.clear();
+        }
+    }
+    cond_.notify_all();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+void StepExecutor::Run()
+{
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock lock(mutex_);
+            cond_.wait(lock, [this] { return stopped_ || !tasks_.empty(); });
+            if (stopped_) {
+                return;
+            }
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+        }
+        task();
+    }
+}
+} // namespace Cooperate
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
@@ -15,6 +15,7 @@
 
 #include "cooperate.h"
 #include "cooperate_hisysevent.h"
+#include "cooperate_radar_reporter.h"
 
 #ifdef ENABLE_PERFORMANCE_CHECK
 #include <sstream>
@@ -178,7 +179,7 @@ int32_t Cooperate::Start(int32_t pid, int32_t userData, const std::string &remot
         radarInfo.bizStage =  static_cast<int32_t> (BizCooperateStage::STAGE_CHECK_LOCAL_SWITCH);
         radarInfo.stageRes = static_cast<int32_t> (BizCooperateStageRes::RES_FAIL);
         radarInfo.errCode = static_cast<int32_t> (CooperateRadarErrCode::CHECK_LOCAL_SWITCH_FAILED);
-        CooperateRadar::ReportCooperateRadarInfo(radarInfo);
+        CooperateRadarReporter::GetInstance().Report(radarInfo);
     }
 #ifdef ENABLE_PERFORMANCE_CHECK
     std::ostringstream ss;
@@ -202,12 +203,12 @@ int32_t Cooperate::Start(int32_t pid, int32_t userData, const std::string &remot
         radarInfo.bizStage = static_cast<int32_t> (BizCooperateStage::STAGE_CALLING_COOPERATE);
         radarInfo.stageRes = static_cast<int32_t> (BizCooperateStageRes::RES_FAIL);
         radarInfo.errCode = static_cast<int32_t> (CooperateRadarErrCode::CALLING_COOPERATE_FAILED);
-        CooperateRadar::ReportCooperateRadarInfo(radarInfo);
+        CooperateRadarReporter::GetInstance().Report(radarInfo);
     };
     radarInfo.bizState = static_cast<int32_t> (BizState::STATE_BEGIN),
     radarInfo.stageRes = static_cast<int32_t> (BizCooperateStageRes::RES_SUCCESS),
     radarInfo.errCode = static_cast<int32_t> (CooperateRadarErrCode::CALLING_COOPERATE_SUCCESS),
-    CooperateRadar::ReportCooperateRadarInfo(radarInfo);
+    CooperateRadarReporter::GetInstance().Report(radarInfo);
     return errCode.get();
 }
 
@@ -243,7 +244,7 @@ int32_t Cooperate::StartWithOptions(int32_t pid, int32_t userData, const std::st
         radarInfo.bizStage =  static_cast<int32_t> (BizCooperateStage::STAGE_CHECK_LOCAL_SWITCH);
         radarInfo.stageRes = static_cast<int32_t> (BizCooperateStageRes::RES_FAIL);
         radarInfo.errCode = static_cast<int32_t> (CooperateRadarErrCode::CHECK_LOCAL_SWITCH_FAILED);
-        CooperateRadar::ReportCooperateRadarInfo(radarInfo);
+        CooperateRadarReporter::GetInstance().Report(radarInfo);
     }
 #ifdef ENABLE_PERFORMANCE_CHECK
     std::ostringstream ss;
@@ -271,12 +272,12 @@ int32_t Cooperate::StartWithOptions(int32_t pid, int32_t userData, const std::st
         radarInfo.bizStage = static_cast<int32_t> (BizCooperateStage::STAGE_CALLING_COOPERATE);
         radarInfo.stageRes = static_cast<int32_t> (BizCooperateStageRes::RES_FAIL);
         radarInfo.errCode = static_cast<int32_t> (CooperateRadarErrCode::CALLING_COOPERATE_FAILED);
-        CooperateRadar::ReportCooperateRadarInfo(radarInfo);
+        CooperateRadarReporter::GetInstance().Report(radarInfo);
     };
     radarInfo.bizState = static_cast<int32_t> (BizState::STATE_BEGIN),
     radarInfo.stageRes = static_cast<int32_t> (BizCooperateStageRes::RES_SUCCESS),
     radarInfo.errCode = static_cast<int32_t> (CooperateRadarErrCode::CALLING_COOPERATE_SUCCESS),
-    CooperateRadar::ReportCooperateRadarInfo(radarInfo);
+    CooperateRadarReporter::GetInstance().Report(radarInfo);
     return errCode.get();
 }
 
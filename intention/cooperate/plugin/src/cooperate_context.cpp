@@ -104,6 +104,35 @@ void HotplugObserver::OnDeviceRemoved(std::shared_ptr<IDevice> dev)
     }
 }
 
+void HotplugObserver::OnDevicesChanged(const DeviceChanges &changes)
+{
+    InputHotplugBatchEvent batch;
+    batch.changes.reserve(changes.removed.size() + changes.added.size());
+    for (const auto &dev : changes.removed) {
+        CHKPC(dev);
+        batch.changes.push_back(InputHotplugEvent {
+            .deviceId = dev->GetId(),
+            .type = InputHotplugType::UNPLUG,
+            .isKeyboard = dev->IsKeyboard(),
+        });
+    }
+    for (const auto &dev : changes.added) {
+        CHKPC(dev);
+        batch.changes.push_back(InputHotplugEvent {
+            .deviceId = dev->GetId(),
+            .type = InputHotplugType::PLUG,
+            .isKeyboard = dev->IsKeyboard(),
+        });
+    }
+    if (batch.changes.empty()) {
+        return;
+    }
+    auto ret = sender_.Send(CooperateEvent(CooperateEventType::INPUT_HOTPLUG_BATCH_EVENT, batch));
+    if (ret != Channel<CooperateEvent>::NO_ERROR) {
+        FI_HILOGE("Failed to send event via channel, error:%{public}d", ret);
+    }
+}
+
 Context::Context(IContext *env)
     : dsoftbus_(env), eventMgr_(env), hotArea_(env), mouseLocation_(env), inputDevMgr_(env),
       inputEventBuilder_(env), inputEventInterceptor_(env), env_(env)
@@ -14,7 +14,9 @@
  */
 
 #include "cooperate_free.h"
+
 #include "cooperate_hisysevent.h"
+#include "cooperate_radar_reporter.h"
 
 #include "devicestatus_define.h"
 #include "utility.h"
@@ -26,6 +28,10 @@ namespace OHOS {
 namespace Msdp {
 namespace DeviceStatus {
 namespace Cooperate {
+namespace {
+constexpr std::chrono::milliseconds OPEN_SESSION_DEADLINE { 5000 };
+constexpr std::chrono::milliseconds CHECK_ONLINE_DEADLINE { 1000 };
+} // namespace
 
 CooperateFree::CooperateFree(IStateMachine &parent, IContext *env)
     : ICooperateState(parent), env_(env)
@@ -37,6 +43,7 @@ CooperateFree::CooperateFree(IStateMachine &parent, IContext *env)
 
 CooperateFree::~CooperateFree()
 {
+    executor_.Stop();
     Initial::RemoveChains(initial_);
 }
 
@@ -178,15 +185,35 @@ void CooperateFree::Initial::OnStart(Context &context, const CooperateEvent &eve
         return;
     }
     bool needCheckSameAccount = !(parent_.env_->GetDSoftbus().HasSessionExisted(context.Peer()));
-    int32_t ret = context.dsoftbus_.OpenSession(context.Peer());
+    // Opening the session and the trust check wait on the peer, so they run on the executor
+    // while the local parameters are read on this thread.
+    std::string peer = context.Peer();
+    DSoftbusHandler &dsoftbus = context.dsoftbus_;
+    AsyncStep<int32_t> openSession(parent_.executor_, [&dsoftbus, peer] { return dsoftbus.OpenSession(peer); },
+        [&dsoftbus, peer](int32_t ret) {
+            if (ret == RET_OK) {
+                FI_HILOGW("Close session to \'%{public}s\' opened after start was given up",
+                    Utility::Anonymize(peer).c_str());
+                dsoftbus.CloseSession(peer);
+            }
+        });
+    AsyncStep<int32_t> checkOnline(parent_.executor_, [&dsoftbus, peer] { return dsoftbus.CheckDeviceOnline(peer); });
+    int32_t pointerSpeed = context.GetPointerSpeed();
+    int32_t touchPadSpeed = context.GetTouchPadSpeed();
+    int32_t userId = parent_.env_->GetDDM().GetUserId();
+    std::string accountId = parent_.env_->GetDDM().GetAccountId();
+
+    int32_t ret = RET_ERR;
+    if (!openSession.Wait(OPEN_SESSION_DEADLINE, ret)) {
+        FI_HILOGE("[start cooperation] Timeout connecting to \'%{public}s\'", Utility::Anonymize(peer).c_str());
+    }
     if (ret != RET_OK) {
         CooperateFail(context, ret);
         return;
     }
     InitiatorPointerVisible(false);
-    ret = context.dsoftbus_.CheckDeviceOnline(context.Peer());
-    if (ret != RET_OK) {
-        FI_HILOGE("CheckDeviceOnline failed, networkId:%{public}s", Utility::Anonymize(context.Peer()).c_str());
+    if (!checkOnline.Wait(CHECK_ONLINE_DEADLINE, ret) || (ret != RET_OK)) {
+        FI_HILOGE("CheckDeviceOnline failed, networkId:%{public}s", Utility::Anonymize(peer).c_str());
         InitiatorPointerVisible(true);
         return;
     }
@@ -194,15 +221,15 @@ void CooperateFree::Initial::OnStart(Context &context, const CooperateEvent &eve
         .originNetworkId = context.Local(),
         .success = true,
         .cursorPos = context.NormalizedCursorPosition(),
-        .pointerSpeed = context.GetPointerSpeed(),
-        .touchPadSpeed = context.GetTouchPadSpeed(),
+        .pointerSpeed = pointerSpeed,
+        .touchPadSpeed = touchPadSpeed,
         .uid = notice.uid,
-        .userId = parent_.env_->GetDDM().GetUserId(),
-        .accountId = parent_.env_->GetDDM().GetAccountId(),
+        .userId = userId,
+        .accountId = accountId,
         .needCheckSameAccount = needCheckSameAccount
     };
     context.OnStartCooperate(startNotice.extra);
-    ret = context.dsoftbus_.StartCooperate(context.Peer(), startNotice);
+    ret = context.dsoftbus_.StartCooperate(peer, startNotice);
     if (ret != RET_OK) {
         InitiatorPointerVisible(true);
         return;
@@ -212,6 +239,8 @@ void CooperateFree::Initial::OnStart(Context &context, const CooperateEvent &eve
         InitiatorPointerVisible(true);
         return;
     }
+    FI_HILOGI("[start cooperation] Session:%{public}" PRId64 "ms, online:%{public}" PRId64 "ms",
+        openSession.GetElapsed(), checkOnline.GetElapsed());
     context.eventMgr_.StartCooperateFinish(startNotice);
     FI_HILOGI("[start cooperation] Cooperation with \'%{public}s\' established",
         Utility::Anonymize(context.Peer()).c_str());
@@ -219,7 +248,7 @@ void CooperateFree::Initial::OnStart(Context &context, const CooperateEvent &eve
     context.OnTransitionOut();
 #ifdef ENABLE_PERFORMANCE_CHECK
     std::ostringstream ss;
-    ss << "start_cooperation_with_ " << Utility::Anonymize(context.Peer()).c_str();
+    ss << "start_cooperation_with_" << Utility::Anonymize(context.Peer()).c_str();
     context.FinishTrace(ss.str());
 #endif // ENABLE_PERFORMANCE_CHECK
 }
@@ -247,7 +276,7 @@ void CooperateFree::Initial::CooperateFail(Context &context, int32_t ret)
             .localNetId = Utility::DFXRadarAnonymize(context.Local().c_str()),
             .peerNetId = Utility::DFXRadarAnonymize(context.Peer().c_str())
         };
-        CooperateRadar::ReportCooperateRadarInfo(radarInfo);
+        CooperateRadarReporter::GetInstance().Report(radarInfo);
         int32_t errNum = (ret == RET_ERR ? static_cast<int32_t>(CoordinationErrCode::OPEN_SESSION_FAILED) : ret);
         DSoftbusStartCooperateFinished failNotice {
             .success = false,
@@ -324,7 +353,7 @@ void CooperateFree::Initial::OnStartWithOptions(Context &context, const Cooperat
     context.OnTransitionOut();
 #ifdef ENABLE_PERFORMANCE_CHECK
     std::ostringstream ss;
-    ss << "start_cooperation_with_ " << Utility::Anonymize(context.Peer()).c_str();
+    ss << "start_cooperation_with_" << Utility::Anonymize(context.Peer()).c_str();
     context.FinishTrace(ss.str());
 #endif // ENABLE_PERFORMANCE_CHECK
 }
@@ -365,6 +394,7 @@ void CooperateFree::Initial::OnRemoteStart(Context &context, const CooperateEven
     context.eventMgr_.RemoteStart(notice);
     context.RemoteStartSuccess(notice);
     context.inputEventBuilder_.Enable(context);
+    context.dsoftbus_.StartCooperateResponse(context.Peer());
     context.eventMgr_.RemoteStartFinish(notice);
     context.inputDevMgr_.AddVirtualInputDevice(context.Peer());
     FI_HILOGI("[remote start] Cooperation with \'%{public}s\' established", Utility::Anonymize(context.Peer()).c_str());
@@ -15,6 +15,7 @@
 
 #include "cooperate_in.h"
 #include "cooperate_hisysevent.h"
+#include "cooperate_radar_reporter.h"
 
 #include "devicestatus_define.h"
 #include "utility.h"
@@ -61,13 +62,13 @@ void CooperateIn::OnEnterState(Context &context)
         radarInfo.bizStage = static_cast<int32_t> (BizCooperateStage::STAGE_PASSIVE_CURSOR_VISIBILITY);
         radarInfo.stageRes = static_cast<int32_t> (BizCooperateStageRes::RES_FAIL);
         radarInfo.errCode = static_cast<int32_t> (CooperateRadarErrCode::PASSIVE_CURSOR_VISIBILITY_FAILED);
-        CooperateRadar::ReportCooperateRadarInfo(radarInfo);
+        CooperateRadarReporter::GetInstance().Report(radarInfo);
         return;
     }
     radarInfo.bizStage = static_cast<int32_t> (BizCooperateStage::STAGE_PASSIVE_CURSOR_VISIBILITY);
     radarInfo.stageRes = static_cast<int32_t> (BizCooperateStageRes::RES_SUCCESS);
     radarInfo.errCode = static_cast<int32_t> (CooperateRadarErrCode::CALLING_COOPERATE_SUCCESS);
-    CooperateRadar::ReportCooperateRadarInfo(radarInfo);
+    CooperateRadarReporter::GetInstance().Report(radarInfo);
 }
 
 void CooperateIn::OnLeaveState(Context & context)
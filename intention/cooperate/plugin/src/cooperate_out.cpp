@@ -15,6 +15,7 @@
 
 #include "cooperate_out.h"
 #include "cooperate_hisysevent.h"
+#include "cooperate_radar_reporter.h"
 
 #include "devicestatus_define.h"
 #include "utility.h"
@@ -61,7 +62,7 @@ void CooperateOut::OnEnterState(Context &context)
             .localNetId = "",
             .peerNetId = ""
         };
-        CooperateRadar::ReportCooperateRadarInfo(radarInfo);
+        CooperateRadarReporter::GetInstance().Report(radarInfo);
     }
 }
 
@@ -19,8 +19,10 @@
 #include "token_setproc.h"
 
 #include "cooperate_hisysevent.h"
+#include "cooperate_radar_reporter.h"
 #include "device.h"
 #include "devicestatus_define.h"
+#include "input_device_inventory.h"
 #include "utility.h"
 
 #undef LOG_TAG
@@ -40,6 +42,9 @@ DSoftbusHandler::DSoftbusHandler(IContext *env)
         { static_cast<int32_t>(MessageId::DSOFTBUS_START_COOPERATE),
         [this] (const std::string &networkId, NetPacket &packet) {
             this->OnStartCooperate(networkId, packet);}},
+        { static_cast<int32_t>(MessageId::DSOFTBUS_START_COOPERATE_RESPONSE),
+        [this] (const std::string &networkId, NetPacket &packet) {
+            this->OnStartCooperateResponse(networkId, packet);}},
         { static_cast<int32_t>(MessageId::DSOFTBUS_STOP_COOPERATE),
         [this] (const std::string &networkId, NetPacket &packet) {
             this->OnStopCooperate(networkId, packet);}},
@@ -76,6 +81,15 @@ DSoftbusHandler::DSoftbusHandler(IContext *env)
         { static_cast<int32_t>(MessageId::DSOFTBUS_INPUT_DEV_HOT_PLUG),
         [this] (const std::string &networkId, NetPacket &packet) {
             this->OnRemoteHotPlug(networkId, packet);}},
+        { static_cast<int32_t>(MessageId::DSOFTBUS_INPUT_DEV_DIGEST),
+        [this] (const std::string &networkId, NetPacket &packet) {
+            this->OnRemoteInputDeviceDigest(networkId, packet);}},
+        { static_cast<int32_t>(MessageId::DSOFTBUS_INPUT_DEV_PULL),
+        [this] (const std::string &networkId, NetPacket &packet) {
+            this->OnRemoteInputDevicePull(networkId, packet);}},
+        { static_cast<int32_t>(MessageId::DSOFTBUS_INPUT_DEV_DELTA),
+        [this] (const std::string &networkId, NetPacket &packet) {
+            this->OnRemoteInputDeviceDelta(networkId, packet);}},
         { static_cast<int32_t>(MessageId::DSOFTBUS_COOPERATE_WITH_OPTIONS),
         [this] (const std::string &networkId, NetPacket &packet) {
             this->OnStartCooperateWithOptions(networkId, packet);}},
@@ -162,9 +176,13 @@ int32_t DSoftbusHandler::StartCooperate(const std::string &networkId, const DSof
             .localNetId = Utility::DFXRadarAnonymize(event.originNetworkId.c_str()),
             .peerNetId = Utility::DFXRadarAnonymize(networkId.c_str())
         };
-        CooperateRadar::ReportCooperateRadarInfo(radarInfo);
+        CooperateRadarReporter::GetInstance().Report(radarInfo);
         return RET_ERR;
     }
+    {
+        std::lock_guard guard(lock_);
+        startTimes_[networkId] = std::chrono::steady_clock::now();
+    }
     int32_t ret = env_->GetDSoftbus().SendPacket(networkId, packet);
     if (ret != RET_OK) {
         OnCommunicationFailure(networkId);
@@ -179,7 +197,19 @@ int32_t DSoftbusHandler::StartCooperate(const std::string &networkId, const DSof
             .localNetId = Utility::DFXRadarAnonymize(event.originNetworkId.c_str()),
             .peerNetId = Utility::DFXRadarAnonymize(networkId.c_str())
         };
-        CooperateRadar::ReportCooperateRadarInfo(radarInfo);
+        CooperateRadarReporter::GetInstance().Report(radarInfo);
+    }
+    return ret;
+}
+
+int32_t DSoftbusHandler::StartCooperateResponse(const std::string &networkId)
+{
+    CALL_INFO_TRACE;
+    CHKPR(env_, RET_ERR);
+    NetPacket packet(MessageId::DSOFTBUS_START_COOPERATE_RESPONSE);
+    int32_t ret = env_->GetDSoftbus().SendPacket(networkId, packet);
+    if (ret != RET_OK) {
+        FI_HILOGW("Failed to acknowledge start of \'%{public}s\'", Utility::Anonymize(networkId).c_str());
     }
     return ret;
 }
@@ -205,7 +235,7 @@ int32_t DSoftbusHandler::StartCooperateWithOptions(const std::string &networkId,
             .localNetId = Utility::DFXRadarAnonymize(event.originNetworkId.c_str()),
             .peerNetId = Utility::DFXRadarAnonymize(networkId.c_str())
         };
-        CooperateRadar::ReportCooperateRadarInfo(radarInfo);
+        CooperateRadarReporter::GetInstance().Report(radarInfo);
         return RET_ERR;
     }
     int32_t ret = env_->GetDSoftbus().SendPacket(networkId, packet);
@@ -222,7 +252,7 @@ int32_t DSoftbusHandler::StartCooperateWithOptions(const std::string &networkId,
             .localNetId = Utility::DFXRadarAnonymize(event.originNetworkId.c_str()),
             .peerNetId = Utility::DFXRadarAnonymize(networkId.c_str())
         };
-        CooperateRadar::ReportCooperateRadarInfo(radarInfo);
+        CooperateRadarReporter::GetInstance().Report(radarInfo);
     }
     return ret;
 }
@@ -435,7 +465,7 @@ void DSoftbusHandler::OnStartCooperate(const std::string &networkId, NetPacket &
         radarInfo.bizStage =  static_cast<int32_t> (BizCooperateStage::STAGE_PASSIVE_DEASERIALIZATION);
         radarInfo.stageRes = static_cast<int32_t> (BizCooperateStageRes::RES_FAIL);
         radarInfo.errCode = static_cast<int32_t> (CooperateRadarErrCode::PASSIVE_DEASERIALIZATION_FAILED);
-        CooperateRadar::ReportCooperateRadarInfo(radarInfo);
+        CooperateRadarReporter::GetInstance().Report(radarInfo);
         return;
     }
     packet >> event.extra.priv;
@@ -474,7 +504,7 @@ void DSoftbusHandler::OnStartCooperate(const std::string &networkId, NetPacket &
     radarInfo.bizStage =  static_cast<int32_t> (BizCooperateStage::STAGE_PASSIVE_DEASERIALIZATION);
     radarInfo.stageRes = static_cast<int32_t> (BizCooperateStageRes::RES_SUCCESS);
     radarInfo.errCode = static_cast<int32_t> (CooperateRadarErrCode::CALLING_COOPERATE_SUCCESS);
-    CooperateRadar::ReportCooperateRadarInfo(radarInfo);
+    CooperateRadarReporter::GetInstance().Report(radarInfo);
     RemoteStartCooperate();
 }
 
@@ -489,6 +519,19 @@ void DSoftbusHandler::RemoteStartCooperate()
     motionDrag->OnRemoteStartCooperateSetPointerButtonDown();
 }
 
+void DSoftbusHandler::OnStartCooperateResponse(const std::string &networkId, NetPacket &packet)
+{
+    CALL_DEBUG_ENTER;
+    std::lock_guard guard(lock_);
+    if (auto iter = startTimes_.find(networkId); iter != startTimes_.end()) {
+        int64_t elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - iter->second).count();
+        FI_HILOGI("[start cooperation] \'%{public}s\' acknowledged in %{public}" PRId64 "ms",
+            Utility::Anonymize(networkId).c_str(), elapsed);
+        startTimes_.erase(iter);
+    }
+}
+
 void DSoftbusHandler::OnStopCooperate(const std::string &networkId, NetPacket &packet)
 {
     CALL_INFO_TRACE;
@@ -523,7 +566,7 @@ void DSoftbusHandler::OnStartCooperateWithOptions(const std::string &networkId,
         radarInfo.bizStage =  static_cast<int32_t> (BizCooperateStage::STAGE_PASSIVE_DEASERIALIZATION);
         radarInfo.stageRes = static_cast<int32_t> (BizCooperateStageRes::RES_FAIL);
         radarInfo.errCode = static_cast<int32_t> (CooperateRadarErrCode::PASSIVE_DEASERIALIZATION_FAILED);
-        CooperateRadar::ReportCooperateRadarInfo(radarInfo);
+        CooperateRadarReporter::GetInstance().Report(radarInfo);
         return;
     }
     packet >> event.extra.priv;
@@ -556,7 +599,7 @@ void DSoftbusHandler::OnStartCooperateWithOptions(const std::string &networkId,
     radarInfo.bizStage =  static_cast<int32_t> (BizCooperateStage::STAGE_PASSIVE_DEASERIALIZATION);
     radarInfo.stageRes = static_cast<int32_t> (BizCooperateStageRes::RES_SUCCESS);
     radarInfo.errCode = static_cast<int32_t> (CooperateRadarErrCode::CALLING_COOPERATE_SUCCESS);
-    CooperateRadar::ReportCooperateRadarInfo(radarInfo);
+    CooperateRadarReporter::GetInstance().Report(radarInfo);
     RemoteStartCooperate();
 }
 
@@ -823,6 +866,60 @@ void DSoftbusHandler::OnRemoteInputDevice(const std::string& networkId, NetPacke
         event));
 }
 
+void DSoftbusHandler::OnRemoteInputDeviceDigest(const std::string &networkId, NetPacket &packet)
+{
+    CALL_INFO_TRACE;
+    DSoftbusSyncInputDevice event {
+        .networkId = networkId,
+        .type = InputDevSyncType::DIGEST,
+    };
+    packet >> event.digest;
+    if (packet.ChkRWError()) {
+        FI_HILOGE("Packet read digest failed");
+        return;
+    }
+    SendEvent(CooperateEvent(
+        CooperateEventType::DSOFTBUS_INPUT_DEV_SYNC,
+        event));
+}
+
+void DSoftbusHandler::OnRemoteInputDevicePull(const std::string &networkId, NetPacket &packet)
+{
+    CALL_INFO_TRACE;
+    DSoftbusSyncInputDevice event {
+        .networkId = networkId,
+        .type = InputDevSyncType::PULL,
+    };
+    if (InputDeviceInventory::ReadEntries(packet, event.baseDigest, event.entries) != RET_OK) {
+        FI_HILOGE("ReadEntries failed");
+        return;
+    }
+    SendEvent(CooperateEvent(
+        CooperateEventType::DSOFTBUS_INPUT_DEV_SYNC,
+        event));
+}
+
+void DSoftbusHandler::OnRemoteInputDeviceDelta(const std::string &networkId, NetPacket &packet)
+{
+    CALL_INFO_TRACE;
+    InputDeviceDelta delta;
+    if (InputDeviceInventory::ReadDelta(packet, delta) != RET_OK) {
+        FI_HILOGE("ReadDelta failed");
+        return;
+    }
+    FI_HILOGI("Delta of %{public}zu devices, %{public}zu removed", delta.devices.size(), delta.removedIds.size());
+    SendEvent(CooperateEvent(
+        CooperateEventType::DSOFTBUS_INPUT_DEV_SYNC,
+        DSoftbusSyncInputDevice {
+            .networkId = networkId,
+            .devices = std::move(delta.devices),
+            .type = InputDevSyncType::DELTA,
+            .baseDigest = delta.baseDigest,
+            .digest = delta.digest,
+            .removedIds = std::move(delta.removedIds),
+        }));
+}
+
 void DSoftbusHandler::OnRemoteHotPlug(const std::string &networkId, NetPacket &packet)
 {
     CALL_INFO_TRACE;
@@ -843,47 +940,7 @@ void DSoftbusHandler::OnRemoteHotPlug(const std::string &networkId, NetPacket &p
 int32_t DSoftbusHandler::DeserializeDevice(std::shared_ptr<IDevice> device, NetPacket &packet)
 {
     CALL_DEBUG_ENTER;
-    CHKPR(device, RET_ERR);
-    int32_t data;
-    std::string str;
-    packet >> data;
-    device->SetId(data);
-    packet >> str;
-    device->SetDevPath(str);
-    packet >> str;
-    device->SetSysPath(str);
-    packet >> data;
-    device->SetBus(data);
-    packet >> data;
-    device->SetVendor(data);
-    packet >> data;
-    device->SetProduct(data);
-    packet >> data;
-    device->SetVersion(data);
-    packet >> str;
-    device->SetName(str);
-    packet >> str;
-    device->SetPhys(str);
-    packet >> str;
-    device->SetUniq(str);
-    bool isPointerDevice { false };
-    packet >> isPointerDevice;
-    if (isPointerDevice) {
-        device->AddCapability(IDevice::Capability::DEVICE_CAP_POINTER);
-    }
-    bool isKeyboard { false };
-    packet >> isKeyboard;
-    if (isKeyboard) {
-        device->AddCapability(IDevice::Capability::DEVICE_CAP_KEYBOARD);
-    }
-    int32_t keyboardType { static_cast<int32_t> (IDevice::KeyboardType::KEYBOARD_TYPE_NONE) };
-    packet >> keyboardType;
-    device->SetKeyboardType(static_cast<IDevice::KeyboardType>(keyboardType));
-    if (packet.ChkRWError()) {
-        FI_HILOGE("Packet read type failed");
-        return RET_ERR;
-    }
-    return RET_OK;
+    return InputDeviceInventory::DeserializeDevice(device, packet);
 }
 } // namespace Cooperate
 } // namespace DeviceStatus
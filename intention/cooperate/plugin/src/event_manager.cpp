@@ -38,24 +38,13 @@ void EventManager::RegisterListener(const RegisterListenerEvent &event)
     eventInfo->pid = event.pid;
 
     FI_HILOGI("Add cooperate listener (%{public}d)", eventInfo->pid);
-    auto iter = std::find_if(listeners_.begin(), listeners_.end(),
-        [eventInfo](const auto &item) {
-            return ((item != nullptr) && (item->pid == eventInfo->pid));
-        });
-    if (iter != listeners_.end()) {
-        *iter = eventInfo;
-    } else {
-        listeners_.emplace_back(eventInfo);
-    }
+    listeners_[eventInfo->pid] = eventInfo;
 }
 
 void EventManager::UnregisterListener(const UnregisterListenerEvent &event)
 {
     FI_HILOGI("Remove cooperate listener (%{public}d)", event.pid);
-    listeners_.erase(std::remove_if(listeners_.begin(), listeners_.end(),
-        [pid = event.pid](const auto &item) {
-            return ((item == nullptr) || (item->pid == pid));
-        }), listeners_.end());
+    listeners_.erase(event.pid);
 }
 
 void EventManager::EnableCooperate(const EnableCooperateEvent &event)
@@ -239,38 +228,35 @@ void EventManager::GetCooperateState(const CooperateStateNotice &notice)
 void EventManager::OnCooperateMessage(CoordinationMessage msg, const std::string &networkId)
 {
     CALL_INFO_TRACE;
-    for (auto iter = listeners_.begin(); iter != listeners_.end(); ++iter) {
-        std::shared_ptr<EventInfo> listener = *iter;
+    // Notices to listeners differ only in message id and user data, so each distinct
+    // pair is encoded once and the same bytes are sent to every listener sharing it.
+    std::map<std::pair<MessageId, int32_t>, std::shared_ptr<EncodedNotice>> encoded;
+    for (auto &[pid, listener] : listeners_) {
         CHKPC(listener);
-        FI_HILOGD("Notify cooperate listener (%{public}d, %{public}d)", listener->pid, listener->msgId);
-        CooperateNotice notice {
-            .pid = listener->pid,
-            .msgId = listener->msgId,
-            .userData = listener->userData,
-            .networkId = networkId,
-            .msg = msg
-        };
-        NotifyCooperateMessage(notice);
+        FI_HILOGD("Notify cooperate listener (%{public}d, %{public}d)", pid, listener->msgId);
+        auto &encodedNotice = encoded[std::make_pair(listener->msgId, listener->userData)];
+        if (encodedNotice == nullptr) {
+            CooperateNotice notice {
+                .pid = pid,
+                .msgId = listener->msgId,
+                .userData = listener->userData,
+                .networkId = networkId,
+                .msg = msg
+            };
+            encodedNotice = std::make_shared<EncodedNotice>(notice.msgId);
+            if (!EncodeCooperateMessage(notice, encodedNotice->pkt, encodedNotice->buf)) {
+                encodedNotice = nullptr;
+                continue;
+            }
+        }
+        MulticastToListener(*listener, encodedNotice->pkt, encodedNotice->buf);
     }
 }
 
 void EventManager::OnClientDied(const ClientDiedEvent &event)
 {
     FI_HILOGI("Remove client died listener, pid: %{public}d", event.pid);
-    for (auto iter = listeners_.begin(); iter != listeners_.end();) {
-        std::shared_ptr<EventInfo> listener = *iter;
-        if (listener == nullptr) {
-            FI_HILOGW("listener is null");
-            iter = listeners_.erase(iter);
-            continue;
-        }
-        if (event.pid == listener->pid) {
-            iter = listeners_.erase(iter);
-            break;
-        } else {
-            ++iter;
-        }
-    }
+    listeners_.erase(event.pid);
 }
 
 void EventManager::ErrorNotAollowCooperateWhenMotionDragging(const NotAllowCooperateWhenMotionDragging &event)
@@ -288,13 +274,11 @@ void EventManager::ErrorNotAollowCooperateWhenMotionDragging(const NotAllowCoope
 
 void EventManager::NotifyCooperateMessage(const CooperateNotice &notice)
 {
-    CHKPV(env_);
-    auto session = env_->GetSocketSessionManager().FindSessionByPid(notice.pid);
+    auto session = FindSession(notice.pid);
     if (session == nullptr) {
         FI_HILOGD("session is null");
         return;
     }
-    CHKPV(session);
     NetPacket pkt(notice.msgId);
     pkt << notice.userData << notice.networkId << static_cast<int32_t>(notice.msg) << notice.errCode;
     if (pkt.ChkRWError()) {
@@ -306,11 +290,63 @@ void EventManager::NotifyCooperateMessage(const CooperateNotice &notice)
     }
 }
 
+bool EventManager::EncodeCooperateMessage(const CooperateNotice &notice, NetPacket &pkt, StreamBuffer &buf)
+{
+    pkt << notice.userData << notice.networkId << static_cast<int32_t>(notice.msg) << notice.errCode;
+    if (pkt.ChkRWError()) {
+        FI_HILOGE("Packet write data failed");
+        return false;
+    }
+    if (!pkt.MakeData(buf)) {
+        FI_HILOGE("Failed to buffer packet");
+        return false;
+    }
+    return true;
+}
+
+SocketSessionPtr EventManager::FindSession(int32_t pid)
+{
+    CHKPP(env_);
+    auto iter = listeners_.find(pid);
+    if ((iter == listeners_.end()) || (iter->second == nullptr)) {
+        return env_->GetSocketSessionManager().FindSessionByPid(pid);
+    }
+    // The session manager holds the only strong reference, so the handle expires when the session closes.
+    auto session = iter->second->session.lock();
+    if (session == nullptr) {
+        session = env_->GetSocketSessionManager().FindSessionByPid(pid);
+        iter->second->session = session;
+    }
+    return session;
+}
+
+void EventManager::MulticastToListener(EventInfo &listener, NetPacket &pkt, const StreamBuffer &buf)
+{
+    auto session = FindSession(listener.pid);
+    if (session == nullptr) {
+        FI_HILOGD("session is null");
+        return;
+    }
+    SendResult ret = session->TrySendMsg(buf.Data(), buf.Size());
+    if (ret == SEND_BACKPRESSURE) {
+        // State notices must not get lost, so they wait in the session queue, which never blocks.
+        ++listener.nBackpressured;
+        FI_HILOGW("Listener (%{public}d) is not draining, queued %{public}zu notices",
+            listener.pid, listener.nBackpressured);
+        if (!session->SendMsg(pkt)) {
+            FI_HILOGE("Sending failed");
+            listener.session.reset();
+        }
+    } else if (ret == SEND_FAILED) {
+        FI_HILOGE("Sending failed");
+        listener.session.reset();
+    }
+}
+
 void EventManager::NotifyCooperateState(const CooperateStateNotice &notice)
 {
     CALL_INFO_TRACE;
-    CHKPV(env_);
-    auto session = env_->GetSocketSessionManager().FindSessionByPid(notice.pid);
+    auto session = FindSession(notice.pid);
     CHKPV(session);
     NetPacket pkt(notice.msgId);
     pkt << notice.userData << notice.state << static_cast<int32_t>(notice.errCode);
@@ -15,7 +15,7 @@
 
 #include "hot_area.h"
 
-#include "display_manager.h"
+#include <limits>
 
 #include "devicestatus_define.h"
 
@@ -31,6 +31,32 @@ constexpr int32_t HOT_AREA_WIDTH { 100 };
 constexpr int32_t HOT_AREA_MARGIN { 200 };
 }; // namespace
 
+HotArea::~HotArea()
+{
+    if (displayListener_ != nullptr) {
+        Rosen::DisplayManager::GetInstance().UnregisterDisplayListener(displayListener_);
+        displayListener_ = nullptr;
+    }
+}
+
+void HotArea::DisplayListener::OnCreate(Rosen::DisplayId displayId)
+{
+    FI_HILOGI("display:%{public}" PRIu64 " created", displayId);
+    hotArea_.UpdateLayout();
+}
+
+void HotArea::DisplayListener::OnDestroy(Rosen::DisplayId displayId)
+{
+    FI_HILOGI("display:%{public}" PRIu64 " destroyed", displayId);
+    hotArea_.UpdateLayout();
+}
+
+void HotArea::DisplayListener::OnChange(Rosen::DisplayId displayId)
+{
+    FI_HILOGD("display:%{public}" PRIu64 " changed", displayId);
+    hotArea_.UpdateLayout();
+}
+
 void HotArea::AddListener(const RegisterHotareaListenerEvent &event)
 {
     CALL_DEBUG_ENTER;
@@ -44,6 +70,7 @@ void HotArea::AddListener(const RegisterHotareaListenerEvent &event)
         callbacks_.erase(iter);
         callbacks_.emplace(info);
     }
+    forceNotify_.store(true);
 }
 
 void HotArea::RemoveListener(const UnregisterHotareaListenerEvent &event)
@@ -56,69 +83,130 @@ void HotArea::RemoveListener(const UnregisterHotareaListenerEvent &event)
 void HotArea::EnableCooperate(const EnableCooperateEvent &event)
 {
     CALL_DEBUG_ENTER;
-    std::lock_guard guard(lock_);
-    auto display = Rosen::DisplayManager::GetInstance().GetDefaultDisplay();
-    CHKPV(display);
-    width_ = display->GetWidth();
-    height_ = display->GetHeight();
+    if (displayListener_ == nullptr) {
+        displayListener_ = sptr<DisplayListener>::MakeSptr(*this);
+        if (Rosen::DisplayManager::GetInstance().RegisterDisplayListener(displayListener_) != Rosen::DMError::DM_OK) {
+            FI_HILOGE("Failed to register display listener");
+            displayListener_ = nullptr;
+        }
+    }
+    UpdateLayout();
+}
+
+void HotArea::DisableCooperate(const DisableCooperateEvent &event)
+{
+    CALL_DEBUG_ENTER;
+    if (displayListener_ != nullptr) {
+        Rosen::DisplayManager::GetInstance().UnregisterDisplayListener(displayListener_);
+        displayListener_ = nullptr;
+    }
+}
+
+HotArea::DisplayHotRegions HotArea::BuildHotRegions(int32_t width, int32_t height)
+{
+    constexpr int32_t minCoord { std::numeric_limits<int32_t>::min() };
+    constexpr int32_t maxCoord { std::numeric_limits<int32_t>::max() };
+    DisplayHotRegions display { .width = width, .height = height };
+    // Checked in this order, so corners belong to the left or right region.
+    display.regions = {
+        { HotAreaType::AREA_LEFT, minCoord, HOT_AREA_MARGIN, HOT_AREA_WIDTH, height - HOT_AREA_MARGIN },
+        { HotAreaType::AREA_RIGHT, width - HOT_AREA_WIDTH, HOT_AREA_MARGIN, maxCoord, height - HOT_AREA_MARGIN },
+        { HotAreaType::AREA_TOP, HOT_AREA_MARGIN, minCoord, width - HOT_AREA_MARGIN, HOT_AREA_WIDTH },
+        { HotAreaType::AREA_BOTTOM, HOT_AREA_MARGIN, height - HOT_AREA_WIDTH, width - HOT_AREA_MARGIN, maxCoord },
+    };
+    return display;
+}
+
+void HotArea::UpdateLayout()
+{
+    CALL_DEBUG_ENTER;
+    auto layout = std::make_shared<HotAreaLayout>();
+    layout->defaultDisplayId = Rosen::DisplayManager::GetInstance().GetDefaultDisplayId();
+    for (const auto &display : Rosen::DisplayManager::GetInstance().GetAllDisplays()) {
+        CHKPC(display);
+        layout->displays.emplace(display->GetId(), BuildHotRegions(display->GetWidth(), display->GetHeight()));
+    }
+    FI_HILOGI("Hot regions of %{public}zu displays updated", layout->displays.size());
+    std::atomic_store(&layout_, std::shared_ptr<const HotAreaLayout>(std::move(layout)));
+}
+
+const HotArea::DisplayHotRegions* HotArea::FindDisplay(const HotAreaLayout &layout, int32_t displayId) const
+{
+    auto iter = (displayId >= 0) ? layout.displays.find(static_cast<uint64_t>(displayId)) : layout.displays.cend();
+    if (iter == layout.displays.cend()) {
+        iter = layout.displays.find(layout.defaultDisplayId);
+    }
+    return (iter != layout.displays.cend()) ? &iter->second : nullptr;
 }
 
 int32_t HotArea::ProcessData(std::shared_ptr<MMI::PointerEvent> pointerEvent)
 {
     CALL_DEBUG_ENTER;
-    std::lock_guard guard(lock_);
     CHKPR(pointerEvent, RET_ERR);
     MMI::PointerEvent::PointerItem pointerItem;
     if (!pointerEvent->GetPointerItem(pointerEvent->GetPointerId(), pointerItem)) {
         FI_HILOGE("Corrupted pointer event");
         return RET_ERR;
     }
+    auto layout = std::atomic_load(&layout_);
+    if (layout == nullptr) {
+        return RET_OK;
+    }
+    const DisplayHotRegions *display = FindDisplay(*layout, pointerEvent->GetTargetDisplayId());
+    if (display == nullptr) {
+        return RET_OK;
+    }
     displayX_ = pointerItem.GetDisplayX();
     displayY_ = pointerItem.GetDisplayY();
     deltaX_ = pointerItem.GetRawDx();
     deltaY_ = pointerItem.GetRawDy();
-    CheckInHotArea();
-    CheckPointerToEdge(type_);
-    NotifyMessage();
+    CheckInHotArea(*display);
+    CheckPointerToEdge(*display, type_);
+    if (IsTransition()) {
+        NotifyMessage();
+    }
     return RET_OK;
 }
 
-void HotArea::CheckInHotArea()
+void HotArea::CheckInHotArea(const DisplayHotRegions &display)
 {
     CALL_DEBUG_ENTER;
-    if (displayX_ <= HOT_AREA_WIDTH && displayY_ >= HOT_AREA_MARGIN &&
-        displayY_ <= (height_ - HOT_AREA_MARGIN)) {
-        type_ = HotAreaType::AREA_LEFT;
-    } else if (displayX_ >= (width_ - HOT_AREA_WIDTH) && displayY_ >= HOT_AREA_MARGIN &&
-        displayY_ <= (height_ - HOT_AREA_MARGIN)) {
-        type_ = HotAreaType::AREA_RIGHT;
-    } else if (displayY_ <= HOT_AREA_WIDTH && displayX_ >= HOT_AREA_MARGIN &&
-        displayX_ <= (width_ - HOT_AREA_MARGIN)) {
-        type_ = HotAreaType::AREA_TOP;
-    } else if (displayY_ >= (height_ - HOT_AREA_WIDTH) && displayX_ >= HOT_AREA_MARGIN &&
-        displayX_ <= (width_ - HOT_AREA_MARGIN)) {
-        type_ = HotAreaType::AREA_BOTTOM;
-    } else {
-        type_ = HotAreaType::AREA_NONE;
+    for (const auto &region : display.regions) {
+        if (region.Contains(displayX_, displayY_)) {
+            type_ = region.type;
+            return;
+        }
     }
+    type_ = HotAreaType::AREA_NONE;
 }
 
-void HotArea::CheckPointerToEdge(HotAreaType type)
+void HotArea::CheckPointerToEdge(const DisplayHotRegions &display, HotAreaType type)
 {
     CALL_DEBUG_ENTER;
     if (type == HotAreaType::AREA_LEFT) {
         isEdge_ = displayX_ <= 0 && deltaX_ < 0;
     } else if (type == HotAreaType::AREA_RIGHT) {
-        isEdge_ = displayX_ >= (width_ - 1) && deltaX_ > 0;
+        isEdge_ = displayX_ >= (display.width - 1) && deltaX_ > 0;
     } else if (type == HotAreaType::AREA_TOP) {
         isEdge_ = displayY_ <= 0 && deltaY_ < 0;
     } else if (type == HotAreaType::AREA_BOTTOM) {
-        isEdge_ = displayY_ >= (height_ - 1) && deltaY_ > 0;
+        isEdge_ = displayY_ >= (display.height - 1) && deltaY_ > 0;
     } else {
         isEdge_ = false;
     }
 }
 
+bool HotArea::IsTransition()
+{
+    bool forced = forceNotify_.load(std::memory_order_relaxed) && forceNotify_.exchange(false);
+    if (!forced && (type_ == lastType_) && (isEdge_ == lastIsEdge_)) {
+        return false;
+    }
+    lastType_ = type_;
+    lastIsEdge_ = isEdge_;
+    return true;
+}
+
 void HotArea::NotifyMessage()
 {
     CALL_DEBUG_ENTER;
@@ -128,6 +216,7 @@ void HotArea::NotifyMessage()
 void HotArea::OnHotAreaMessage(HotAreaType msg, bool isEdge)
 {
     CALL_DEBUG_ENTER;
+    std::lock_guard guard(lock_);
     for (const auto &callback : callbacks_) {
         NotifyHotAreaMessage(callback.pid, callback.msgId, msg, isEdge);
     }
@@ -136,6 +225,7 @@ void HotArea::OnHotAreaMessage(HotAreaType msg, bool isEdge)
 void HotArea::OnClientDied(const ClientDiedEvent &event)
 {
     FI_HILOGI("Remove client died listener, pid: %{public}d", event.pid);
+    std::lock_guard guard(lock_);
     callbacks_.erase(HotAreaInfo { .pid = event.pid });
 }
 
@@ -0,0 +1,376 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "input_device_inventory.h"
+
+#include <unordered_map>
+
+#include "device.h"
+#include "devicestatus_define.h"
+
+#undef LOG_TAG
+#define LOG_TAG "InputDeviceInventory"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace Cooperate {
+namespace {
+constexpr int32_t MAX_INVENTORY_SIZE { 100 };
+constexpr int32_t INVALID_DEVICE_ID { -1 };
+constexpr uint64_t FNV_OFFSET_BASIS { 14695981039346656037ULL };
+constexpr uint64_t FNV_PRIME { 1099511628211ULL };
+constexpr uint32_t BITS_PER_BYTE { 8 };
+constexpr uint64_t BYTE_MASK { 0xFF };
+// Id, bus, vendor, product, version and keyboard type, then the two capability flags.
+constexpr size_t DEVICE_FIXED_SIZE { sizeof(int32_t) * 6 + sizeof(bool) * 2 };
+// Strings are written with their terminating null.
+constexpr size_t DEVICE_STRING_NUM { 5 };
+constexpr size_t DELTA_FIXED_SIZE { sizeof(uint64_t) * 2 + sizeof(int32_t) * 2 };
+constexpr size_t MAX_DELTA_SIZE { MAX_STREAM_BUF_SIZE - sizeof(PackHead) };
+
+// Byte order independent, so both ends of a cooperation agree on hashes.
+void HashValue(uint64_t &hash, uint64_t value)
+{
+    for (size_t index = 0; index < sizeof(value); ++index) {
+        hash ^= (value >> (index * BITS_PER_BYTE)) & BYTE_MASK;
+        hash *= FNV_PRIME;
+    }
+}
+
+void HashString(uint64_t &hash, const std::string &str)
+{
+    HashValue(hash, str.size());
+    for (const unsigned char ch : str) {
+        hash ^= ch;
+        hash *= FNV_PRIME;
+    }
+}
+
+bool IsValidCount(int32_t count)
+{
+    return (count >= 0) && (count <= MAX_INVENTORY_SIZE);
+}
+
+uint64_t ComputeDigest(const std::map<int32_t, uint64_t> &hashes)
+{
+    uint64_t digest { FNV_OFFSET_BASIS };
+    HashValue(digest, hashes.size());
+    for (const auto &[id, hash] : hashes) {
+        HashValue(digest, static_cast<uint32_t>(id));
+        HashValue(digest, hash);
+    }
+    return digest;
+}
+
+size_t GetSerializedSize(std::shared_ptr<IDevice> device)
+{
+    CHKPR(device, 0);
+    return DEVICE_FIXED_SIZE + device->GetDevPath().size() + device->GetSysPath().size() +
+        device->GetName().size() + device->GetPhys().size() + device->GetUniq().size() + DEVICE_STRING_NUM;
+}
+} // namespace
+
+InputDeviceInventory::InputDeviceInventory()
+{
+    UpdateDigest();
+}
+
+void InputDeviceInventory::Reset(const std::vector<std::shared_ptr<IDevice>> &devices)
+{
+    entries_.clear();
+    for (const auto &device : devices) {
+        CHKPC(device);
+        entries_[device->GetId()] = Entry { .hash = HashDevice(device), .device = device };
+    }
+    UpdateDigest();
+}
+
+void InputDeviceInventory::Clear()
+{
+    entries_.clear();
+    UpdateDigest();
+}
+
+uint64_t InputDeviceInventory::GetDigest() const
+{
+    return digest_;
+}
+
+size_t InputDeviceInventory::GetSize() const
+{
+    return entries_.size();
+}
+
+InputDeviceEntries InputDeviceInventory::GetEntries() const
+{
+    InputDeviceEntries entries;
+    entries.reserve(entries_.size());
+    for (const auto &[id, entry] : entries_) {
+        entries.emplace_back(id, entry.hash);
+    }
+    return entries;
+}
+
+std::vector<std::shared_ptr<IDevice>> InputDeviceInventory::GetDevices() const
+{
+    std::vector<std::shared_ptr<IDevice>> devices;
+    devices.reserve(entries_.size());
+    for (const auto &[_, entry] : entries_) {
+        devices.push_back(entry.device);
+    }
+    return devices;
+}
+
+std::vector<InputDeviceDelta> InputDeviceInventory::Diff(const InputDeviceEntries &known, uint64_t baseDigest) const
+{
+    std::map<int32_t, uint64_t> hashes(known.cbegin(), known.cend());
+    InputDeviceDelta delta { .baseDigest = baseDigest };
+    for (const auto &[id, _] : known) {
+        if (entries_.find(id) == entries_.end()) {
+            delta.removedIds.push_back(id);
+            hashes.erase(id);
+        }
+    }
+    std::vector<InputDeviceDelta> deltas;
+    size_t size = DELTA_FIXED_SIZE + delta.removedIds.size() * sizeof(int32_t);
+    for (const auto &[id, entry] : entries_) {
+        if (auto iter = hashes.find(id); (iter != hashes.end()) && (iter->second == entry.hash)) {
+            continue;
+        }
+        size_t deviceSize = GetSerializedSize(entry.device);
+        if (!delta.devices.empty() && (size + deviceSize > MAX_DELTA_SIZE)) {
+            delta.digest = ComputeDigest(hashes);
+            uint64_t nextBase = delta.digest;
+            deltas.push_back(std::move(delta));
+            delta = InputDeviceDelta { .baseDigest = nextBase };
+            size = DELTA_FIXED_SIZE;
+        }
+        delta.devices.push_back(entry.device);
+        hashes[id] = entry.hash;
+        size += deviceSize;
+    }
+    delta.digest = ComputeDigest(hashes);
+    deltas.push_back(std::move(delta));
+    return deltas;
+}
+
+int32_t InputDeviceInventory::Apply(const InputDeviceDelta &delta, std::vector<int32_t> &touchedIds)
+{
+    if (delta.baseDigest != digest_) {
+        FI_HILOGW("Delta does not apply to this inventory");
+        return RET_ERR;
+    }
+    for (auto id : delta.removedIds) {
+        if (entries_.erase(id) != 0) {
+            touchedIds.push_back(id);
+        }
+    }
+    for (const auto &device : delta.devices) {
+        CHKPC(device);
+        uint64_t hash = HashDevice(device);
+        auto [iter, inserted] = entries_.try_emplace(device->GetId(), Entry { .hash = hash, .device = device });
+        if (inserted || (iter->second.hash == hash)) {
+            continue;
+        }
+        iter->second = Entry { .hash = hash, .device = device };
+        touchedIds.push_back(device->GetId());
+    }
+    UpdateDigest();
+    if (digest_ != delta.digest) {
+        FI_HILOGW("Inventory diverged after applying delta");
+        return RET_ERR;
+    }
+    return RET_OK;
+}
+
+uint64_t InputDeviceInventory::HashDevice(std::shared_ptr<IDevice> device)
+{
+    CHKPR(device, 0);
+    uint64_t hash { FNV_OFFSET_BASIS };
+    HashString(hash, device->GetDevPath());
+    HashString(hash, device->GetSysPath());
+    HashValue(hash, static_cast<uint32_t>(device->GetBus()));
+    HashValue(hash, static_cast<uint32_t>(device->GetVendor()));
+    HashValue(hash, static_cast<uint32_t>(device->GetProduct()));
+    HashValue(hash, static_cast<uint32_t>(device->GetVersion()));
+    HashString(hash, device->GetName());
+    HashString(hash, device->GetPhys());
+    HashString(hash, device->GetUniq());
+    HashValue(hash, device->IsPointerDevice());
+    HashValue(hash, device->IsKeyboard());
+    HashValue(hash, static_cast<uint32_t>(device->GetKeyboardType()));
+    return hash;
+}
+
+int32_t InputDeviceInventory::SerializeDevice(std::shared_ptr<IDevice> device, NetPacket &packet)
+{
+    CHKPR(device, RET_ERR);
+    packet << device->GetId() << device->GetDevPath() << device->GetSysPath() << device->GetBus() <<
+    device->GetVendor() << device->GetProduct() << device->GetVersion() << device->GetName() <<
+    device->GetPhys() << device->GetUniq() << device->IsPointerDevice()  << device->IsKeyboard() <<
+    static_cast<int32_t> (device->GetKeyboardType());
+    if (packet.ChkRWError()) {
+        FI_HILOGE("Write packet failed");
+        return RET_ERR;
+    }
+    return RET_OK;
+}
+
+int32_t InputDeviceInventory::DeserializeDevice(std::shared_ptr<IDevice> device, NetPacket &packet)
+{
+    CHKPR(device, RET_ERR);
+    int32_t data;
+    std::string str;
+    packet >> data;
+    device->SetId(data);
+    packet >> str;
+    device->SetDevPath(str);
+    packet >> str;
+    device->SetSysPath(str);
+    packet >> data;
+    device->SetBus(data);
+    packet >> data;
+    device->SetVendor(data);
+    packet >> data;
+    device->SetProduct(data);
+    packet >> data;
+    device->SetVersion(data);
+    packet >> str;
+    device->SetName(str);
+    packet >> str;
+    device->SetPhys(str);
+    packet >> str;
+    device->SetUniq(str);
+    bool isPointerDevice { false };
+    packet >> isPointerDevice;
+    if (isPointerDevice) {
+        device->AddCapability(IDevice::Capability::DEVICE_CAP_POINTER);
+    }
+    bool isKeyboard { false };
+    packet >> isKeyboard;
+    if (isKeyboard) {
+        device->AddCapability(IDevice::Capability::DEVICE_CAP_KEYBOARD);
+    }
+    int32_t keyboardType { static_cast<int32_t> (IDevice::KeyboardType::KEYBOARD_TYPE_NONE) };
+    packet >> keyboardType;
+    device->SetKeyboardType(static_cast<IDevice::KeyboardType>(keyboardType));
+    if (packet.ChkRWError()) {
+        FI_HILOGE("Packet read type failed");
+        return RET_ERR;
+    }
+    return RET_OK;
+}
+
+int32_t InputDeviceInventory::WriteEntries(uint64_t digest, const InputDeviceEntries &entries, NetPacket &packet)
+{
+    packet << digest << static_cast<int32_t>(entries.size());
+    for (const auto &[id, hash] : entries) {
+        packet << id << hash;
+    }
+    if (packet.ChkRWError()) {
+        FI_HILOGE("Write packet failed");
+        return RET_ERR;
+    }
+    return RET_OK;
+}
+
+int32_t InputDeviceInventory::ReadEntries(NetPacket &packet, uint64_t &digest, InputDeviceEntries &entries)
+{
+    int32_t num { -1 };
+    packet >> digest >> num;
+    if (packet.ChkRWError() || !IsValidCount(num)) {
+        FI_HILOGE("Invalid entries, num:%{public}d", num);
+        return RET_ERR;
+    }
+    entries.clear();
+    entries.reserve(num);
+    for (int32_t index = 0; index < num; ++index) {
+        int32_t id { -1 };
+        uint64_t hash { 0 };
+        packet >> id >> hash;
+        entries.emplace_back(id, hash);
+    }
+    if (packet.ChkRWError()) {
+        FI_HILOGE("Packet read entries failed");
+        return RET_ERR;
+    }
+    return RET_OK;
+}
+
+int32_t InputDeviceInventory::WriteDelta(const InputDeviceDelta &delta, NetPacket &packet)
+{
+    packet << delta.baseDigest << delta.digest << static_cast<int32_t>(delta.devices.size());
+    for (const auto &device : delta.devices) {
+        if (SerializeDevice(device, packet) != RET_OK) {
+            return RET_ERR;
+        }
+    }
+    packet << static_cast<int32_t>(delta.removedIds.size());
+    for (auto id : delta.removedIds) {
+        packet << id;
+    }
+    if (packet.ChkRWError()) {
+        FI_HILOGE("Write packet failed");
+        return RET_ERR;
+    }
+    return RET_OK;
+}
+
+int32_t InputDeviceInventory::ReadDelta(NetPacket &packet, InputDeviceDelta &delta)
+{
+    int32_t devNum { -1 };
+    packet >> delta.baseDigest >> delta.digest >> devNum;
+    if (packet.ChkRWError() || !IsValidCount(devNum)) {
+        FI_HILOGE("Invalid devNum:%{public}d", devNum);
+        return RET_ERR;
+    }
+    delta.devices.clear();
+    for (int32_t index = 0; index < devNum; ++index) {
+        auto device = std::make_shared<Device>(INVALID_DEVICE_ID);
+        if (DeserializeDevice(device, packet) != RET_OK) {
+            return RET_ERR;
+        }
+        delta.devices.push_back(device);
+    }
+    int32_t removedNum { -1 };
+    packet >> removedNum;
+    if (packet.ChkRWError() || !IsValidCount(removedNum)) {
+        FI_HILOGE("Invalid removedNum:%{public}d", removedNum);
+        return RET_ERR;
+    }
+    delta.removedIds.resize(removedNum);
+    for (auto &id : delta.removedIds) {
+        packet >> id;
+    }
+    if (packet.ChkRWError()) {
+        FI_HILOGE("Packet read removed ids failed");
+        return RET_ERR;
+    }
+    return RET_OK;
+}
+
+void InputDeviceInventory::UpdateDigest()
+{
+    std::map<int32_t, uint64_t> hashes;
+    for (const auto &[id, entry] : entries_) {
+        hashes.emplace_hint(hashes.end(), id, entry.hash);
+    }
+    digest_ = ComputeDigest(hashes);
+}
+} // namespace Cooperate
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
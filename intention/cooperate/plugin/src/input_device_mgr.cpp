@@ -15,6 +15,8 @@
 
 #include "input_device_mgr.h"
 
+#include <algorithm>
+
 #include "device.h"
 #include "devicestatus_define.h"
 #include "utility.h"
@@ -27,6 +29,7 @@ namespace Msdp {
 namespace DeviceStatus {
 namespace Cooperate {
 constexpr size_t MAX_INPUT_DEV_PER_DEVICE { 10 };
+constexpr size_t MAX_CACHED_INVENTORIES { 8 };
 namespace {
 const std::string VIRTUAL_TRACK_PAD_NAME { "VirtualTrackpad" }; // defined in multimodalinput
 }
@@ -56,27 +59,196 @@ void InputDeviceMgr::Disable()
 void InputDeviceMgr::OnSoftbusSessionOpened(const DSoftbusSessionOpened &notice)
 {
     CALL_INFO_TRACE;
+    openPeers_[notice.networkId] = false;
     NotifyInputDeviceToRemote(notice.networkId);
 }
 
 void InputDeviceMgr::OnSoftbusSessionClosed(const DSoftbusSessionClosed &notice)
 {
     CALL_INFO_TRACE;
+    openPeers_.erase(notice.networkId);
+    pendingPulls_.erase(notice.networkId);
     RemoveAllRemoteInputDevice(notice.networkId);
 }
 
 void InputDeviceMgr::OnLocalHotPlug(const InputHotplugEvent &notice)
 {
     CALL_INFO_TRACE;
-    BroadcastHotPlugToRemote(notice);
+    BroadcastHotPlugToRemote({ notice });
+}
+
+void InputDeviceMgr::OnLocalHotPlug(const InputHotplugBatchEvent &batch)
+{
+    CALL_INFO_TRACE;
+    if (batch.changes.empty()) {
+        return;
+    }
+    FI_HILOGI("Hotplug batch of %{public}zu changes", batch.changes.size());
+    BroadcastHotPlugToRemote(batch.changes);
 }
 
 void InputDeviceMgr::OnRemoteInputDevice(const DSoftbusSyncInputDevice &notice)
 {
     CALL_INFO_TRACE;
-    std::string networkId = notice.networkId;
-    for (const auto &device : notice.devices) {
-        DispDeviceInfo(device);
+    if (notice.type != InputDevSyncType::FULL) {
+        MarkDigestPeer(notice.networkId);
+    }
+    switch (notice.type) {
+        case InputDevSyncType::FULL: {
+            OnRemoteInputDeviceFull(notice);
+            break;
+        }
+        case InputDevSyncType::DIGEST: {
+            OnRemoteInputDeviceDigest(notice);
+            break;
+        }
+        case InputDevSyncType::PULL: {
+            OnRemoteInputDevicePull(notice);
+            break;
+        }
+        case InputDevSyncType::DELTA: {
+            OnRemoteInputDeviceDelta(notice);
+            break;
+        }
+        default: {
+            FI_HILOGE("Unknown sync type:%{public}d", static_cast<int32_t>(notice.type));
+            break;
+        }
+    }
+}
+
+void InputDeviceMgr::MarkDigestPeer(const std::string &networkId)
+{
+    if (digestPeers_.insert(networkId).second) {
+        FI_HILOGI("Peer %{public}s takes input device digests", Utility::Anonymize(networkId).c_str());
+    }
+    if (auto iter = openPeers_.find(networkId); iter != openPeers_.end()) {
+        iter->second = true;
+    }
+}
+
+void InputDeviceMgr::OnRemoteInputDeviceFull(const DSoftbusSyncInputDevice &notice)
+{
+    CALL_INFO_TRACE;
+    // Peers taking digests send one ahead of any full list, so this one runs the old protocol. If it was
+    // taken for a digest peer, it got only the digest on session open and still needs the full list.
+    if (auto iter = openPeers_.find(notice.networkId); (iter != openPeers_.end()) && !iter->second &&
+        (digestPeers_.erase(notice.networkId) > 0)) {
+        FI_HILOGI("Peer %{public}s no longer takes digests", Utility::Anonymize(notice.networkId).c_str());
+        NotifyFullInputDeviceToRemote(notice.networkId);
+    }
+    InputDeviceInventory incoming;
+    incoming.Reset(notice.devices);
+    auto &inventory = GetRemoteInventory(notice.networkId);
+    std::vector<int32_t> touchedIds;
+    for (const auto &delta : incoming.Diff(inventory.GetEntries(), inventory.GetDigest())) {
+        inventory.Apply(delta, touchedIds);
+    }
+    RefreshRemoteInputDevice(notice.networkId, touchedIds);
+}
+
+void InputDeviceMgr::OnRemoteInputDeviceDigest(const DSoftbusSyncInputDevice &notice)
+{
+    CALL_INFO_TRACE;
+    if (auto iter = remoteInventories_.find(notice.networkId);
+        (iter != remoteInventories_.end()) && (iter->second.GetDigest() == notice.digest)) {
+        FI_HILOGI("Input devices of %{public}s unchanged, restore %{public}zu from cache",
+            Utility::Anonymize(notice.networkId).c_str(), iter->second.GetSize());
+        RefreshRemoteInputDevice(notice.networkId, {});
+        return;
+    }
+    pendingPulls_.erase(notice.networkId);
+    PullRemoteInputDevice(notice.networkId);
+}
+
+void InputDeviceMgr::OnRemoteInputDevicePull(const DSoftbusSyncInputDevice &notice)
+{
+    CALL_INFO_TRACE;
+    CHKPV(env_);
+    for (const auto &delta : localInventory_.Diff(notice.entries, notice.baseDigest)) {
+        NetPacket packet(MessageId::DSOFTBUS_INPUT_DEV_DELTA);
+        if (InputDeviceInventory::WriteDelta(delta, packet) != RET_OK) {
+            FI_HILOGE("WriteDelta failed");
+            return;
+        }
+        FI_HILOGI("Send %{public}zu devices, %{public}zu removed to %{public}s", delta.devices.size(),
+            delta.removedIds.size(), Utility::Anonymize(notice.networkId).c_str());
+        if (int32_t ret = env_->GetDSoftbus().SendPacket(notice.networkId, packet); ret != RET_OK) {
+            FI_HILOGE("SendPacket failed, ret:%{public}d", ret);
+            return;
+        }
+    }
+}
+
+void InputDeviceMgr::OnRemoteInputDeviceDelta(const DSoftbusSyncInputDevice &notice)
+{
+    CALL_INFO_TRACE;
+    InputDeviceDelta delta {
+        .baseDigest = notice.baseDigest,
+        .digest = notice.digest,
+        .devices = notice.devices,
+        .removedIds = notice.removedIds,
+    };
+    auto &inventory = GetRemoteInventory(notice.networkId);
+    std::vector<int32_t> touchedIds;
+    int32_t ret = inventory.Apply(delta, touchedIds);
+    RefreshRemoteInputDevice(notice.networkId, touchedIds);
+    if (ret == RET_OK) {
+        pendingPulls_.erase(notice.networkId);
+        return;
+    }
+    FI_HILOGW("Out of sync with %{public}s", Utility::Anonymize(notice.networkId).c_str());
+    PullRemoteInputDevice(notice.networkId);
+}
+
+void InputDeviceMgr::PullRemoteInputDevice(const std::string &networkId)
+{
+    CALL_INFO_TRACE;
+    CHKPV(env_);
+    if (!pendingPulls_.insert(networkId).second) {
+        FI_HILOGD("Pull from %{public}s in progress", Utility::Anonymize(networkId).c_str());
+        return;
+    }
+    auto &inventory = GetRemoteInventory(networkId);
+    NetPacket packet(MessageId::DSOFTBUS_INPUT_DEV_PULL);
+    if (InputDeviceInventory::WriteEntries(inventory.GetDigest(), inventory.GetEntries(), packet) != RET_OK) {
+        FI_HILOGE("WriteEntries failed");
+        return;
+    }
+    if (int32_t ret = env_->GetDSoftbus().SendPacket(networkId, packet); ret != RET_OK) {
+        FI_HILOGE("SendPacket to networkId:%{public}s failed, ret:%{public}d",
+            Utility::Anonymize(networkId).c_str(), ret);
+        pendingPulls_.erase(networkId);
+    }
+}
+
+InputDeviceInventory& InputDeviceMgr::GetRemoteInventory(const std::string &networkId)
+{
+    if (auto iter = remoteInventories_.find(networkId); iter != remoteInventories_.end()) {
+        return iter->second;
+    }
+    if (remoteInventories_.size() >= MAX_CACHED_INVENTORIES) {
+        auto iter = std::find_if(remoteInventories_.begin(), remoteInventories_.end(), [this](const auto &elem) {
+            return (remoteDevices_.find(elem.first) == remoteDevices_.end());
+        });
+        if (iter != remoteInventories_.end()) {
+            FI_HILOGI("Evict input devices of %{public}s", Utility::Anonymize(iter->first).c_str());
+            remoteInventories_.erase(iter);
+        }
+    }
+    return remoteInventories_[networkId];
+}
+
+void InputDeviceMgr::RefreshRemoteInputDevice(const std::string &networkId, const std::vector<int32_t> &touchedIds)
+{
+    CALL_INFO_TRACE;
+    for (auto remoteDeviceId : touchedIds) {
+        if (remote2VirtualIds_.find(remoteDeviceId) != remote2VirtualIds_.end()) {
+            RemoveVirtualInputDevice(networkId, remoteDeviceId);
+        }
+    }
+    remoteDevices_[networkId].clear();
+    for (const auto &device : GetRemoteInventory(networkId).GetDevices()) {
         AddRemoteInputDevice(networkId, device);
     }
 }
@@ -139,51 +311,110 @@ void InputDeviceMgr::NotifyInputDeviceToRemote(const std::string &remoteNetworkI
 {
     CALL_INFO_TRACE;
     CHKPV(env_);
-    auto virTrackPads = env_->GetDeviceManager().GetVirTrackPad();
-    if ((virTrackPads.size() == 0) &&
+    if ((env_->GetDeviceManager().GetVirTrackPad().size() == 0) &&
         (!env_->GetDeviceManager().HasKeyboard() && !env_->GetDeviceManager().HasLocalPointerDevice())) {
         FI_HILOGE("Local device have no keyboard or pointer device, skip");
         return;
     }
-    auto keyboards = env_->GetDeviceManager().GetKeyboard();
-    auto pointerDevices =  env_->GetDeviceManager().GetPointerDevice();
+    localInventory_.Reset(GetLocalInputDevices());
+    // The digest also tells the peer this side takes digests. Peers on the old protocol drop it.
+    NetPacket packet(MessageId::DSOFTBUS_INPUT_DEV_DIGEST);
+    packet << localInventory_.GetDigest();
+    if (packet.ChkRWError()) {
+        FI_HILOGE("Write packet failed");
+        return;
+    }
+    if (int32_t ret = env_->GetDSoftbus().SendPacket(remoteNetworkId, packet); ret != RET_OK) {
+        FI_HILOGE("SenPacket to networkId:%{public}s failed, ret:%{public}d",
+            Utility::Anonymize(remoteNetworkId).c_str(), ret);
+        return;
+    }
+    FI_HILOGI("NotifyInputDeviceToRemote networkId:%{public}s, num:%{public}zu",
+        Utility::Anonymize(remoteNetworkId).c_str(), localInventory_.GetSize());
+    if (digestPeers_.find(remoteNetworkId) == digestPeers_.end()) {
+        NotifyFullInputDeviceToRemote(remoteNetworkId);
+    }
+}
+
+void InputDeviceMgr::NotifyFullInputDeviceToRemote(const std::string &remoteNetworkId)
+{
+    CALL_INFO_TRACE;
+    CHKPV(env_);
+    auto devices = localInventory_.GetDevices();
     NetPacket packet(MessageId::DSOFTBUS_INPUT_DEV_SYNC);
+    packet << static_cast<int32_t>(devices.size());
+    for (const auto &device : devices) {
+        if (SerializeDevice(device, packet) != RET_OK) {
+            FI_HILOGE("Serialize device failed");
+            return;
+        }
+        DispDeviceInfo(device);
+    }
+    if (int32_t ret = env_->GetDSoftbus().SendPacket(remoteNetworkId, packet); ret != RET_OK) {
+        FI_HILOGE("SenPacket to networkId:%{public}s failed, ret:%{public}d",
+            Utility::Anonymize(remoteNetworkId).c_str(), ret);
+        return;
+    }
+    FI_HILOGI("Full input device list sent to networkId:%{public}s, num:%{public}zu",
+        Utility::Anonymize(remoteNetworkId).c_str(), devices.size());
+}
+
+std::vector<std::shared_ptr<IDevice>> InputDeviceMgr::GetLocalInputDevices()
+{
+    CALL_DEBUG_ENTER;
+    CHKPR(env_, {});
+    auto keyboards = env_->GetDeviceManager().GetKeyboard();
+    auto pointerDevices = env_->GetDeviceManager().GetPointerDevice();
+    auto virTrackPads = env_->GetDeviceManager().GetVirTrackPad();
     FI_HILOGI("Num: keyboard:%{public}zu, pointerDevice:%{public}zu, virTrackPads:%{public}zu",
         keyboards.size(), pointerDevices.size(), virTrackPads.size());
-    int32_t inputDeviceNum = static_cast<int32_t>(keyboards.size() + pointerDevices.size() + virTrackPads.size());
-    packet << inputDeviceNum;
-    for (const auto &keyboard : keyboards) {
-        if (SerializeDevice(keyboard, packet) != RET_OK) {
-            FI_HILOGE("Serialize keyboard failed");
-            return;
+    std::vector<std::shared_ptr<IDevice>> devices;
+    devices.reserve(keyboards.size() + pointerDevices.size() + virTrackPads.size());
+    devices.insert(devices.end(), keyboards.begin(), keyboards.end());
+    devices.insert(devices.end(), pointerDevices.begin(), pointerDevices.end());
+    devices.insert(devices.end(), virTrackPads.begin(), virTrackPads.end());
+    return devices;
+}
+
+void InputDeviceMgr::BroadcastHotPlugToRemote(const std::vector<InputHotplugEvent> &changes)
+{
+    CALL_INFO_TRACE;
+    CHKPV(env_);
+    std::vector<std::string> digestPeers;
+    for (const auto &[networkId, _] : openPeers_) {
+        if (digestPeers_.find(networkId) != digestPeers_.end()) {
+            digestPeers.push_back(networkId);
+            continue;
+        }
+        for (const auto &notice : changes) {
+            SendHotPlugToLegacyRemote(networkId, notice);
         }
-        DispDeviceInfo(keyboard);
     }
-    for (const auto &pointerDevice : pointerDevices) {
-        if (SerializeDevice(pointerDevice, packet) != RET_OK) {
-            FI_HILOGE("Serialize pointer device failed");
+    // The inventory is read after the changes settled, so one delta covers all of them.
+    InputDeviceInventory current;
+    current.Reset(GetLocalInputDevices());
+    if (current.GetDigest() == localInventory_.GetDigest()) {
+        FI_HILOGI("Advertised input devices unchanged, skip");
+        return;
+    }
+    auto deltas = current.Diff(localInventory_.GetEntries(), localInventory_.GetDigest());
+    localInventory_ = std::move(current);
+    for (const auto &delta : deltas) {
+        NetPacket packet(MessageId::DSOFTBUS_INPUT_DEV_DELTA);
+        if (InputDeviceInventory::WriteDelta(delta, packet) != RET_OK) {
+            FI_HILOGE("WriteDelta failed");
             return;
         }
-        DispDeviceInfo(pointerDevice);
-    }
-    if (virTrackPads.size() > 0) {
-        for (const auto &virTrackPad : virTrackPads) {
-            if (SerializeDevice(virTrackPad, packet) != RET_OK) {
-                FI_HILOGE("Serialize virTrackPad failed");
-                return;
+        for (const auto &networkId : digestPeers) {
+            if (int32_t ret = env_->GetDSoftbus().SendPacket(networkId, packet); ret != RET_OK) {
+                FI_HILOGE("SendPacket to networkId:%{public}s failed, ret:%{public}d",
+                    Utility::Anonymize(networkId).c_str(), ret);
             }
-            DispDeviceInfo(virTrackPad);
         }
     }
-    if (int32_t ret = env_->GetDSoftbus().SendPacket(remoteNetworkId, packet); ret != RET_OK) {
-        FI_HILOGE("SenPacket to networkId:%{public}s failed, ret:%{public}d",
-            Utility::Anonymize(remoteNetworkId).c_str(), ret);
-        return;
-    }
-    FI_HILOGI("NotifyInputDeviceToRemote networkId:%{public}s", Utility::Anonymize(remoteNetworkId).c_str());
 }
 
-void InputDeviceMgr::BroadcastHotPlugToRemote(const InputHotplugEvent &notice)
+void InputDeviceMgr::SendHotPlugToLegacyRemote(const std::string &networkId, const InputHotplugEvent &notice)
 {
     CALL_INFO_TRACE;
     CHKPV(env_);
@@ -210,9 +441,9 @@ void InputDeviceMgr::BroadcastHotPlugToRemote(const InputHotplugEvent &notice)
             return;
         }
     }
-    if (int32_t ret = env_->GetDSoftbus().BroadcastPacket(packet); ret != RET_OK) {
-        FI_HILOGE("BroadcastPacket failed");
-        return;
+    if (int32_t ret = env_->GetDSoftbus().SendPacket(networkId, packet); ret != RET_OK) {
+        FI_HILOGE("SendPacket to networkId:%{public}s failed, ret:%{public}d",
+            Utility::Anonymize(networkId).c_str(), ret);
     }
 }
 
@@ -287,16 +518,7 @@ void InputDeviceMgr::DumpRemoteInputDevice(const std::string &networkId)
 int32_t InputDeviceMgr::SerializeDevice(std::shared_ptr<IDevice> device, NetPacket &packet)
 {
     CALL_INFO_TRACE;
-    CHKPR(device, RET_ERR);
-    packet << device->GetId() << device->GetDevPath() << device->GetSysPath() << device->GetBus() <<
-    device->GetVendor() << device->GetProduct() << device->GetVersion() << device->GetName() <<
-    device->GetPhys() << device->GetUniq() << device->IsPointerDevice()  << device->IsKeyboard() <<
-    static_cast<int32_t> (device->GetKeyboardType());
-    if (packet.ChkRWError()) {
-        FI_HILOGE("Write packet failed");
-        return RET_ERR;
-    }
-    return RET_OK;
+    return InputDeviceInventory::SerializeDevice(device, packet);
 }
 
 std::shared_ptr<MMI::InputDevice> InputDeviceMgr::Transform(std::shared_ptr<IDevice> device)
@@ -22,6 +22,7 @@
 
 #include "cooperate_context.h"
 #include "cooperate_hisysevent.h"
+#include "cooperate_radar_reporter.h"
 #include "devicestatus_define.h"
 #include "input_event_transmission/input_event_serialization.h"
 #include "utility.h"
@@ -46,8 +47,6 @@ const int32_t UPPER_SCENE_FPS { 0 };
 const int32_t UPPER_SCENE_BW { 0 };
 const int32_t MODE_ENABLE { 0 };
 const int32_t MODE_DISABLE { 1 };
-const int32_t DRIVE_INTERCEPTOR_LATENCY { 5 };
-const int32_t INTERCEPTOR_TRANSMISSION_LATENCY { 20 };
 const std::string LOW_LATENCY_KEY = "identity";
 }
 
@@ -83,6 +82,8 @@ void InputEventBuilder::Enable(Context &context)
     localNetworkId_ = context.Local();
     pointerSpeed_ = context.GetPointerSpeed();
     touchPadSpeed_ = context.GetTouchPadSpeed();
+    CooperateRadarReporter::GetInstance().BeginLatencySession(
+        localNetworkId_, remoteNetworkId_, pointerSpeed_, touchPadSpeed_);
     env_->GetDSoftbus().AddObserver(observer_);
     Coordinate cursorPos = context.CursorPosition();
     TurnOffChannelScan();
@@ -100,7 +101,7 @@ void InputEventBuilder::Enable(Context &context)
             .localNetId = Utility::DFXRadarAnonymize(context.Local().c_str()),
             .peerNetId = Utility::DFXRadarAnonymize(remoteNetworkId_.c_str())
         };
-        CooperateRadar::ReportCooperateRadarInfo(radarInfo);
+        CooperateRadarReporter::GetInstance().Report(radarInfo);
     }
     ExecuteInner();
 }
@@ -126,6 +127,8 @@ void InputEventBuilder::Disable()
 void InputEventBuilder::Update(Context &context)
 {
     remoteNetworkId_ = context.Peer();
+    CooperateRadarReporter::GetInstance().BeginLatencySession(
+        localNetworkId_, remoteNetworkId_, pointerSpeed_, touchPadSpeed_);
     FI_HILOGI("Update peer to \'%{public}s\'", Utility::Anonymize(remoteNetworkId_).c_str());
 }
 
@@ -278,29 +281,10 @@ void InputEventBuilder::CheckLatency(int64_t curDriveActionTime, int64_t curInte
     preDriveEventTime_ = curDriveActionTime;
     preInterceptorTime_ = curInterceptorTime;
     preCrossPlatformTime_ = curCrossPlatformTime;
-    TransmissionLatencyRadarInfo radarInfo {
-        .funcName = __FUNCTION__,
-        .bizState = static_cast<int32_t> (BizState::STATE_END),
-        .bizStage = static_cast<int32_t> (BizCooperateStage::STAGE_CLIENT_ON_MESSAGE_RCVD),
-        .stageRes = static_cast<int32_t> (BizCooperateStageRes::RES_IDLE),
-        .bizScene = static_cast<int32_t> (BizCooperateScene::SCENE_ACTIVE),
-        .localNetId = Utility::DFXRadarAnonymize(localNetworkId_.c_str()),
-        .peerNetId = Utility::DFXRadarAnonymize(remoteNetworkId_.c_str()),
-    };
-    int64_t DriveToInterceptorDT = Utility::GetSysClockTimeMilli(cooperateInterceptorTimeDT_ - driveEventTimeDT_);
-    int64_t InterceptorToCrossDT = std::abs(Utility::GetSysClockTimeMilli(
+    int64_t driveToInterceptorDT = Utility::GetSysClockTimeMilli(cooperateInterceptorTimeDT_ - driveEventTimeDT_);
+    int64_t interceptorToCrossDT = std::abs(Utility::GetSysClockTimeMilli(
         crossPlatformTimeDT_ - cooperateInterceptorTimeDT_));
-    if (DriveToInterceptorDT > DRIVE_INTERCEPTOR_LATENCY || InterceptorToCrossDT > INTERCEPTOR_TRANSMISSION_LATENCY) {
-        FI_HILOGI("driveEventTimeDT:%{public}" PRId64 ", cooperateInterceptorTimeDT:%{public}" PRId64 ""
-            "crossPlatformTimeDT:%{public}" PRId64, driveEventTimeDT_, cooperateInterceptorTimeDT_,
-            crossPlatformTimeDT_);
-        radarInfo.driveEventTimeDT = driveEventTimeDT_;
-        radarInfo.cooperateInterceptorTimeDT = cooperateInterceptorTimeDT_;
-        radarInfo.crossPlatformTimeDT = crossPlatformTimeDT_;
-        radarInfo.pointerSpeed = pointerSpeed_;
-        radarInfo.touchPadSpeed = touchPadSpeed_;
-        CooperateRadar::ReportTransmissionLatencyRadarInfo(radarInfo);
-    }
+    CooperateRadarReporter::GetInstance().RecordLatency(driveToInterceptorDT, interceptorToCrossDT);
 }
 
 void InputEventBuilder::OnNotifyCrossDrag(std::shared_ptr<MMI::PointerEvent> pointerEvent)
@@ -25,6 +25,7 @@
 #include "cooperate_hisysevent.h"
 #include "cooperate_in.h"
 #include "cooperate_out.h"
+#include "cooperate_radar_reporter.h"
 #include "devicestatus_define.h"
 #include "devicestatus_errors.h"
 #include "event_manager.h"
@@ -170,6 +171,10 @@ StateMachine::StateMachine(IContext *env)
         [this](Context &context, const CooperateEvent &event) {
             this->OnHotPlugEvent(context, event);
     });
+    AddHandler(CooperateEventType::INPUT_HOTPLUG_BATCH_EVENT,
+        [this](Context &context, const CooperateEvent &event) {
+            this->OnHotPlugBatchEvent(context, event);
+    });
     AddHandler(CooperateEventType::DSOFTBUS_INPUT_DEV_HOT_PLUG,
         [this](Context &context, const CooperateEvent &event) {
             this->OnRemoteHotPlug(context, event);
@@ -312,6 +317,7 @@ void StateMachine::DisableCooperate(Context &context, const CooperateEvent &even
     DisableCooperateEvent disableEvent = std::get<DisableCooperateEvent>(event.event);
     context.DisableCooperate(disableEvent);
     context.eventMgr_.DisableCooperate(disableEvent);
+    context.hotArea_.DisableCooperate(disableEvent);
     context.commonEvent_.RemoveObserver(observer_);
     context.inputDevMgr_.RemoveAllVirtualInputDevice();
     RemoveSessionObserver(context, disableEvent);
@@ -342,7 +348,7 @@ void StateMachine::StartCooperate(Context &context, const CooperateEvent &event)
             .localNetId = Utility::DFXRadarAnonymize(context.Local().c_str()),
             .peerNetId = Utility::DFXRadarAnonymize(startEvent.remoteNetworkId.c_str())
         };
-        CooperateRadar::ReportCooperateRadarInfo(radarInfo);
+        CooperateRadarReporter::GetInstance().Report(radarInfo);
         return;
     }
     UpdateApplicationStateObserver(startEvent.pid);
@@ -360,7 +366,7 @@ void StateMachine::StartCooperate(Context &context, const CooperateEvent &event)
             .localNetId = Utility::DFXRadarAnonymize(context.Local().c_str()),
             .peerNetId = Utility::DFXRadarAnonymize(startEvent.remoteNetworkId.c_str())
         };
-        CooperateRadar::ReportCooperateRadarInfo(radarInfo);
+        CooperateRadarReporter::GetInstance().Report(radarInfo);
         return;
     }
     startEvent.errCode->set_value(RET_OK);
@@ -395,7 +401,7 @@ void StateMachine::StartCooperateWithOptions(Context &context, const CooperateEv
             .localNetId = Utility::DFXRadarAnonymize(context.Local().c_str()),
             .peerNetId = Utility::DFXRadarAnonymize(withOptionsEvent.remoteNetworkId.c_str())
         };
-        CooperateRadar::ReportCooperateRadarInfo(radarInfo);
+        CooperateRadarReporter::GetInstance().Report(radarInfo);
         return;
     }
     UpdateApplicationStateObserver(withOptionsEvent.pid);
@@ -413,7 +419,7 @@ void StateMachine::StartCooperateWithOptions(Context &context, const CooperateEv
             .localNetId = Utility::DFXRadarAnonymize(context.Local().c_str()),
             .peerNetId = Utility::DFXRadarAnonymize(withOptionsEvent.remoteNetworkId.c_str())
         };
-        CooperateRadar::ReportCooperateRadarInfo(radarInfo);
+        CooperateRadarReporter::GetInstance().Report(radarInfo);
         return;
     }
     withOptionsEvent.errCode->set_value(RET_OK);
@@ -528,6 +534,16 @@ void StateMachine::OnHotPlugEvent(Context &context, const CooperateEvent &event)
     Transfer(context, event);
 }
 
+void StateMachine::OnHotPlugBatchEvent(Context &context, const CooperateEvent &event)
+{
+    CALL_INFO_TRACE;
+    InputHotplugBatchEvent batch = std::get<InputHotplugBatchEvent>(event.event);
+    context.inputDevMgr_.OnLocalHotPlug(batch);
+    for (const auto &notice : batch.changes) {
+        Transfer(context, CooperateEvent(CooperateEventType::INPUT_HOTPLUG_EVENT, notice));
+    }
+}
+
 void StateMachine::OnRemoteInputDevice(Context &context, const CooperateEvent &event)
 {
     CALL_INFO_TRACE;
@@ -603,13 +619,13 @@ void StateMachine::OnRemoteStart(Context &context, const CooperateEvent &event)
         radarInfo.bizStage = static_cast<int32_t> (BizCooperateStage::STAGE_PASSIVE_CHECK_SAME_ACCOUNT);
         radarInfo.stageRes = static_cast<int32_t> (BizCooperateStageRes::RES_FAIL);
         radarInfo.errCode = static_cast<int32_t> (CooperateRadarErrCode::PASSIVE_CHECK_SAME_ACCOUNT_FAILED);
-        CooperateRadar::ReportCooperateRadarInfo(radarInfo);
+        CooperateRadarReporter::GetInstance().Report(radarInfo);
     }
     if (!isCooperateEnable_) {
         radarInfo.bizStage = static_cast<int32_t> (BizCooperateStage::STAGE_CHECK_PEER_SWITCH);
         radarInfo.stageRes = static_cast<int32_t> (BizCooperateStageRes::RES_FAIL);
         radarInfo.errCode = static_cast<int32_t> (CooperateRadarErrCode::CHECK_PEER_SWITCH_FAILED);
-        CooperateRadar::ReportCooperateRadarInfo(radarInfo);
+        CooperateRadarReporter::GetInstance().Report(radarInfo);
     }
     if (!checkSameAccount || !isCooperateEnable_) {
         FI_HILOGE("CheckSameAccountToLocal failed, switch is : %{public}d, unchain", isCooperateEnable_);
@@ -648,13 +664,13 @@ void StateMachine::OnRemoteStartWithOptions(Context &context, const CooperateEve
         radarInfo.bizStage = static_cast<int32_t> (BizCooperateStage::STAGE_PASSIVE_CHECK_SAME_ACCOUNT);
         radarInfo.stageRes = static_cast<int32_t> (BizCooperateStageRes::RES_FAIL);
         radarInfo.errCode = static_cast<int32_t> (CooperateRadarErrCode::PASSIVE_CHECK_SAME_ACCOUNT_FAILED);
-        CooperateRadar::ReportCooperateRadarInfo(radarInfo);
+        CooperateRadarReporter::GetInstance().Report(radarInfo);
     }
     if (!isCooperateEnable_) {
         radarInfo.bizStage = static_cast<int32_t> (BizCooperateStage::STAGE_CHECK_PEER_SWITCH);
         radarInfo.stageRes = static_cast<int32_t> (BizCooperateStageRes::RES_FAIL);
         radarInfo.errCode = static_cast<int32_t> (CooperateRadarErrCode::CHECK_PEER_SWITCH_FAILED);
-        CooperateRadar::ReportCooperateRadarInfo(radarInfo);
+        CooperateRadarReporter::GetInstance().Report(radarInfo);
     }
     if (!checkSameAccount || !isCooperateEnable_) {
         FI_HILOGE("CheckSameAccountToLocal failed, switch is : %{public}d, unchain", isCooperateEnable_);
@@ -18,10 +18,12 @@
 
 #include "nocopyable.h"
 
+#include <chrono>
 #include <set>
 
 #include "transaction/rs_transaction.h"
 
+#include "drop_bundle.h"
 #include "i_drag_listener.h"
 #include "i_hotarea_listener.h"
 #include "i_subscript_listener.h"
@@ -68,6 +70,7 @@ public:
     int32_t OnNotifyHideIcon(const StreamClient &client, NetPacket &pkt);
     int32_t OnStateChangedMessage(const StreamClient &client, NetPacket &pkt);
     int32_t OnDragStyleChangedMessage(const StreamClient &client, NetPacket &pkt);
+    int32_t OnDropBundle(const StreamClient &client, NetPacket &pkt);
     int32_t GetDragBundleInfo(DragBundleInfo &dragBundleInfo);
     int32_t SetDraggableState(bool state);
     int32_t GetAppDragSwitchState(bool &state);
@@ -80,6 +83,9 @@ public:
     int32_t GetDragAnimationType(int32_t &animationType);
 
 private:
+    bool GetDropBundle(uint32_t field, DropBundle &bundle);
+    void ClearDropBundle();
+
     mutable std::mutex mtx_;
     mutable std::mutex mtxStopDragListener_;
     std::shared_ptr<IStartDragListener> startDragListener_ { nullptr };
@@ -89,6 +95,10 @@ private:
     std::set<DragListenerPtr> dragListeners_;
     std::set<DragListenerPtr> connectedDragListeners_;
     std::set<SubscriptListenerPtr> subscriptListeners_;
+    std::mutex mtxDropBundle_;
+    DropBundle dropBundle_;
+    uint32_t dropBundleSeq_ { 0 };
+    std::chrono::steady_clock::time_point dropBundleTime_;
 };
 } // namespace DeviceStatus
 } // namespace Msdp
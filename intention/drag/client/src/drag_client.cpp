@@ -15,6 +15,8 @@
 
 #include "drag_client.h"
 
+#include <unistd.h>
+
 #include "devicestatus_define.h"
 #include "devicestatus_proto.h"
 #include "intention_client.h"
@@ -25,6 +27,10 @@
 namespace OHOS {
 namespace Msdp {
 namespace DeviceStatus {
+namespace {
+// Drop bundles are for the drop callback, and stale once the server would have given up on the drop.
+constexpr int32_t DROP_BUNDLE_TTL_MS { 3000 };
+} // namespace
 
 int32_t DragClient::StartDrag(const DragData &dragData, std::shared_ptr<IStartDragListener> listener)
 {
@@ -55,6 +61,7 @@ int32_t DragClient::StartDrag(const DragData &dragData, std::shared_ptr<IStartDr
         std::lock_guard<std::mutex> guard(mtx_);
         startDragListener_ = listener;
     }
+    ClearDropBundle();
     int32_t ret = INTENTION_CLIENT->StartDrag(dragData);
     if (ret != RET_OK) {
         FI_HILOGE("StartDrag fail");
@@ -89,6 +96,7 @@ int32_t DragClient::StopDrag(const DragDropResult &dropResult, std::shared_ptr<I
 int32_t DragClient::OnStopDragEnd(const StreamClient &client, NetPacket &pkt)
 {
     CALL_DEBUG_ENTER;
+    ClearDropBundle();
     std::lock_guard<std::mutex> guard(mtxStopDragListener_);
     if (stopDragListener_ == nullptr) {
         FI_HILOGE("stopDragListener is nullptr");
@@ -137,6 +145,11 @@ int32_t DragClient::GetDragTargetPid()
 int32_t DragClient::GetUdKey(std::string &udKey)
 {
     CALL_DEBUG_ENTER;
+    DropBundle bundle;
+    if (GetDropBundle(DROP_BUNDLE_UD_KEY, bundle)) {
+        udKey = bundle.udKey;
+        return RET_OK;
+    }
     int32_t ret = INTENTION_CLIENT->GetUdKey(udKey);
     if (ret != RET_OK) {
         FI_HILOGE("GetUdKey fail");
@@ -309,6 +322,12 @@ int32_t DragClient::RotateDragWindowSync(const std::shared_ptr<Rosen::RSTransact
 int32_t DragClient::GetDragSummary(std::map<std::string, int64_t> &summarys, bool isJsCaller)
 {
     CALL_DEBUG_ENTER;
+    // Js callers are checked for being system hap by the server.
+    DropBundle bundle;
+    if (!isJsCaller && GetDropBundle(DROP_BUNDLE_SUMMARY, bundle)) {
+        summarys = std::move(bundle.summarys);
+        return RET_OK;
+    }
     int32_t ret = INTENTION_CLIENT->GetDragSummary(summarys, isJsCaller);
     if (ret != RET_OK) {
         FI_HILOGE("GetDragSummary fail");
@@ -329,6 +348,11 @@ int32_t DragClient::GetDragAction(DragAction &dragAction)
 int32_t DragClient::GetExtraInfo(std::string &extraInfo)
 {
     CALL_DEBUG_ENTER;
+    DropBundle bundle;
+    if (GetDropBundle(DROP_BUNDLE_EXTRA_INFO, bundle)) {
+        extraInfo = std::move(bundle.extraInfo);
+        return RET_OK;
+    }
     int32_t ret = INTENTION_CLIENT->GetExtraInfo(extraInfo);
     if (ret != RET_OK) {
         FI_HILOGE("GetExtraInfo fail");
@@ -415,6 +439,11 @@ void DragClient::SetDraggableStateAsync(bool state, int64_t downTime)
 int32_t DragClient::GetDragBundleInfo(DragBundleInfo &dragBundleInfo)
 {
     CALL_DEBUG_ENTER;
+    DropBundle bundle;
+    if (GetDropBundle(DROP_BUNDLE_BUNDLE_INFO, bundle)) {
+        dragBundleInfo = std::move(bundle.bundleInfo);
+        return RET_OK;
+    }
     int32_t ret = INTENTION_CLIENT->GetDragBundleInfo(dragBundleInfo);
     if (ret != RET_OK) {
         FI_HILOGE("GetDragBundleInfo fail");
@@ -448,6 +477,8 @@ int32_t DragClient::OnNotifyResult(const StreamClient &client, NetPacket &pkt)
     }
     notifyMsg.dragBehavior = static_cast<DragBehavior>(dragBehavior);
     notifyMsg.dragAnimationType = static_cast<DragAnimationType>(dragAnimationType);
+    // The drag is over, the server no longer answers what the bundle holds.
+    ClearDropBundle();
     std::lock_guard<std::mutex> guard(mtx_);
     CHKPR(startDragListener_, RET_ERR);
     startDragListener_->OnDragEndMessage(notifyMsg);
@@ -496,6 +527,52 @@ int32_t DragClient::OnDragStyleChangedMessage(const StreamClient &client, NetPac
     return RET_OK;
 }
 
+int32_t DragClient::OnDropBundle(const StreamClient &client, NetPacket &pkt)
+{
+    CALL_DEBUG_ENTER;
+    DropBundle bundle;
+    if (DropBundlePacker::UnMarshalling(pkt, bundle) != RET_OK) {
+        FI_HILOGE("UnMarshalling drop bundle failed");
+        return RET_ERR;
+    }
+    if (bundle.targetPid != getpid()) {
+        FI_HILOGE("Drop bundle for target:%{public}d, not this process", bundle.targetPid);
+        return RET_ERR;
+    }
+    std::lock_guard<std::mutex> guard(mtxDropBundle_);
+    // Sequence numbers wrap, a bundle is older if it is behind the last one seen by less than half the range.
+    if (static_cast<int32_t>(bundle.dragSeq - dropBundleSeq_) < 0) {
+        FI_HILOGW("Drop bundle of drag:%{public}u is older than drag:%{public}u", bundle.dragSeq, dropBundleSeq_);
+        return RET_ERR;
+    }
+    dropBundleSeq_ = bundle.dragSeq;
+    dropBundle_ = std::move(bundle);
+    dropBundleTime_ = std::chrono::steady_clock::now();
+    FI_HILOGI("Drop bundle of drag:%{public}u received, fields:%{public}u", dropBundleSeq_, dropBundle_.fields);
+    return RET_OK;
+}
+
+bool DragClient::GetDropBundle(uint32_t field, DropBundle &bundle)
+{
+    std::lock_guard<std::mutex> guard(mtxDropBundle_);
+    if ((dropBundle_.fields & field) == 0) {
+        return false;
+    }
+    if (std::chrono::steady_clock::now() - dropBundleTime_ > std::chrono::milliseconds(DROP_BUNDLE_TTL_MS)) {
+        FI_HILOGD("Drop bundle expired");
+        dropBundle_ = DropBundle();
+        return false;
+    }
+    bundle = dropBundle_;
+    return true;
+}
+
+void DragClient::ClearDropBundle()
+{
+    std::lock_guard<std::mutex> guard(mtxDropBundle_);
+    dropBundle_ = DropBundle();
+}
+
 void DragClient::OnConnected()
 {
     CALL_INFO_TRACE;
@@ -150,8 +150,6 @@ private:
 #ifdef DEVICE_STATUS_CAR_AWARENESS_ENABLE
     CarAwarenessClient carAwareness_;
 #endif // DEVICE_STATUS_CAR_AWARENESS_ENABLE
-    bool isScreenRotation_ { false };
-    std::vector<std::string> foldRotatePolicys_ {};
 };
 
 #define INTER_MGR_IMPL OHOS::Singleton<IntentionManager>::GetInstance()
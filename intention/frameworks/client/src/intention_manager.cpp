@@ -19,6 +19,7 @@
 
 #include "devicestatus_define.h"
 #include "drag_data.h"
+#include "rotate_policy.h"
 
 #undef LOG_TAG
 #define LOG_TAG "IntentionManager"
@@ -26,13 +27,6 @@
 namespace OHOS {
 namespace Msdp {
 namespace DeviceStatus {
-namespace {
-constexpr int32_t INDEX_FOLDED { 0 };
-constexpr int32_t INDEX_EXPAND { 1 };
-constexpr size_t POLICY_VEC_SIZE { 2 };
-const std::string SCREEN_ROTATION { "1" };
-} // namespace
-
 IntentionManager::IntentionManager()
 {
 }
@@ -60,7 +54,6 @@ void IntentionManager::InitClient()
         });
         client_->Start();
     }
-    GetRotatePolicy(isScreenRotation_, foldRotatePolicys_);
 }
 
 void IntentionManager::InitMsgHandler()
@@ -96,6 +89,9 @@ void IntentionManager::InitMsgHandler()
         }},
         {MessageId::DRAG_STOP_DRAG_END, [this](const StreamClient &client, NetPacket &pkt) {
             return this->drag_.OnStopDragEnd(client, pkt);
+        }},
+        {MessageId::DRAG_DROP_BUNDLE, [this](const StreamClient &client, NetPacket &pkt) {
+            return this->drag_.OnDropBundle(client, pkt);
         }}
     };
     CHKPV(client_);
@@ -383,37 +379,20 @@ int32_t IntentionManager::UpdatePreviewStyleWithAnimation(const PreviewStyle &pr
 int32_t IntentionManager::RotateDragWindowSync(const std::shared_ptr<Rosen::RSTransaction>& rsTransaction)
 {
     CALL_DEBUG_ENTER;
-    if (isScreenRotation_) {
+    const RotatePolicy &rotatePolicy = RotatePolicy::GetInstance();
+    if (rotatePolicy.IsScreenRotation()) {
         FI_HILOGW("Screen rotation, not need rotate drag window");
         return RET_OK;
     }
     if (Rosen::DisplayManager::GetInstance().IsFoldable()) {
-        if ((foldRotatePolicys_.empty()) || (foldRotatePolicys_.size() < POLICY_VEC_SIZE)) {
-            FI_HILOGE("foldRotatePolicys_ is invalid");
+        if (!rotatePolicy.IsFoldPolicyValid()) {
+            FI_HILOGE("foldRotatePolicys is invalid");
             return drag_.RotateDragWindowSync(rsTransaction);
         }
-        Rosen::FoldStatus foldStatus = Rosen::DisplayManager::GetInstance().GetFoldStatus();
-        if (IsSecondaryDevice()) {
-            bool isExpand = (foldStatus == Rosen::FoldStatus::EXPAND || foldStatus == Rosen::FoldStatus::HALF_FOLD ||
-                foldStatus == Rosen::FoldStatus::FOLD_STATE_EXPAND_WITH_SECOND_EXPAND ||
-                foldStatus == Rosen::FoldStatus::FOLD_STATE_EXPAND_WITH_SECOND_HALF_FOLDED ||
-                foldStatus == Rosen::FoldStatus::FOLD_STATE_HALF_FOLDED_WITH_SECOND_EXPAND ||
-                foldStatus == Rosen::FoldStatus::FOLD_STATE_HALF_FOLDED_WITH_SECOND_HALF_FOLDED);
-            bool isFold = (foldStatus == Rosen::FoldStatus::FOLDED ||
-                foldStatus == Rosen::FoldStatus::FOLD_STATE_FOLDED_WITH_SECOND_EXPAND ||
-                foldStatus == Rosen::FoldStatus::FOLD_STATE_FOLDED_WITH_SECOND_HALF_FOLDED);
-            if ((isExpand && (foldRotatePolicys_[INDEX_EXPAND] == SCREEN_ROTATION)) ||
-                (isFold && (foldRotatePolicys_[INDEX_FOLDED] == SCREEN_ROTATION))) {
-                FI_HILOGD("Secondary device Full display rotation, not need rotate drag window");
-                return RET_OK;
-            }
-        } else {
-            if ((((foldStatus == Rosen::FoldStatus::EXPAND) || (foldStatus == Rosen::FoldStatus::HALF_FOLD)) &&
-                (foldRotatePolicys_[INDEX_EXPAND] == SCREEN_ROTATION)) ||
-                ((foldStatus == Rosen::FoldStatus::FOLDED) && (foldRotatePolicys_[INDEX_FOLDED] == SCREEN_ROTATION))) {
-                FI_HILOGD("Full display rotation, not need rotate drag window");
-                return RET_OK;
-            }
+        FoldPosture posture = rotatePolicy.GetFoldPosture(Rosen::DisplayManager::GetInstance().GetFoldStatus());
+        if (rotatePolicy.IsScreenRotation(true, posture)) {
+            FI_HILOGD("Full display rotation, not need rotate drag window");
+            return RET_OK;
         }
     }
     return drag_.RotateDragWindowSync(rsTransaction);
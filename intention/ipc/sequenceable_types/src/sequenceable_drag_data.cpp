@@ -45,6 +45,10 @@ bool SequenceableDragData::Marshalling(Parcel &parcel) const
         FI_HILOGE("Marshalling dragAnimationType failed");
         return false;
     }
+    if (DragDataPacker::MarshallingStyleParams(dragData_, parcel) != RET_OK) {
+        FI_HILOGE("Marshalling styleParams failed");
+        return false;
+    }
     return true;
 }
 
@@ -82,6 +86,11 @@ SequenceableDragData* SequenceableDragData::Unmarshalling(Parcel &parcel)
         delete sequenceDragData;
         return nullptr;
     }
+    if (DragDataPacker::UnMarshallingStyleParams(parcel, sequenceDragData->dragData_) != RET_OK) {
+        FI_HILOGE("UnMarshalling styleParams failed");
+        delete sequenceDragData;
+        return nullptr;
+    }
     return sequenceDragData;
 }
 } // namespace DeviceStatus
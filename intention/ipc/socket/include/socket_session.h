@@ -16,6 +16,11 @@
 #ifndef SOCKET_SESSION_H
 #define SOCKET_SESSION_H
 
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <mutex>
+
 #include "nocopyable.h"
 
 #include "i_epoll_event_source.h"
@@ -24,6 +29,17 @@
 namespace OHOS {
 namespace Msdp {
 namespace DeviceStatus {
+struct SocketSessionStats {
+    size_t depth { 0 };
+    size_t queuedBytes { 0 };
+    size_t peakDepth { 0 };
+    uint64_t dropped { 0 };
+    uint64_t coalesced { 0 };
+    int64_t stallMs { 0 };
+};
+
+// Messages the client cannot take at once wait in a bounded queue of the session, which the
+// epoll loop drains on EPOLLOUT, so a client that stops reading never blocks its producers.
 class SocketSession final : public ISocketSession, public IEpollEventSource {
 public:
     SocketSession(const std::string &programName, int32_t moduleType,
@@ -32,6 +48,7 @@ public:
     ~SocketSession();
 
     bool SendMsg(NetPacket &pkt) const override;
+    SendResult TrySendMsg(const char *buf, size_t size) const override;
 
     int32_t GetUid() const override;
     int32_t GetPid() const override;
@@ -40,10 +57,31 @@ public:
     void SetProgramName(const std::string &programName) override;
 
     int32_t GetFd() const override;
+    uint32_t GetEvents() const override;
     void Dispatch(const struct epoll_event &ev) override;
 
+    // Writes queued messages until the socket is full again. Returns true once the queue is empty.
+    bool Flush();
+    // @watcher is called when messages start waiting for EPOLLOUT.
+    void SetWritableWatcher(std::function<void()> watcher);
+    SocketSessionStats GetStats() const;
+
 private:
-    bool SendMsg(const char *buf, size_t size) const;
+    enum class SendPolicy {
+        CRITICAL,
+        LATEST_WINS,
+    };
+
+    struct OutboundMsg {
+        MessageId msgId { MessageId::INVALID };
+        std::string data;
+        size_t offset { 0 };
+    };
+
+    static SendPolicy GetSendPolicy(MessageId msgId);
+    bool SendMsg(MessageId msgId, const char *buf, size_t size) const;
+    ssize_t Write(const char *buf, size_t size) const;
+    bool FlushLocked() const;
 
 private:
     int32_t fd_ { -1 };
@@ -51,6 +89,12 @@ private:
     int32_t pid_ { -1 };
     int32_t tokenType_ { TokenType::TOKEN_INVALID };
     std::string programName_;
+    mutable std::mutex queueMutex_;
+    mutable std::deque<OutboundMsg> queue_;
+    mutable size_t queuedBytes_ { 0 };
+    mutable SocketSessionStats stats_;
+    mutable std::chrono::steady_clock::time_point stallSince_;
+    std::function<void()> writableWatcher_;
 };
 
 inline int32_t SocketSession::GetUid() const
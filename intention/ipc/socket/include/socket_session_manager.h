@@ -51,6 +51,7 @@ public:
     void Dispatch(const struct epoll_event &ev) override;
     void RegisterApplicationState() override;
     void DeleteCollaborationServiceByName() override;
+    void Dump(int32_t fd) const override;
 
 private:
     class AppStateObserver final : public AppExecFwk::ApplicationStateObserverStub {
@@ -66,6 +67,7 @@ private:
     bool SetBufferSize(int32_t sockFd, int32_t bufSize);
     void DispatchOne();
     void OnEpollIn(IEpollEventSource &source);
+    void OnEpollOut(IEpollEventSource &source);
     void ReleaseSession(int32_t fd);
     void ReleaseSessionByPid(int32_t pid);
     std::shared_ptr<SocketSession> FindSession(int32_t fd) const;
@@ -15,8 +15,11 @@
 
 #include "socket_session.h"
 
+#include <algorithm>
 #include <sstream>
 
+#include <linux/sockios.h>
+#include <sys/ioctl.h>
 #include <sys/socket.h>
 #include <unistd.h>
 
@@ -31,6 +34,10 @@ namespace Msdp {
 namespace DeviceStatus {
 namespace {
 constexpr uint64_t DOMAIN_ID { 0xD002220 };
+// Beyond this, messages of which only the latest matters are dropped.
+constexpr size_t MAX_QUEUED_BYTES { 64 * 1024 };
+// Beyond this, even critical messages are refused and the sender told so.
+constexpr size_t MAX_CRITICAL_QUEUED_BYTES { 512 * 1024 };
 } // namespace
 
 SocketSession::SocketSession(const std::string &programName, int32_t moduleType,
@@ -58,51 +65,178 @@ bool SocketSession::SendMsg(NetPacket &pkt) const
         FI_HILOGE("Failed to buffer packet");
         return false;
     }
-    return SendMsg(buf.Data(), buf.Size());
+    return SendMsg(pkt.GetMsgId(), buf.Data(), buf.Size());
 }
 
-bool SocketSession::SendMsg(const char *buf, size_t size) const
+SocketSession::SendPolicy SocketSession::GetSendPolicy(MessageId msgId)
+{
+    switch (msgId) {
+        case MessageId::HOT_AREA_ADD_LISTENER:
+        case MessageId::DRAG_STYLE_LISTENER: {
+            return SendPolicy::LATEST_WINS;
+        }
+        default: {
+            return SendPolicy::CRITICAL;
+        }
+    }
+}
+
+bool SocketSession::SendMsg(MessageId msgId, const char *buf, size_t size) const
 {
     CHKPF(buf);
-    if ((size == 0) || (size > MAX_PACKET_BUF_SIZE)) {
-        FI_HILOGE("buf size:%{public}zu", size);
+    if ((size == 0) || (size > MAX_PACKET_BUF_SIZE) || (fd_ < 0)) {
+        FI_HILOGE("Invalid send, size:%{public}zu, fd:%{public}d", size, fd_);
         return false;
     }
-    if (fd_ < 0) {
-        FI_HILOGE("The fd_ is less than 0");
-        return false;
+    std::function<void()> watcher;
+    {
+        std::lock_guard guard(queueMutex_);
+        if (queue_.empty()) {
+            ssize_t count = Write(buf, size);
+            if (count < 0) {
+                return false;
+            }
+            if (static_cast<size_t>(count) == size) {
+                return true;
+            }
+            queue_.push_back(OutboundMsg { .msgId = msgId, .data = std::string(buf, size),
+                .offset = static_cast<size_t>(count) });
+            queuedBytes_ = size - static_cast<size_t>(count);
+            stallSince_ = std::chrono::steady_clock::now();
+            watcher = writableWatcher_;
+        } else if (GetSendPolicy(msgId) == SendPolicy::LATEST_WINS) {
+            auto iter = std::find_if(queue_.rbegin(), queue_.rend(), [msgId](const auto &msg) {
+                return ((msg.msgId == msgId) && (msg.offset == 0));
+            });
+            if (iter != queue_.rend()) {
+                queuedBytes_ = queuedBytes_ - iter->data.size() + size;
+                iter->data.assign(buf, size);
+                ++stats_.coalesced;
+                return true;
+            }
+            if (queuedBytes_ + size > MAX_QUEUED_BYTES) {
+                ++stats_.dropped;
+                FI_HILOGW("Client is not draining, dropped message(%{public}d), pid:%{public}d",
+                    static_cast<int32_t>(msgId), pid_);
+                return true;
+            }
+            queue_.push_back(OutboundMsg { .msgId = msgId, .data = std::string(buf, size) });
+            queuedBytes_ += size;
+        } else {
+            if (queuedBytes_ + size > MAX_CRITICAL_QUEUED_BYTES) {
+                FI_HILOGE("Client is not draining, refused message(%{public}d), pid:%{public}d",
+                    static_cast<int32_t>(msgId), pid_);
+                return false;
+            }
+            queue_.push_back(OutboundMsg { .msgId = msgId, .data = std::string(buf, size) });
+            queuedBytes_ += size;
+        }
+        stats_.peakDepth = std::max(stats_.peakDepth, queue_.size());
+    }
+    if (watcher) {
+        watcher();
+    }
+    return true;
+}
+
+ssize_t SocketSession::Write(const char *buf, size_t size) const
+{
+    size_t idx = 0;
+    while (idx < size) {
+        ssize_t count = send(fd_, &buf[idx], size - idx, MSG_DONTWAIT | MSG_NOSIGNAL);
+        if (count >= 0) {
+            idx += static_cast<size_t>(count);
+            continue;
+        }
+        if (errno == EINTR) {
+            continue;
+        }
+        if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
+            break;
+        }
+        FI_HILOGE("Send return failed, error:%{public}d, fd:%{public}d, pid:%{public}d", errno, fd_, pid_);
+        return -1;
     }
+    return static_cast<ssize_t>(idx);
+}
 
-    int32_t idx = 0;
-    int32_t retryCount = 0;
-    const int32_t bufSize = static_cast<int32_t>(size);
-    int32_t remSize = bufSize;
-    FI_HILOGD("Rem size:%{public}d", remSize);
-    while (remSize > 0 && retryCount < SEND_RETRY_LIMIT) {
-        retryCount += 1;
-        FI_HILOGD("Send message to client (%{public}d, %{public}d)", fd_, pid_);
-        ssize_t count = send(fd_, &buf[idx], remSize, MSG_DONTWAIT | MSG_NOSIGNAL);
+bool SocketSession::FlushLocked() const
+{
+    while (!queue_.empty()) {
+        OutboundMsg &msg = queue_.front();
+        ssize_t count = Write(msg.data.data() + msg.offset, msg.data.size() - msg.offset);
         if (count < 0) {
-            if (errno == EAGAIN || errno == EINTR || errno == EWOULDBLOCK) {
-                usleep(SEND_RETRY_SLEEP_TIME);
-                FI_HILOGW("Continue for errno EAGAIN|EINTR|EWOULDBLOCK, errno:%{public}d, pid:%{public}d", errno, pid_);
-                continue;
-            }
-            FI_HILOGE("Send return failed, error:%{public}d, fd:%{public}d, pid:%{public}d", errno, fd_, pid_);
+            stats_.dropped += queue_.size();
+            queue_.clear();
+            queuedBytes_ = 0;
+            break;
+        }
+        msg.offset += static_cast<size_t>(count);
+        queuedBytes_ -= static_cast<size_t>(count);
+        if (msg.offset < msg.data.size()) {
             return false;
         }
-        idx += count;
-        remSize -= count;
-        if (remSize > 0) {
-            usleep(SEND_RETRY_SLEEP_TIME);
+        queue_.pop_front();
+    }
+    stats_.stallMs += std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - stallSince_).count();
+    return true;
+}
+
+bool SocketSession::Flush()
+{
+    std::lock_guard guard(queueMutex_);
+    if (queue_.empty()) {
+        return true;
+    }
+    return FlushLocked();
+}
+
+void SocketSession::SetWritableWatcher(std::function<void()> watcher)
+{
+    std::lock_guard guard(queueMutex_);
+    writableWatcher_ = watcher;
+}
+
+SocketSessionStats SocketSession::GetStats() const
+{
+    std::lock_guard guard(queueMutex_);
+    SocketSessionStats stats = stats_;
+    stats.depth = queue_.size();
+    stats.queuedBytes = queuedBytes_;
+    return stats;
+}
+
+uint32_t SocketSession::GetEvents() const
+{
+    std::lock_guard guard(queueMutex_);
+    return (queue_.empty() ? IEpollEventSource::GetEvents() : (IEpollEventSource::GetEvents() | EPOLLOUT));
+}
+
+SendResult SocketSession::TrySendMsg(const char *buf, size_t size) const
+{
+    CHKPR(buf, SEND_FAILED);
+    if ((size == 0) || (size > MAX_PACKET_BUF_SIZE) || (fd_ < 0)) {
+        FI_HILOGE("Invalid send, size:%{public}zu, fd:%{public}d", size, fd_);
+        return SEND_FAILED;
+    }
+    {
+        std::lock_guard guard(queueMutex_);
+        if (!queue_.empty()) {
+            FI_HILOGW("Client is not draining, queued:%{public}zu, pid:%{public}d", queue_.size(), pid_);
+            return SEND_BACKPRESSURE;
         }
     }
-    if (retryCount >= SEND_RETRY_LIMIT || remSize != 0) {
-        FI_HILOGE("Send too many times:%{public}d/%{public}d, size:%{public}d/%{public}d, fd:%{public}d,"
-            "pid:%{public}d", retryCount, SEND_RETRY_LIMIT, idx, bufSize, fd_, pid_);
-        return false;
+    int32_t pending = 0;
+    int32_t sndBufSize = 0;
+    socklen_t optLen = sizeof(sndBufSize);
+    if ((ioctl(fd_, SIOCOUTQ, &pending) == 0) &&
+        (getsockopt(fd_, SOL_SOCKET, SO_SNDBUF, &sndBufSize, &optLen) == 0) &&
+        (static_cast<size_t>(pending) + size > static_cast<size_t>(sndBufSize))) {
+        FI_HILOGW("Client is not draining, pending:%{public}d, pid:%{public}d", pending, pid_);
+        return SEND_BACKPRESSURE;
     }
-    return true;
+    return (SendMsg(MessageId::INVALID, buf, size) ? SEND_OK : SEND_FAILED);
 }
 
 // LCOV_EXCL_START
@@ -120,6 +254,9 @@ std::string SocketSession::ToString() const
 
 void SocketSession::Dispatch(const struct epoll_event &ev)
 {
+    if ((ev.events & EPOLLOUT) == EPOLLOUT) {
+        Flush();
+    }
     if ((ev.events & EPOLLIN) == EPOLLIN) {
         FI_HILOGD("Data received (%{public}d)", fd_);
     } else if ((ev.events & (EPOLLHUP | EPOLLERR)) != 0) {
@@ -16,6 +16,8 @@
 #include "socket_session_manager.h"
 
 #include <algorithm>
+#include <cinttypes>
+#include <cstdio>
 
 #include <sys/socket.h>
 #include <unistd.h>
@@ -59,6 +61,7 @@ void SocketSessionManager::Disable()
     epollMgr_.Close();
     std::for_each(sessions_.cbegin(), sessions_.cend(), [this](const auto &item) {
         CHKPV(item.second);
+        item.second->SetWritableWatcher(nullptr);
         NotifySessionDeleted(item.second);
     });
     sessions_.clear();
@@ -178,6 +181,9 @@ void SocketSessionManager::DispatchOne()
     for (int32_t index = 0; index < cnt; ++index) {
         IEpollEventSource *source = reinterpret_cast<IEpollEventSource *>(evs[index].data.ptr);
         CHKPC(source);
+        if ((evs[index].events & EPOLLOUT) == EPOLLOUT) {
+            OnEpollOut(*source);
+        }
         if ((evs[index].events & EPOLLIN) == EPOLLIN) {
             OnEpollIn(*source);
         } else if ((evs[index].events & (EPOLLHUP | EPOLLERR)) != 0) {
@@ -216,6 +222,16 @@ void SocketSessionManager::OnEpollIn(IEpollEventSource &source)
     } while (numRead == sizeof(buf));
 }
 
+void SocketSessionManager::OnEpollOut(IEpollEventSource &source)
+{
+    CALL_DEBUG_ENTER;
+    auto session = FindSession(source.GetFd());
+    CHKPV(session);
+    if (session->Flush()) {
+        epollMgr_.Update(session);
+    }
+}
+
 void SocketSessionManager::ReleaseSession(int32_t fd)
 {
     CALL_DEBUG_ENTER;
@@ -224,6 +240,7 @@ void SocketSessionManager::ReleaseSession(int32_t fd)
         auto session = iter->second;
 
         if (session != nullptr) {
+            session->SetWritableWatcher(nullptr);
             epollMgr_.Remove(session);
             NotifySessionDeleted(session);
         }
@@ -243,6 +260,7 @@ void SocketSessionManager::DeleteCollaborationServiceByName()
     if (iter != sessions_.end()) {
         auto session = iter->second;
         if (session != nullptr) {
+            session->SetWritableWatcher(nullptr);
             epollMgr_.Remove(session);
             NotifySessionDeleted(session);
         }
@@ -262,6 +280,7 @@ void SocketSessionManager::ReleaseSessionByPid(int32_t pid)
     if (iter != sessions_.end()) {
         auto session = iter->second;
         if (session != nullptr) {
+            session->SetWritableWatcher(nullptr);
             epollMgr_.Remove(session);
             NotifySessionDeleted(session);
         }
@@ -300,6 +319,19 @@ void SocketSessionManager::DumpSession(const std::string &title) const
     }
 }
 
+void SocketSessionManager::Dump(int32_t fd) const
+{
+    std::lock_guard<std::recursive_mutex> guard(mutex_);
+    dprintf(fd, "Sessions: count=%zu\n", sessions_.size());
+    for (const auto &[_, session] : sessions_) {
+        CHKPC(session);
+        SocketSessionStats stats = session->GetStats();
+        dprintf(fd, "\tpid:%d | program:%s | depth:%zu | bytes:%zu | peak:%zu | dropped:%" PRIu64
+            " | coalesced:%" PRIu64 " | stall:%" PRId64 "ms\n", session->GetPid(), session->GetProgramName().c_str(),
+            stats.depth, stats.queuedBytes, stats.peakDepth, stats.dropped, stats.coalesced, stats.stallMs);
+    }
+}
+
 bool SocketSessionManager::AddSession(std::shared_ptr<SocketSession> session)
 {
     CALL_INFO_TRACE;
@@ -319,6 +351,13 @@ bool SocketSessionManager::AddSession(std::shared_ptr<SocketSession> session)
         sessions_.erase(iter);
         return false;
     }
+    std::weak_ptr<SocketSession> weakSession = session;
+    session->SetWritableWatcher([this, weakSession] {
+        if (auto ptr = weakSession.lock(); ptr != nullptr) {
+            std::lock_guard<std::recursive_mutex> guard(mutex_);
+            epollMgr_.Update(ptr);
+        }
+    });
     DumpSession("AddSession");
     return true;
 }
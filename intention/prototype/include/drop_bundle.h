@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DROP_BUNDLE_H
+#define DROP_BUNDLE_H
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+#include "drag_data.h"
+#include "net_packet.h"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+inline constexpr int32_t DROP_BUNDLE_VERSION { 1 };
+
+enum DropBundleField : uint32_t {
+    DROP_BUNDLE_UD_KEY = 1U << 0,
+    DROP_BUNDLE_SUMMARY = 1U << 1,
+    DROP_BUNDLE_EXTRA_INFO = 1U << 2,
+    DROP_BUNDLE_BUNDLE_INFO = 1U << 3,
+};
+
+// What a drop target usually asks for right after the drop. Pushed by the server to the target
+// on pull-up, so the target does not need a round-trip for each of them. A field is present only
+// if its bit is set in @fields; absent fields are to be asked for as before. @dragSeq numbers the
+// drag the bundle belongs to; a bundle with no fields is sent on the next drag start to drop the
+// one the target still holds.
+struct DropBundle {
+    int32_t version { DROP_BUNDLE_VERSION };
+    int32_t targetPid { -1 };
+    uint32_t dragSeq { 0 };
+    uint32_t fields { 0 };
+    std::string udKey;
+    std::map<std::string, int64_t> summarys;
+    std::string extraInfo;
+    DragBundleInfo bundleInfo;
+};
+
+class DropBundlePacker {
+public:
+    static int32_t Marshalling(const DropBundle &bundle, NetPacket &pkt);
+    static int32_t UnMarshalling(NetPacket &pkt, DropBundle &bundle);
+};
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+#endif // DROP_BUNDLE_H
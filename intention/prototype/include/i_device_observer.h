@@ -17,12 +17,18 @@
 #define I_DEVICE_OBSERVER_H
 
 #include <memory>
+#include <vector>
 
 #include "i_device.h"
 
 namespace OHOS {
 namespace Msdp {
 namespace DeviceStatus {
+struct DeviceChanges {
+    std::vector<std::shared_ptr<IDevice>> added;
+    std::vector<std::shared_ptr<IDevice>> removed;
+};
+
 class IDeviceObserver {
 public:
     IDeviceObserver() = default;
@@ -30,8 +36,21 @@ public:
 
     virtual void OnDeviceAdded(std::shared_ptr<IDevice>) = 0;
     virtual void OnDeviceRemoved(std::shared_ptr<IDevice>) = 0;
+    // One settled batch of hot-plug changes. Observers that can act on the batch as a whole override
+    // this, the others see the removals followed by the additions one by one.
+    virtual void OnDevicesChanged(const DeviceChanges &changes);
 };
 
+inline void IDeviceObserver::OnDevicesChanged(const DeviceChanges &changes)
+{
+    for (const auto &dev : changes.removed) {
+        OnDeviceRemoved(dev);
+    }
+    for (const auto &dev : changes.added) {
+        OnDeviceAdded(dev);
+    }
+}
+
 inline bool operator<(std::weak_ptr<IDeviceObserver> ptr1, std::weak_ptr<IDeviceObserver> ptr2)
 {
     return (ptr1.lock() < ptr2.lock());
@@ -43,6 +43,11 @@ public:
 
 #ifndef OHOS_BUILD_ENABLE_ARKUI_X
     virtual void Dump(int32_t fd) const = 0;
+    // Timestamps of every recorded drag frame, for offline analysis.
+    virtual void DumpFrames(int32_t fd) const = 0;
+    // Loads what the first drag would otherwise load on demand, and releases the decoded part of it.
+    virtual void WarmUp() = 0;
+    virtual void ReleaseWarmUpCache() = 0;
     virtual int32_t AddListener(int32_t pid) = 0;
     virtual int32_t RemoveListener(int32_t pid) = 0;
     virtual int32_t AddSubscriptListener(int32_t pid) = 0;
@@ -137,6 +142,7 @@ public:
 #ifndef OHOS_BUILD_ENABLE_ARKUI_X
     virtual bool RegisterPullThrowListener() = 0;
     virtual bool RegisterVKListener() = 0;
+    virtual bool GetListenedFoldStatus(Rosen::FoldStatus &foldStatus) = 0;
 #endif // OHOS_BUILD_ENABLE_ARKUI_X
 #endif // OHOS_ENABLE_PULLTHROW
 };
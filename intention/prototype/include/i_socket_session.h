@@ -32,12 +32,20 @@ enum TokenType : int32_t {
     TOKEN_SHELL
 };
 
+enum SendResult : int32_t {
+    SEND_OK = 0,
+    SEND_BACKPRESSURE,
+    SEND_FAILED
+};
+
 class ISocketSession {
 public:
     ISocketSession() = default;
     virtual ~ISocketSession() = default;
 
     virtual bool SendMsg(NetPacket &pkt) const = 0;
+    // Sends an encoded packet only if the socket buffer can take it whole, without waiting for the client.
+    virtual SendResult TrySendMsg(const char *buf, size_t size) const = 0;
 
     virtual int32_t GetUid() const = 0;
     virtual int32_t GetPid() const = 0;
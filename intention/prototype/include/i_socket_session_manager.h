@@ -33,6 +33,7 @@ public:
     virtual SocketSessionPtr FindSessionByPid(int32_t pid) const = 0;
     virtual void RegisterApplicationState() = 0;
     virtual void DeleteCollaborationServiceByName() = 0;
+    virtual void Dump(int32_t fd) const = 0;
 };
 } // namespace DeviceStatus
 } // namespace Msdp
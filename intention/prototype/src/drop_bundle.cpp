@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "drop_bundle.h"
+
+#include "devicestatus_define.h"
+
+#undef LOG_TAG
+#define LOG_TAG "DropBundle"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace {
+constexpr int32_t MAX_SUMMARY_COUNT { 200 };
+} // namespace
+
+int32_t DropBundlePacker::Marshalling(const DropBundle &bundle, NetPacket &pkt)
+{
+    pkt << bundle.version << bundle.targetPid << bundle.dragSeq << bundle.fields;
+    if ((bundle.fields & DROP_BUNDLE_UD_KEY) != 0) {
+        pkt << bundle.udKey;
+    }
+    if ((bundle.fields & DROP_BUNDLE_SUMMARY) != 0) {
+        if (bundle.summarys.size() > MAX_SUMMARY_COUNT) {
+            FI_HILOGE("Too many summarys:%{public}zu", bundle.summarys.size());
+            return RET_ERR;
+        }
+        pkt << static_cast<int32_t>(bundle.summarys.size());
+        for (const auto &[udType, size] : bundle.summarys) {
+            pkt << udType << size;
+        }
+    }
+    if ((bundle.fields & DROP_BUNDLE_EXTRA_INFO) != 0) {
+        pkt << bundle.extraInfo;
+    }
+    if ((bundle.fields & DROP_BUNDLE_BUNDLE_INFO) != 0) {
+        pkt << bundle.bundleInfo.bundleName << bundle.bundleInfo.isCrossDevice;
+    }
+    if (pkt.ChkRWError()) {
+        FI_HILOGE("Packet write drop bundle failed");
+        return RET_ERR;
+    }
+    return RET_OK;
+}
+
+int32_t DropBundlePacker::UnMarshalling(NetPacket &pkt, DropBundle &bundle)
+{
+    pkt >> bundle.version;
+    if (pkt.ChkRWError() || (bundle.version != DROP_BUNDLE_VERSION)) {
+        FI_HILOGE("Unsupported drop bundle, version:%{public}d", bundle.version);
+        return RET_ERR;
+    }
+    pkt >> bundle.targetPid >> bundle.dragSeq >> bundle.fields;
+    if ((bundle.fields & DROP_BUNDLE_UD_KEY) != 0) {
+        pkt >> bundle.udKey;
+    }
+    if ((bundle.fields & DROP_BUNDLE_SUMMARY) != 0) {
+        int32_t count = 0;
+        pkt >> count;
+        if ((count < 0) || (count > MAX_SUMMARY_COUNT)) {
+            FI_HILOGE("Invalid summary count:%{public}d", count);
+            return RET_ERR;
+        }
+        for (int32_t i = 0; i < count; ++i) {
+            std::string udType;
+            int64_t size = 0;
+            pkt >> udType >> size;
+            bundle.summarys.emplace(std::move(udType), size);
+        }
+    }
+    if ((bundle.fields & DROP_BUNDLE_EXTRA_INFO) != 0) {
+        pkt >> bundle.extraInfo;
+    }
+    if ((bundle.fields & DROP_BUNDLE_BUNDLE_INFO) != 0) {
+        pkt >> bundle.bundleInfo.bundleName >> bundle.bundleInfo.isCrossDevice;
+    }
+    if (pkt.ChkRWError()) {
+        FI_HILOGE("Packet read drop bundle failed");
+        return RET_ERR;
+    }
+    return RET_OK;
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
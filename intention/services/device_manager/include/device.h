@@ -52,6 +52,9 @@ inline bool TestBit(size_t bit, const uint8_t *array)
     return ((array)[BYTE(bit)] & (1 << OFFSET(bit)));
 }
 
+class DeviceCapabilityCache;
+struct DeviceCapabilityKey;
+
 class Device final : public IDevice,
                      public IEpollEventSource {
 public:
@@ -98,10 +101,14 @@ public:
     bool HasRel(size_t rel) const;
     bool HasProperty(size_t property) const;
     bool HasCapability(Capability capability) const;
+    void SetCapabilityCache(DeviceCapabilityCache *capabilityCache);
 
 private:
     void QueryDeviceInfo();
     void QuerySupportedEvents();
+    DeviceCapabilityKey MakeCapabilityKey() const;
+    bool RestoreCapability(const DeviceCapabilityKey &key);
+    void StoreCapability(const DeviceCapabilityKey &key) const;
     void UpdateCapability();
     bool HasAbsCoord() const;
     bool HasMtCoord() const;
@@ -146,6 +153,7 @@ private:
     uint8_t relBitmask_[NBYTES(REL_MAX)] {};
     uint8_t propBitmask_[NBYTES(INPUT_PROP_MAX)] {};
     IDevice::KeyboardType keyboardType_ { IDevice::KEYBOARD_TYPE_NONE };
+    DeviceCapabilityCache *capabilityCache_ { nullptr };
 };
 
 inline int32_t Device::GetFd() const
@@ -153,6 +161,11 @@ inline int32_t Device::GetFd() const
     return fd_;
 }
 
+inline void Device::SetCapabilityCache(DeviceCapabilityCache *capabilityCache)
+{
+    capabilityCache_ = capabilityCache;
+}
+
 inline void Device::SetId(int32_t id)
 {
     deviceId_ = id;
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DEVICE_CAPABILITY_CACHE_H
+#define DEVICE_CAPABILITY_CACHE_H
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <string>
+
+#include "nocopyable.h"
+
+#include "device.h"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+struct DeviceCapabilityKey {
+    int32_t bus { 0 };
+    int32_t vendor { 0 };
+    int32_t product { 0 };
+    int32_t version { 0 };
+    std::string name;
+    std::string phys;
+    std::string uniq;
+    // Modification time of the keymap config of the device in nanoseconds, -1 if there is none.
+    int64_t configMtime { -1 };
+
+    bool operator<(const DeviceCapabilityKey &other) const;
+};
+
+struct DeviceCapability {
+    std::array<uint8_t, NBYTES(EV_MAX)> evBitmask {};
+    std::array<uint8_t, NBYTES(KEY_MAX)> keyBitmask {};
+    std::array<uint8_t, NBYTES(ABS_MAX)> absBitmask {};
+    std::array<uint8_t, NBYTES(REL_MAX)> relBitmask {};
+    std::array<uint8_t, NBYTES(INPUT_PROP_MAX)> propBitmask {};
+    uint64_t caps { 0 };
+    int32_t keyboardType { 0 };
+};
+
+struct DeviceCapabilityCacheStats {
+    uint64_t hits { 0 };
+    uint64_t misses { 0 };
+    uint64_t invalidated { 0 };
+};
+
+// Capabilities and keymap config of input devices seen before, persisted across restarts so that
+// enumeration and hot-plug of a known device skip the capability ioctls and the config parse.
+class DeviceCapabilityCache final {
+public:
+    explicit DeviceCapabilityCache(const std::string &path);
+    ~DeviceCapabilityCache() = default;
+    DISALLOW_COPY_AND_MOVE(DeviceCapabilityCache);
+
+    int32_t Load();
+    // Writes the cache back only if it changed since it was loaded or last saved.
+    int32_t Save();
+    bool Find(const DeviceCapabilityKey &key, DeviceCapability &capability);
+    void Store(const DeviceCapabilityKey &key, const DeviceCapability &capability);
+    void Invalidate(const DeviceCapabilityKey &key);
+    size_t GetSize() const;
+    DeviceCapabilityCacheStats GetStats() const;
+
+private:
+    struct Entry {
+        DeviceCapability capability;
+        uint64_t lastUsed { 0 };
+    };
+
+    static std::string Serialize(const DeviceCapabilityKey &key, const DeviceCapability &capability);
+    static bool Deserialize(const std::string &line, DeviceCapabilityKey &key, DeviceCapability &capability);
+    void Evict();
+
+    std::string path_;
+    std::map<DeviceCapabilityKey, Entry> entries_;
+    uint64_t clock_ { 0 };
+    bool dirty_ { false };
+    DeviceCapabilityCacheStats stats_;
+};
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+#endif // DEVICE_CAPABILITY_CACHE_H
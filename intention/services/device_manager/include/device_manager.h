@@ -16,6 +16,7 @@
 #ifndef DEVICE_MANAGER_H
 #define DEVICE_MANAGER_H
 
+#include <atomic>
 #include <future>
 #include <memory>
 #include <set>
@@ -24,6 +25,7 @@
 
 #include "nocopyable.h"
 
+#include "device_capability_cache.h"
 #include "enumerator.h"
 #include "i_context.h"
 #include "i_device_mgr.h"
@@ -67,6 +69,7 @@ private:
 
         void AddDevice(const std::string &devNode) override;
         void RemoveDevice(const std::string &devNode) override;
+        void ApplyChanges(const std::vector<std::string> &added, const std::vector<std::string> &removed) override;
 
     private:
         DeviceManager &devMgr_;
@@ -78,8 +81,8 @@ private:
     int32_t OnDisable();
     int32_t OnEpollDispatch(uint32_t events);
     int32_t ParseDeviceId(const std::string &devNode);
-    void OnDeviceRemoved(std::shared_ptr<IDevice> dev);
-    void OnDeviceAdded(std::shared_ptr<IDevice> dev);
+    void OnDevicesChanged(const DeviceChanges &changes);
+    void CountDevice(std::shared_ptr<IDevice> dev, int32_t delta);
     void DeviceInfo(std::shared_ptr<IDevice> dev);
     int32_t OnAddDeviceObserver(std::weak_ptr<IDeviceObserver> observer);
     int32_t OnRemoveDeviceObserver(std::weak_ptr<IDeviceObserver> observer);
@@ -88,6 +91,9 @@ private:
     std::shared_ptr<IDevice> OnGetDevice(int32_t id) const;
     std::shared_ptr<IDevice> AddDevice(const std::string &devNode);
     std::shared_ptr<IDevice> RemoveDevice(const std::string &devNode);
+    std::shared_ptr<IDevice> AddDevice(const std::string &devNode, DeviceChanges &changes);
+    std::shared_ptr<IDevice> RemoveDevice(const std::string &devNode, DeviceChanges &changes);
+    void ApplyChanges(const std::vector<std::string> &added, const std::vector<std::string> &removed);
     std::shared_ptr<IDevice> FindDevice(const std::string &devPath);
     bool IsFakePointerDevice(std::shared_ptr<IDevice> dev);
     bool IsLocalPointerDevice(std::shared_ptr<MMI::InputDevice> dev);
@@ -97,11 +103,16 @@ private:
     IContext *context_ { nullptr };
     Enumerator enumerator_;
     HotplugHandler hotplug_;
+    DeviceCapabilityCache capabilityCache_;
     EpollManager epollMgr_;
     std::atomic_bool hasPencilAirMouse_ { false };
     std::shared_ptr<Monitor> monitor_ { nullptr };
     std::set<std::weak_ptr<IDeviceObserver>> observers_;
     std::unordered_map<int32_t, std::shared_ptr<IDevice>> devices_;
+    // Maintained as devices come and go, since they are queried from outside the device thread.
+    std::atomic<int32_t> localPointerDevices_ { 0 };
+    std::atomic<int32_t> localKeyboardDevices_ { 0 };
+    std::atomic<int32_t> alphabeticKeyboards_ { 0 };
 };
 
 inline int32_t DeviceManager::GetFd() const
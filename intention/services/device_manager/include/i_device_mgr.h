@@ -16,6 +16,9 @@
 #ifndef I_DEVICE_MGR_H
 #define I_DEVICE_MGR_H
 
+#include <string>
+#include <vector>
+
 class IDeviceMgr {
 public:
     IDeviceMgr() = default;
@@ -23,6 +26,18 @@ public:
 
     virtual void AddDevice(const std::string &devNode) = 0;
     virtual void RemoveDevice(const std::string &devNode) = 0;
+    // Applies one settled batch of hot-plug events, @removed before @added.
+    virtual void ApplyChanges(const std::vector<std::string> &added, const std::vector<std::string> &removed);
 };
 
+inline void IDeviceMgr::ApplyChanges(const std::vector<std::string> &added, const std::vector<std::string> &removed)
+{
+    for (const auto &devNode : removed) {
+        RemoveDevice(devNode);
+    }
+    for (const auto &devNode : added) {
+        AddDevice(devNode);
+    }
+}
+
 #endif // I_DEVICE_MGR_H
\ No newline at end of file
@@ -16,8 +16,11 @@
 #ifndef MONITOR_H
 #define MONITOR_H
 
+#include <chrono>
+#include <map>
 #include <memory>
 #include <set>
+#include <string>
 
 #include <sys/inotify.h>
 
@@ -30,30 +33,68 @@
 namespace OHOS {
 namespace Msdp {
 namespace DeviceStatus {
+// Watches the input device directory. Create and delete events are held for a short settle window,
+// so that a burst of hot-plug events, such as a composite device bringing up several nodes, reaches
+// the device manager as one batch, and nodes that come and go within the window are never opened.
 class Monitor final : public IEpollEventSource {
 public:
-    Monitor() = default;
+    Monitor();
     DISALLOW_COPY_AND_MOVE(Monitor);
     ~Monitor();
 
     int32_t GetFd() const override;
     void Dispatch(const struct epoll_event &ev) override;
     void SetDeviceMgr(IDeviceMgr *devMgr);
+    // Directory to watch, DEV_INPUT_PATH by default. Takes effect on the next Enable().
+    void SetWatchPath(const std::string &watchPath);
+    // Event source of the settle timer, to be added to the same epoll as the monitor.
+    std::shared_ptr<IEpollEventSource> GetSettleTimer() const;
     int32_t Enable();
     void Disable();
+    // Hands pending changes to the device manager without waiting for the settle window to expire.
+    void Flush();
 
 private:
+    class SettleTimer final : public IEpollEventSource {
+    public:
+        explicit SettleTimer(Monitor &monitor);
+        ~SettleTimer();
+        DISALLOW_COPY_AND_MOVE(SettleTimer);
+
+        int32_t GetFd() const override;
+        void Dispatch(const struct epoll_event &ev) override;
+        int32_t Open();
+        void Close();
+        int32_t Arm(std::chrono::milliseconds delay);
+
+    private:
+        Monitor &monitor_;
+        int32_t timerFd_ { -1 };
+    };
+
+    enum class PendingChange {
+        ADD,
+        REMOVE,
+        REPLACE,
+    };
+
     int32_t OpenConnection();
     int32_t EnableReceiving();
     void ReceiveDevice();
-    void HandleInotifyEvent(struct inotify_event *event) const;
-    void AddDevice(const std::string &devNode) const;
-    void RemoveDevice(const std::string &devNode) const;
+    void HandleInotifyEvent(struct inotify_event *event);
+    void AddDevice(const std::string &devNode);
+    void RemoveDevice(const std::string &devNode);
+    void ScheduleFlush();
 
 private:
     int32_t inotifyFd_ { -1 };
     int32_t devWd_ { -1 };
     IDeviceMgr *devMgr_ { nullptr };
+    std::string watchPath_;
+    std::shared_ptr<SettleTimer> settleTimer_;
+    std::map<std::string, PendingChange> pending_;
+    std::chrono::steady_clock::time_point batchBegin_;
+    size_t transient_ { 0 };
 };
 
 inline int32_t Monitor::GetFd() const
@@ -18,7 +18,9 @@
 #include <fcntl.h>
 #include <unistd.h>
 #include <sys/ioctl.h>
+#include <sys/stat.h>
 
+#include <algorithm>
 #include <cstring>
 #include <fstream>
 #include <map>
@@ -27,6 +29,7 @@
 
 #include <securec.h>
 
+#include "device_capability_cache.h"
 #include "devicestatus_define.h"
 #include "devicestatus_errors.h"
 #include "fi_log.h"
@@ -49,6 +52,7 @@ namespace {
 constexpr int32_t COMMENT_SUBSCRIPT { 0 };
 constexpr ssize_t MAX_FILE_SIZE_ALLOWED { 0x5000 };
 constexpr uint64_t DOMAIN_ID { 0xD002220 };
+constexpr int64_t NANOSECONDS_PER_SECOND { 1000000000 };
 
 const struct Range KEY_BLOCKS[] {
     { KEY_ESC, BTN_MISC },
@@ -97,9 +101,14 @@ int32_t Device::Open()
         }
     }
     QueryDeviceInfo();
+    DeviceCapabilityKey key = MakeCapabilityKey();
+    if (RestoreCapability(key)) {
+        return RET_OK;
+    }
     QuerySupportedEvents();
     UpdateCapability();
     LoadDeviceConfig();
+    StoreCapability(key);
     return RET_OK;
 }
 
@@ -194,6 +203,66 @@ void Device::QuerySupportedEvents()
     GetPropMask("properties", sizeof(propBitmask_), propBitmask_);
 }
 
+DeviceCapabilityKey Device::MakeCapabilityKey() const
+{
+    DeviceCapabilityKey key {
+        .bus = bus_,
+        .vendor = vendor_,
+        .product = product_,
+        .version = version_,
+        .name = name_,
+        .phys = phys_,
+        .uniq = uniq_,
+    };
+    if (capabilityCache_ != nullptr) {
+        struct stat statbuf {};
+        if (stat(MakeConfigFileName().c_str(), &statbuf) == 0) {
+            key.configMtime = static_cast<int64_t>(statbuf.st_mtim.tv_sec) * NANOSECONDS_PER_SECOND +
+                statbuf.st_mtim.tv_nsec;
+        }
+    }
+    return key;
+}
+
+bool Device::RestoreCapability(const DeviceCapabilityKey &key)
+{
+    CALL_DEBUG_ENTER;
+    DeviceCapability capability;
+    if ((capabilityCache_ == nullptr) || !capabilityCache_->Find(key, capability)) {
+        return false;
+    }
+    // Identity and config are unchanged, so only the event types are queried to confirm the entry.
+    GetEventMask("", 0, sizeof(evBitmask_), evBitmask_);
+    if (memcmp(evBitmask_, capability.evBitmask.data(), sizeof(evBitmask_)) != 0) {
+        FI_HILOGW("Capabilities of \'%{public}s\' changed, query again", name_.c_str());
+        capabilityCache_->Invalidate(key);
+        return false;
+    }
+    std::copy(capability.keyBitmask.begin(), capability.keyBitmask.end(), keyBitmask_);
+    std::copy(capability.absBitmask.begin(), capability.absBitmask.end(), absBitmask_);
+    std::copy(capability.relBitmask.begin(), capability.relBitmask.end(), relBitmask_);
+    std::copy(capability.propBitmask.begin(), capability.propBitmask.end(), propBitmask_);
+    caps_ = std::bitset<DEVICE_CAP_MAX>(capability.caps);
+    keyboardType_ = static_cast<IDevice::KeyboardType>(capability.keyboardType);
+    FI_HILOGD("Capabilities of \'%{public}s\' restored from cache", name_.c_str());
+    return true;
+}
+
+void Device::StoreCapability(const DeviceCapabilityKey &key) const
+{
+    CHKPV(capabilityCache_);
+    DeviceCapability capability {
+        .caps = caps_.to_ullong(),
+        .keyboardType = static_cast<int32_t>(keyboardType_),
+    };
+    std::copy(std::begin(evBitmask_), std::end(evBitmask_), capability.evBitmask.begin());
+    std::copy(std::begin(keyBitmask_), std::end(keyBitmask_), capability.keyBitmask.begin());
+    std::copy(std::begin(absBitmask_), std::end(absBitmask_), capability.absBitmask.begin());
+    std::copy(std::begin(relBitmask_), std::end(relBitmask_), capability.relBitmask.begin());
+    std::copy(std::begin(propBitmask_), std::end(propBitmask_), capability.propBitmask.begin());
+    capabilityCache_->Store(key, capability);
+}
+
 void Device::UpdateCapability()
 {
     CALL_DEBUG_ENTER;
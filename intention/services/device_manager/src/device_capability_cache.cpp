@@ -0,0 +1,278 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "device_capability_cache.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <tuple>
+#include <vector>
+
+#include "devicestatus_define.h"
+
+#undef LOG_TAG
+#define LOG_TAG "DeviceCapabilityCache"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace {
+const std::string CACHE_HEADER { "devcaps 1" };
+constexpr size_t MAX_CACHED_DEVICES { 64 };
+constexpr char FIELD_SEPARATOR { '\t' };
+constexpr size_t N_FIELDS { 15 };
+constexpr int32_t HEX_BASE { 16 };
+constexpr int32_t DEC_BASE { 10 };
+constexpr size_t HEX_DIGITS_PER_BYTE { 2 };
+constexpr char HEX_DIGITS[] { "0123456789abcdef" };
+
+enum Field : size_t {
+    FIELD_BUS = 0,
+    FIELD_VENDOR,
+    FIELD_PRODUCT,
+    FIELD_VERSION,
+    FIELD_CONFIG_MTIME,
+    FIELD_CAPS,
+    FIELD_KEYBOARD_TYPE,
+    FIELD_EV_BITMASK,
+    FIELD_KEY_BITMASK,
+    FIELD_ABS_BITMASK,
+    FIELD_REL_BITMASK,
+    FIELD_PROP_BITMASK,
+    FIELD_NAME,
+    FIELD_PHYS,
+    FIELD_UNIQ,
+};
+
+template<size_t N>
+std::string ToHex(const std::array<uint8_t, N> &bitmask)
+{
+    std::string hex;
+    hex.reserve(N * HEX_DIGITS_PER_BYTE);
+    for (uint8_t byte : bitmask) {
+        hex.push_back(HEX_DIGITS[byte / HEX_BASE]);
+        hex.push_back(HEX_DIGITS[byte % HEX_BASE]);
+    }
+    return hex;
+}
+
+int32_t HexValue(char ch)
+{
+    if ((ch >= '0') && (ch <= '9')) {
+        return ch - '0';
+    }
+    if ((ch >= 'a') && (ch <= 'f')) {
+        return ch - 'a' + DEC_BASE;
+    }
+    return -1;
+}
+
+template<size_t N>
+bool FromHex(const std::string &hex, std::array<uint8_t, N> &bitmask)
+{
+    if (hex.size() != N * HEX_DIGITS_PER_BYTE) {
+        return false;
+    }
+    for (size_t index = 0; index < N; ++index) {
+        int32_t high = HexValue(hex[index * HEX_DIGITS_PER_BYTE]);
+        int32_t low = HexValue(hex[index * HEX_DIGITS_PER_BYTE + 1]);
+        if ((high < 0) || (low < 0)) {
+            return false;
+        }
+        bitmask[index] = static_cast<uint8_t>(high * HEX_BASE + low);
+    }
+    return true;
+}
+
+template<typename T>
+bool ToInteger(const std::string &str, T &value)
+{
+    std::istringstream iss(str);
+    iss >> value;
+    return (!iss.fail() && iss.eof());
+}
+} // namespace
+
+bool DeviceCapabilityKey::operator<(const DeviceCapabilityKey &other) const
+{
+    return (std::tie(bus, vendor, product, version, name, phys, uniq, configMtime) <
+        std::tie(other.bus, other.vendor, other.product, other.version, other.name, other.phys, other.uniq,
+        other.configMtime));
+}
+
+DeviceCapabilityCache::DeviceCapabilityCache(const std::string &path)
+    : path_(path)
+{}
+
+int32_t DeviceCapabilityCache::Load()
+{
+    CALL_DEBUG_ENTER;
+    std::ifstream ifs(path_);
+    if (!ifs.is_open()) {
+        FI_HILOGI("No device capability cache yet");
+        return RET_ERR;
+    }
+    std::string line;
+    if (!std::getline(ifs, line) || (line != CACHE_HEADER)) {
+        FI_HILOGW("Discard device capability cache of unknown format");
+        return RET_ERR;
+    }
+    entries_.clear();
+    while (std::getline(ifs, line) && (entries_.size() < MAX_CACHED_DEVICES)) {
+        DeviceCapabilityKey key;
+        Entry entry;
+        if (!Deserialize(line, key, entry.capability)) {
+            FI_HILOGW("Skip corrupted entry of device capability cache");
+            continue;
+        }
+        entry.lastUsed = ++clock_;
+        entries_.insert_or_assign(std::move(key), std::move(entry));
+    }
+    dirty_ = false;
+    FI_HILOGI("%{public}zu devices loaded from capability cache", entries_.size());
+    return RET_OK;
+}
+
+int32_t DeviceCapabilityCache::Save()
+{
+    CALL_DEBUG_ENTER;
+    if (!dirty_) {
+        return RET_OK;
+    }
+    const std::string tmpPath { path_ + ".tmp" };
+    {
+        std::ofstream ofs(tmpPath, std::ios::trunc);
+        if (!ofs.is_open()) {
+            FI_HILOGE("Failed to open device capability cache for writing");
+            return RET_ERR;
+        }
+        ofs << CACHE_HEADER << '\n';
+        for (const auto &[key, entry] : entries_) {
+            ofs << Serialize(key, entry.capability) << '\n';
+        }
+        if (!ofs.good()) {
+            FI_HILOGE("Failed to write device capability cache");
+            return RET_ERR;
+        }
+    }
+    if (std::rename(tmpPath.c_str(), path_.c_str()) != 0) {
+        FI_HILOGE("Failed to replace device capability cache:%{public}s", strerror(errno));
+        return RET_ERR;
+    }
+    dirty_ = false;
+    return RET_OK;
+}
+
+bool DeviceCapabilityCache::Find(const DeviceCapabilityKey &key, DeviceCapability &capability)
+{
+    auto iter = entries_.find(key);
+    if (iter == entries_.end()) {
+        ++stats_.misses;
+        return false;
+    }
+    ++stats_.hits;
+    iter->second.lastUsed = ++clock_;
+    capability = iter->second.capability;
+    return true;
+}
+
+void DeviceCapabilityCache::Store(const DeviceCapabilityKey &key, const DeviceCapability &capability)
+{
+    auto isPlainField = [](const std::string &str) {
+        return (str.find_first_of("\t\n") == std::string::npos);
+    };
+    if (!isPlainField(key.name) || !isPlainField(key.phys) || !isPlainField(key.uniq)) {
+        FI_HILOGW("Device can not be cached");
+        return;
+    }
+    entries_.insert_or_assign(key, Entry { .capability = capability, .lastUsed = ++clock_ });
+    Evict();
+    dirty_ = true;
+}
+
+void DeviceCapabilityCache::Invalidate(const DeviceCapabilityKey &key)
+{
+    if (entries_.erase(key) > 0) {
+        ++stats_.invalidated;
+        dirty_ = true;
+    }
+}
+
+size_t DeviceCapabilityCache::GetSize() const
+{
+    return entries_.size();
+}
+
+DeviceCapabilityCacheStats DeviceCapabilityCache::GetStats() const
+{
+    return stats_;
+}
+
+void DeviceCapabilityCache::Evict()
+{
+    while (entries_.size() > MAX_CACHED_DEVICES) {
+        auto iter = std::min_element(entries_.begin(), entries_.end(), [](const auto &lhs, const auto &rhs) {
+            return (lhs.second.lastUsed < rhs.second.lastUsed);
+        });
+        entries_.erase(iter);
+    }
+}
+
+std::string DeviceCapabilityCache::Serialize(const DeviceCapabilityKey &key, const DeviceCapability &capability)
+{
+    std::ostringstream oss;
+    oss << key.bus << FIELD_SEPARATOR << key.vendor << FIELD_SEPARATOR << key.product << FIELD_SEPARATOR
+        << key.version << FIELD_SEPARATOR << key.configMtime << FIELD_SEPARATOR << capability.caps
+        << FIELD_SEPARATOR << capability.keyboardType << FIELD_SEPARATOR << ToHex(capability.evBitmask)
+        << FIELD_SEPARATOR << ToHex(capability.keyBitmask) << FIELD_SEPARATOR << ToHex(capability.absBitmask)
+        << FIELD_SEPARATOR << ToHex(capability.relBitmask) << FIELD_SEPARATOR << ToHex(capability.propBitmask)
+        << FIELD_SEPARATOR << key.name << FIELD_SEPARATOR << key.phys << FIELD_SEPARATOR << key.uniq;
+    return oss.str();
+}
+
+bool DeviceCapabilityCache::Deserialize(const std::string &line, DeviceCapabilityKey &key,
+    DeviceCapability &capability)
+{
+    std::vector<std::string> fields;
+    std::string::size_type start = 0;
+    for (;;) {
+        std::string::size_type pos = line.find(FIELD_SEPARATOR, start);
+        fields.push_back(line.substr(start, pos - start));
+        if (pos == std::string::npos) {
+            break;
+        }
+        start = pos + 1;
+    }
+    if (fields.size() != N_FIELDS) {
+        return false;
+    }
+    key.name = fields[FIELD_NAME];
+    key.phys = fields[FIELD_PHYS];
+    key.uniq = fields[FIELD_UNIQ];
+    return (ToInteger(fields[FIELD_BUS], key.bus) && ToInteger(fields[FIELD_VENDOR], key.vendor) &&
+        ToInteger(fields[FIELD_PRODUCT], key.product) && ToInteger(fields[FIELD_VERSION], key.version) &&
+        ToInteger(fields[FIELD_CONFIG_MTIME], key.configMtime) && ToInteger(fields[FIELD_CAPS], capability.caps) &&
+        ToInteger(fields[FIELD_KEYBOARD_TYPE], capability.keyboardType) &&
+        FromHex(fields[FIELD_EV_BITMASK], capability.evBitmask) &&
+        FromHex(fields[FIELD_KEY_BITMASK], capability.keyBitmask) &&
+        FromHex(fields[FIELD_ABS_BITMASK], capability.absBitmask) &&
+        FromHex(fields[FIELD_REL_BITMASK], capability.relBitmask) &&
+        FromHex(fields[FIELD_PROP_BITMASK], capability.propBitmask));
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
@@ -43,6 +43,7 @@ namespace {
 constexpr size_t EXPECTED_N_SUBMATCHES { 2 };
 constexpr size_t EXPECTED_SUBMATCH { 1 };
 const std::string VIRTUAL_TRACK_PAD_NAME { "VirtualTrackpad" };
+const std::string DEVICE_CAPABILITY_CACHE_PATH { "/data/msdp/device_capability.cache" };
 constexpr int32_t INVALID_DEVICE_ID { -1 };
 } // namespace
 
@@ -60,8 +61,14 @@ void DeviceManager::HotplugHandler::RemoveDevice(const std::string &devNode)
     devMgr_.RemoveDevice(devNode);
 }
 
+void DeviceManager::HotplugHandler::ApplyChanges(const std::vector<std::string> &added,
+    const std::vector<std::string> &removed)
+{
+    devMgr_.ApplyChanges(added, removed);
+}
+
 DeviceManager::DeviceManager()
-    : hotplug_(*this)
+    : hotplug_(*this), capabilityCache_(DEVICE_CAPABILITY_CACHE_PATH)
 {
     monitor_ = std::make_shared<Monitor>();
 }
@@ -120,9 +127,18 @@ int32_t DeviceManager::OnEnable()
         ret = RET_ERR;
         goto DISABLE_MONITOR;
     }
+    if ((monitor_->GetSettleTimer()->GetFd() >= 0) && !epollMgr_.Add(monitor_->GetSettleTimer())) {
+        ret = RET_ERR;
+        goto REMOVE_MONITOR;
+    }
+    capabilityCache_.Load();
     enumerator_.ScanDevices();
+    capabilityCache_.Save();
     return RET_OK;
 
+REMOVE_MONITOR:
+    epollMgr_.Remove(monitor_);
+
 DISABLE_MONITOR:
     monitor_->Disable();
 
@@ -147,6 +163,9 @@ int32_t DeviceManager::Disable()
 int32_t DeviceManager::OnDisable()
 {
     CHKPR(monitor_, RET_ERR);
+    if (monitor_->GetSettleTimer()->GetFd() >= 0) {
+        epollMgr_.Remove(monitor_->GetSettleTimer());
+    }
     epollMgr_.Remove(monitor_);
     monitor_->Disable();
     epollMgr_.Close();
@@ -181,6 +200,14 @@ int32_t DeviceManager::ParseDeviceId(const std::string &devNode)
 }
 
 std::shared_ptr<IDevice> DeviceManager::AddDevice(const std::string &devNode)
+{
+    DeviceChanges changes;
+    std::shared_ptr<IDevice> dev = AddDevice(devNode, changes);
+    OnDevicesChanged(changes);
+    return dev;
+}
+
+std::shared_ptr<IDevice> DeviceManager::AddDevice(const std::string &devNode, DeviceChanges &changes)
 {
     CALL_INFO_TRACE;
     const std::string SYS_INPUT_PATH { "/sys/class/input/" };
@@ -215,17 +242,23 @@ std::shared_ptr<IDevice> DeviceManager::AddDevice(const std::string &devNode)
         return nullptr;
     }
 
-    dev = std::make_shared<Device>(deviceId);
-    dev->SetDevPath(devPath);
-    dev->SetSysPath(std::string(rpath));
+    auto device = std::make_shared<Device>(deviceId);
+    device->SetDevPath(devPath);
+    device->SetSysPath(std::string(rpath));
+    device->SetCapabilityCache(&capabilityCache_);
+    dev = device;
     if (dev->Open() != RET_OK) {
         FI_HILOGE("Unable to open \'%{private}s\'", devPath.c_str());
         return nullptr;
     }
+    if (auto iter = devices_.find(dev->GetId()); iter != devices_.end()) {
+        CountDevice(iter->second, -1);
+    }
     auto ret = devices_.insert_or_assign(dev->GetId(), dev);
+    CountDevice(dev, 1);
     if (ret.second) {
         FI_HILOGI("\'%{public}s\' added", dev->GetName().c_str());
-        OnDeviceAdded(dev);
+        changes.added.push_back(dev);
     }
     return dev;
 }
@@ -247,6 +280,14 @@ bool DeviceManager::IsVirtualTrackpad(std::shared_ptr<MMI::InputDevice> device)
 }
 
 std::shared_ptr<IDevice> DeviceManager::RemoveDevice(const std::string &devNode)
+{
+    DeviceChanges changes;
+    std::shared_ptr<IDevice> dev = RemoveDevice(devNode, changes);
+    OnDevicesChanged(changes);
+    return dev;
+}
+
+std::shared_ptr<IDevice> DeviceManager::RemoveDevice(const std::string &devNode, DeviceChanges &changes)
 {
     CALL_INFO_TRACE;
     const std::string devPath { DEV_INPUT_PATH + devNode };
@@ -256,9 +297,10 @@ std::shared_ptr<IDevice> DeviceManager::RemoveDevice(const std::string &devNode)
         CHKPC(dev);
         if (dev->GetDevPath() == devPath) {
             devices_.erase(devIter);
+            CountDevice(dev, -1);
             FI_HILOGI("\'%{public}s\' removed", dev->GetName().c_str());
             dev->Close();
-            OnDeviceRemoved(dev);
+            changes.removed.push_back(dev);
             return dev;
         }
     }
@@ -266,18 +308,53 @@ std::shared_ptr<IDevice> DeviceManager::RemoveDevice(const std::string &devNode)
     return nullptr;
 }
 
-void DeviceManager::OnDeviceAdded(std::shared_ptr<IDevice> dev)
+void DeviceManager::ApplyChanges(const std::vector<std::string> &added, const std::vector<std::string> &removed)
+{
+    CALL_INFO_TRACE;
+    DeviceChanges changes;
+    for (const auto &devNode : removed) {
+        RemoveDevice(devNode, changes);
+    }
+    for (const auto &devNode : added) {
+        AddDevice(devNode, changes);
+    }
+    OnDevicesChanged(changes);
+}
+
+void DeviceManager::OnDevicesChanged(const DeviceChanges &changes)
 {
     // LCOV_EXCL_START
-    DeviceInfo(dev);
+    if (changes.added.empty() && changes.removed.empty()) {
+        return;
+    }
+    for (const auto &dev : changes.added) {
+        DeviceInfo(dev);
+    }
     for (const auto &observer : observers_) {
         std::shared_ptr<IDeviceObserver> ptr = observer.lock();
         CHKPC(ptr);
-        ptr->OnDeviceAdded(dev);
+        ptr->OnDevicesChanged(changes);
     }
     // LCOV_EXCL_STOP
 }
 
+void DeviceManager::CountDevice(std::shared_ptr<IDevice> dev, int32_t delta)
+{
+    CHKPV(dev);
+    if (dev->IsRemote()) {
+        return;
+    }
+    if (dev->IsPointerDevice() && !IsFakePointerDevice(dev)) {
+        localPointerDevices_ += delta;
+    }
+    if (dev->IsKeyboard()) {
+        localKeyboardDevices_ += delta;
+        if (dev->GetKeyboardType() == IDevice::KeyboardType::KEYBOARD_TYPE_ALPHABETICKEYBOARD) {
+            alphabeticKeyboards_ += delta;
+        }
+    }
+}
+
 void DeviceManager::DeviceInfo(std::shared_ptr<IDevice> dev)
 {
     // LCOV_EXCL_START
@@ -296,17 +373,6 @@ void DeviceManager::DeviceInfo(std::shared_ptr<IDevice> dev)
     // LCOV_EXCL_STOP
 }
 
-void DeviceManager::OnDeviceRemoved(std::shared_ptr<IDevice> dev)
-{
-    // LCOV_EXCL_START
-    for (const auto &observer : observers_) {
-        std::shared_ptr<IDeviceObserver> ptr = observer.lock();
-        CHKPC(ptr);
-        ptr->OnDeviceRemoved(dev);
-    }
-    // LCOV_EXCL_STOP
-}
-
 void DeviceManager::Dispatch(const struct epoll_event &ev)
 {
     CALL_DEBUG_ENTER;
@@ -326,6 +392,7 @@ int32_t DeviceManager::OnEpollDispatch(uint32_t events)
     ev.data.ptr = &epollMgr_;
 
     epollMgr_.Dispatch(ev);
+    capabilityCache_.Save();
     return RET_OK;
 }
 
@@ -459,15 +526,7 @@ bool DeviceManager::AnyOf(std::function<bool(std::shared_ptr<IDevice>)> pred)
 
 bool DeviceManager::HasLocalPointerDevice()
 {
-    // LCOV_EXCL_START
-    return AnyOf([this](std::shared_ptr<IDevice> dev) {
-        DeviceInfo(dev);
-        if ((dev == nullptr) || IsFakePointerDevice(dev)) {
-            return false;
-        }
-        return (dev->IsPointerDevice() && !dev->IsRemote());
-    });
-    // LCOV_EXCL_STOP
+    return (localPointerDevices_.load() > 0);
 }
 
 bool DeviceManager::IsFakePointerDevice(std::shared_ptr<IDevice> dev)
@@ -486,25 +545,12 @@ bool DeviceManager::IsFakePointerDevice(std::shared_ptr<IDevice> dev)
 
 bool DeviceManager::HasLocalKeyboardDevice()
 {
-    // LCOV_EXCL_START
-    return AnyOf([this](std::shared_ptr<IDevice> dev) {
-        CHKPR(dev, false);
-        return (dev->IsKeyboard() && !dev->IsRemote());
-    });
-    // LCOV_EXCL_STOP
+    return (localKeyboardDevices_.load() > 0);
 }
 
 bool DeviceManager::HasKeyboard()
 {
-    // LCOV_EXCL_START
-    return AnyOf([this](std::shared_ptr<IDevice> dev) {
-        if ((dev == nullptr)) {
-            return false;
-        }
-        return (dev->IsKeyboard() && !dev->IsRemote() &&
-            dev->GetKeyboardType() == IDevice::KeyboardType::KEYBOARD_TYPE_ALPHABETICKEYBOARD);
-    });
-    // LCOV_EXCL_STOP
+    return (alphabeticKeyboards_.load() > 0);
 }
 
 std::vector<std::shared_ptr<IDevice>> DeviceManager::GetKeyboard()
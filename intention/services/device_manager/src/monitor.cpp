@@ -15,10 +15,13 @@
 
 #include "monitor.h"
 
+#include <algorithm>
 #include <cstring>
 #include <string_view>
+#include <vector>
 
 #include <sys/epoll.h>
+#include <sys/timerfd.h>
 #include <unistd.h>
 
 #include "devicestatus_define.h"
@@ -34,8 +37,84 @@ namespace Msdp {
 namespace DeviceStatus {
 namespace {
 constexpr uint64_t DOMAIN_ID { 0xD002220 };
+constexpr std::chrono::milliseconds SETTLE_WINDOW { 30 };
+constexpr std::chrono::milliseconds MAX_BATCH_DELAY { 150 };
+constexpr std::chrono::milliseconds MIN_TIMER_DELAY { 1 };
+constexpr int64_t MS_PER_SECOND { 1000 };
+constexpr int64_t NS_PER_MS { 1000000 };
 } // namespace
 
+Monitor::SettleTimer::SettleTimer(Monitor &monitor)
+    : monitor_(monitor)
+{}
+
+Monitor::SettleTimer::~SettleTimer()
+{
+    Close();
+}
+
+int32_t Monitor::SettleTimer::GetFd() const
+{
+    return timerFd_;
+}
+
+void Monitor::SettleTimer::Dispatch(const struct epoll_event &ev)
+{
+    if ((ev.events & EPOLLIN) != EPOLLIN) {
+        return;
+    }
+    uint64_t expirations { 0 };
+    if (::read(timerFd_, &expirations, sizeof(expirations)) != static_cast<ssize_t>(sizeof(expirations))) {
+        FI_HILOGW("Read settle timer failed:%{public}s", strerror(errno));
+    }
+    monitor_.Flush();
+}
+
+int32_t Monitor::SettleTimer::Open()
+{
+    if (timerFd_ >= 0) {
+        return RET_OK;
+    }
+    timerFd_ = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC | TFD_NONBLOCK);
+    if (timerFd_ < 0) {
+        FI_HILOGE("timerfd_create failed:%{public}s", strerror(errno));
+        return RET_ERR;
+    }
+    fdsan_exchange_owner_tag(timerFd_, 0, DOMAIN_ID);
+    return RET_OK;
+}
+
+void Monitor::SettleTimer::Close()
+{
+    if (timerFd_ >= 0) {
+        if (fdsan_close_with_tag(timerFd_, DOMAIN_ID) < 0) {
+            FI_HILOGE("Close settle timer failed:%{public}s", strerror(errno));
+        }
+        timerFd_ = -1;
+    }
+}
+
+int32_t Monitor::SettleTimer::Arm(std::chrono::milliseconds delay)
+{
+    if (timerFd_ < 0) {
+        return RET_ERR;
+    }
+    struct itimerspec tspec {};
+    tspec.it_value.tv_sec = delay.count() / MS_PER_SECOND;
+    tspec.it_value.tv_nsec = (delay.count() % MS_PER_SECOND) * NS_PER_MS;
+    if (timerfd_settime(timerFd_, 0, &tspec, nullptr) != 0) {
+        FI_HILOGE("timerfd_settime failed:%{public}s", strerror(errno));
+        return RET_ERR;
+    }
+    return RET_OK;
+}
+
+Monitor::Monitor()
+    : watchPath_(DEV_INPUT_PATH)
+{
+    settleTimer_ = std::make_shared<SettleTimer>(*this);
+}
+
 Monitor::~Monitor()
 {
     Disable();
@@ -59,10 +138,23 @@ void Monitor::SetDeviceMgr(IDeviceMgr *devMgr)
     devMgr_ = devMgr;
 }
 
+void Monitor::SetWatchPath(const std::string &watchPath)
+{
+    watchPath_ = watchPath;
+}
+
+std::shared_ptr<IEpollEventSource> Monitor::GetSettleTimer() const
+{
+    return settleTimer_;
+}
+
 int32_t Monitor::Enable()
 {
     CALL_INFO_TRACE;
     int32_t ret = OpenConnection();
+    if ((ret == RET_OK) && (settleTimer_->Open() != RET_OK)) {
+        FI_HILOGW("No settle timer, hot-plug events will not be batched");
+    }
     if (ret == RET_OK) {
         ret = EnableReceiving();
         if (ret != RET_OK) {
@@ -89,6 +181,8 @@ void Monitor::Disable()
         }
         inotifyFd_ = -1;
     }
+    settleTimer_->Close();
+    pending_.clear();
 }
 
 int32_t Monitor::OpenConnection()
@@ -106,9 +200,9 @@ int32_t Monitor::OpenConnection()
 int32_t Monitor::EnableReceiving()
 {
     CALL_DEBUG_ENTER;
-    devWd_ = inotify_add_watch(inotifyFd_, DEV_INPUT_PATH.c_str(), IN_CREATE | IN_DELETE);
+    devWd_ = inotify_add_watch(inotifyFd_, watchPath_.c_str(), IN_CREATE | IN_DELETE);
     if (devWd_ < 0) {
-        FI_HILOGE("Watching (\'%{private}s\') failed, errno:%{public}s", DEV_INPUT_PATH.c_str(), strerror(errno));
+        FI_HILOGE("Watching (\'%{private}s\') failed, errno:%{public}s", watchPath_.c_str(), strerror(errno));
         return RET_ERR;
     }
     return RET_OK;
@@ -146,9 +240,10 @@ void Monitor::ReceiveDevice()
         }
         p += sizeof(struct inotify_event) + event->len;
     }
+    ScheduleFlush();
 }
 
-void Monitor::HandleInotifyEvent(struct inotify_event *event) const
+void Monitor::HandleInotifyEvent(struct inotify_event *event)
 {
     CALL_DEBUG_ENTER;
     if (Utility::IsEmpty(event->name)) {
@@ -163,18 +258,72 @@ void Monitor::HandleInotifyEvent(struct inotify_event *event) const
     }
 }
 
-void Monitor::AddDevice(const std::string &devNode) const
+void Monitor::AddDevice(const std::string &devNode)
 {
     CALL_DEBUG_ENTER;
-    CHKPV(devMgr_);
-    devMgr_->AddDevice(devNode);
+    if (pending_.empty()) {
+        batchBegin_ = std::chrono::steady_clock::now();
+    }
+    auto [iter, inserted] = pending_.try_emplace(devNode, PendingChange::ADD);
+    if (!inserted && (iter->second == PendingChange::REMOVE)) {
+        iter->second = PendingChange::REPLACE;
+    }
+}
+
+void Monitor::RemoveDevice(const std::string &devNode)
+{
+    CALL_DEBUG_ENTER;
+    if (pending_.empty()) {
+        batchBegin_ = std::chrono::steady_clock::now();
+    }
+    auto [iter, inserted] = pending_.try_emplace(devNode, PendingChange::REMOVE);
+    if (inserted) {
+        return;
+    }
+    if (iter->second == PendingChange::ADD) {
+        // The node came and went within the settle window, there is nothing to open.
+        pending_.erase(iter);
+        ++transient_;
+    } else {
+        iter->second = PendingChange::REMOVE;
+    }
+}
+
+void Monitor::ScheduleFlush()
+{
+    if (pending_.empty()) {
+        return;
+    }
+    auto age = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - batchBegin_);
+    auto delay = std::max(std::min(SETTLE_WINDOW, MAX_BATCH_DELAY - age), MIN_TIMER_DELAY);
+    if ((age >= MAX_BATCH_DELAY) || (settleTimer_->Arm(delay) != RET_OK)) {
+        Flush();
+    }
 }
 
-void Monitor::RemoveDevice(const std::string &devNode) const
+void Monitor::Flush()
 {
     CALL_DEBUG_ENTER;
+    if (pending_.empty()) {
+        transient_ = 0;
+        return;
+    }
+    std::vector<std::string> added;
+    std::vector<std::string> removed;
+    for (const auto &[devNode, change] : pending_) {
+        if (change != PendingChange::ADD) {
+            removed.push_back(devNode);
+        }
+        if (change != PendingChange::REMOVE) {
+            added.push_back(devNode);
+        }
+    }
+    FI_HILOGI("Hot-plug batch, added:%{public}zu, removed:%{public}zu, transient:%{public}zu",
+        added.size(), removed.size(), transient_);
+    pending_.clear();
+    transient_ = 0;
     CHKPV(devMgr_);
-    devMgr_->RemoveDevice(devNode);
+    devMgr_->ApplyChanges(added, removed);
 }
 } // namespace DeviceStatus
 } // namespace Msdp
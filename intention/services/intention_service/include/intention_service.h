@@ -173,6 +173,7 @@ public:
 
     // hidumper
     int32_t Dump(int32_t fd, const std::vector<std::u16string> &args) override;
+    int32_t OnRemoteRequest(uint32_t code, MessageParcel &data, MessageParcel &reply, MessageOption &option) override;
 
 private:
     CallingContext GetCallingContext();
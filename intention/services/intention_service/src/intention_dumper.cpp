@@ -59,12 +59,13 @@ void IntentionDumper::Dump(int32_t fd, const std::vector<std::string> &args)
         { "current", no_argument, nullptr, 'c' },
         { "drag", no_argument, nullptr, 'd' },
         { "macroState", no_argument, nullptr, 'm' },
+        { "session", no_argument, nullptr, 'e' },
         { nullptr, 0, nullptr, 0 }
     };
     optind = 0;
     int32_t opt = -1;
 
-    while ((opt = getopt_long(argv.size(), argv.data(), "+hslcdm", dumpOptions, nullptr)) >= 0) {
+    while ((opt = getopt_long(argv.size(), argv.data(), "+hslcdme", dumpOptions, nullptr)) >= 0) {
         DumpOnce(fd, opt);
     }
 }
@@ -92,6 +93,10 @@ void IntentionDumper::DumpOnce(int32_t fd, int32_t option)
             DumpCheckDefine(fd);
             break;
         }
+        case 'e': {
+            DumpSession(fd);
+            break;
+        }
         default: {
             DumpHelpInfo(fd);
             break;
@@ -108,6 +113,7 @@ void IntentionDumper::DumpHelpInfo(int32_t fd) const
     dprintf(fd, "\t-c\t\tdump the current device status\n");
     dprintf(fd, "\t-d\t\tdump the drag status\n");
     dprintf(fd, "\t-m\t\tdump the macro state\n");
+    dprintf(fd, "\t-e\t\tdump the outbound queues of client sessions\n");
 }
 
 void IntentionDumper::DumpDeviceStatusSubscriber(int32_t fd) const
@@ -162,6 +168,13 @@ void IntentionDumper::DumpDrag(int32_t fd) const
     }
 }
 
+void IntentionDumper::DumpSession(int32_t fd) const
+{
+    CHKPV(env_);
+    FI_HILOGI("Dump client sessions");
+    env_->GetSocketSessionManager().Dump(fd);
+}
+
 void IntentionDumper::DumpCheckDefine(int32_t fd) const
 {
     CheckDefineOutput(fd, "Macro switch state:\n");
@@ -16,6 +16,9 @@
 #include "accesstoken_kit.h"
 #include "intention_service.h"
 
+#include <chrono>
+#include <iterator>
+
 #include <ipc_skeleton.h>
 #include <string_ex.h>
 #include <tokenid_kit.h>
@@ -23,6 +26,7 @@
 #include <xcollie/xcollie_define.h>
 
 #include "devicestatus_define.h"
+#include "ipc_statistics.h"
 #include "sequenceable_drag_visible.h"
 
 #undef LOG_TAG
@@ -38,6 +42,109 @@ constexpr int32_t RET_NO_SUPPORT = 801;
 #ifndef DEVICE_STATUS_CAR_AWARENESS_ENABLE
 constexpr int32_t CAR_AWARENESS_NOT_SUPPORTED = 801;
 #endif // DEVICE_STATUS_CAR_AWARENESS_ENABLE
+
+struct IpcMethodInfo {
+    IIntentionIpcCode code;
+    const char *method;
+    const char *server;
+};
+
+constexpr IpcMethodInfo IPC_METHOD_INFOS[] {
+    { IIntentionIpcCode::COMMAND_SOCKET, "Socket", "Socket" },
+    { IIntentionIpcCode::COMMAND_ENABLE_COOPERATE, "EnableCooperate", "Cooperate" },
+    { IIntentionIpcCode::COMMAND_DISABLE_COOPERATE, "DisableCooperate", "Cooperate" },
+    { IIntentionIpcCode::COMMAND_START_COOPERATE, "StartCooperate", "Cooperate" },
+    { IIntentionIpcCode::COMMAND_START_COOPERATE_WITH_OPTIONS, "StartCooperateWithOptions", "Cooperate" },
+    { IIntentionIpcCode::COMMAND_STOP_COOPERATE, "StopCooperate", "Cooperate" },
+    { IIntentionIpcCode::COMMAND_REGISTER_COOPERATE_LISTENER, "RegisterCooperateListener", "Cooperate" },
+    { IIntentionIpcCode::COMMAND_UNREGISTER_COOPERATE_LISTENER, "UnregisterCooperateListener", "Cooperate" },
+    { IIntentionIpcCode::COMMAND_REGISTER_HOT_AREA_LISTENER, "RegisterHotAreaListener", "Cooperate" },
+    { IIntentionIpcCode::COMMAND_UNREGISTER_HOT_AREA_LISTENER, "UnregisterHotAreaListener", "Cooperate" },
+    { IIntentionIpcCode::COMMAND_REGISTER_MOUSE_EVENT_LISTENER, "RegisterMouseEventListener", "Cooperate" },
+    { IIntentionIpcCode::COMMAND_UNREGISTER_MOUSE_EVENT_LISTENER, "UnregisterMouseEventListener", "Cooperate" },
+    { IIntentionIpcCode::COMMAND_GET_COOPERATE_STATE_SYNC, "GetCooperateStateSync", "Cooperate" },
+    { IIntentionIpcCode::COMMAND_GET_COOPERATE_STATE_ASYNC, "GetCooperateStateAsync", "Cooperate" },
+    { IIntentionIpcCode::COMMAND_SET_DAMPLING_COEFFICIENT, "SetDamplingCoefficient", "Cooperate" },
+    { IIntentionIpcCode::COMMAND_START_DRAG, "StartDrag", "Drag" },
+    { IIntentionIpcCode::COMMAND_STOP_DRAG, "StopDrag", "Drag" },
+    { IIntentionIpcCode::COMMAND_ENABLE_INTERNAL_DROP_ANIMATION, "EnableInternalDropAnimation", "Drag" },
+    { IIntentionIpcCode::COMMAND_ADD_DRAGLISTENER, "AddDraglistener", "Drag" },
+    { IIntentionIpcCode::COMMAND_REMOVE_DRAGLISTENER, "RemoveDraglistener", "Drag" },
+    { IIntentionIpcCode::COMMAND_ADD_SUBSCRIPT_LISTENER, "AddSubscriptListener", "Drag" },
+    { IIntentionIpcCode::COMMAND_REMOVE_SUBSCRIPT_LISTENER, "RemoveSubscriptListener", "Drag" },
+    { IIntentionIpcCode::COMMAND_SET_DRAG_WINDOW_VISIBLE, "SetDragWindowVisible", "Drag" },
+    { IIntentionIpcCode::COMMAND_UPDATE_DRAG_STYLE, "UpdateDragStyle", "Drag" },
+    { IIntentionIpcCode::COMMAND_UPDATE_SHADOW_PIC, "UpdateShadowPic", "Drag" },
+    { IIntentionIpcCode::COMMAND_GET_DRAG_TARGET_PID, "GetDragTargetPid", "Drag" },
+    { IIntentionIpcCode::COMMAND_GET_UD_KEY, "GetUdKey", "Drag" },
+    { IIntentionIpcCode::COMMAND_GET_SHADOW_OFFSET, "GetShadowOffset", "Drag" },
+    { IIntentionIpcCode::COMMAND_GET_DRAG_DATA, "GetDragData", "Drag" },
+    { IIntentionIpcCode::COMMAND_UPDATE_PREVIEW_STYLE, "UpdatePreviewStyle", "Drag" },
+    { IIntentionIpcCode::COMMAND_UPDATE_PREVIEW_STYLE_WITH_ANIMATION, "UpdatePreviewStyleWithAnimation", "Drag" },
+    { IIntentionIpcCode::COMMAND_ROTATE_DRAG_WINDOW_SYNC, "RotateDragWindowSync", "Drag" },
+    { IIntentionIpcCode::COMMAND_SET_DRAG_WINDOW_SCREEN_ID, "SetDragWindowScreenId", "Drag" },
+    { IIntentionIpcCode::COMMAND_GET_DRAG_SUMMARY, "GetDragSummary", "Drag" },
+    { IIntentionIpcCode::COMMAND_GET_DRAG_SUMMARY_INFO, "GetDragSummaryInfo", "Drag" },
+    { IIntentionIpcCode::COMMAND_GET_DRAG_STATE, "GetDragState", "Drag" },
+    { IIntentionIpcCode::COMMAND_ENABLE_UPPER_CENTER_MODE, "EnableUpperCenterMode", "Drag" },
+    { IIntentionIpcCode::COMMAND_GET_DRAG_ACTION, "GetDragAction", "Drag" },
+    { IIntentionIpcCode::COMMAND_GET_EXTRA_INFO, "GetExtraInfo", "Drag" },
+    { IIntentionIpcCode::COMMAND_ADD_PRIVILEGE, "AddPrivilege", "Drag" },
+    { IIntentionIpcCode::COMMAND_ERASE_MOUSE_ICON, "EraseMouseIcon", "Drag" },
+    { IIntentionIpcCode::COMMAND_SET_MOUSE_DRAG_MONITOR_STATE, "SetMouseDragMonitorState", "Drag" },
+    { IIntentionIpcCode::COMMAND_SET_DRAGGABLE_STATE, "SetDraggableState", "Drag" },
+    { IIntentionIpcCode::COMMAND_GET_APP_DRAG_SWITCH_STATE, "GetAppDragSwitchState", "Drag" },
+    { IIntentionIpcCode::COMMAND_SET_DRAGGABLE_STATE_ASYNC, "SetDraggableStateAsync", "Drag" },
+    { IIntentionIpcCode::COMMAND_GET_DRAG_BUNDLE_INFO, "GetDragBundleInfo", "Drag" },
+    { IIntentionIpcCode::COMMAND_IS_DRAG_START, "IsDragStart", "Drag" },
+    { IIntentionIpcCode::COMMAND_GET_DRAG_ANIMATION_TYPE, "GetDragAnimationType", "Drag" },
+    { IIntentionIpcCode::COMMAND_SUBSCRIBE_CALLBACK, "SubscribeCallback", "Boomerang" },
+    { IIntentionIpcCode::COMMAND_UNSUBSCRIBE_CALLBACK, "UnsubscribeCallback", "Boomerang" },
+    { IIntentionIpcCode::COMMAND_NOTIFY_METADATA_BINDING_EVENT, "NotifyMetadataBindingEvent", "Boomerang" },
+    { IIntentionIpcCode::COMMAND_SUBMIT_METADATA, "SubmitMetadata", "Boomerang" },
+    { IIntentionIpcCode::COMMAND_BOOMERANG_ENCODE_IMAGE, "BoomerangEncodeImage", "Boomerang" },
+    { IIntentionIpcCode::COMMAND_BOOMERANG_DECODE_IMAGE, "BoomerangDecodeImage", "Boomerang" },
+    { IIntentionIpcCode::COMMAND_SUBSCRIBE_STATIONARY_CALLBACK, "SubscribeStationaryCallback", "Stationary" },
+    { IIntentionIpcCode::COMMAND_UNSUBSCRIBE_STATIONARY_CALLBACK, "UnsubscribeStationaryCallback", "Stationary" },
+    { IIntentionIpcCode::COMMAND_GET_DEVICE_STATUS_DATA, "GetDeviceStatusData", "Stationary" },
+    { IIntentionIpcCode::COMMAND_GET_DEVICE_POSTURE_DATA_SYNC, "GetDevicePostureDataSync", "Stationary" },
+    { IIntentionIpcCode::COMMAND_GET_PAGE_CONTENT, "GetPageContent", "OnScreen" },
+    { IIntentionIpcCode::COMMAND_SEND_CONTROL_EVENT, "SendControlEvent", "OnScreen" },
+    { IIntentionIpcCode::COMMAND_REGISTER_SCREEN_EVENT_CALLBACK, "RegisterScreenEventCallback", "OnScreen" },
+    { IIntentionIpcCode::COMMAND_UNREGISTER_SCREEN_EVENT_CALLBACK, "UnregisterScreenEventCallback", "OnScreen" },
+    { IIntentionIpcCode::COMMAND_IS_PARALLEL_FEATURE_ENABLED, "IsParallelFeatureEnabled", "OnScreen" },
+    { IIntentionIpcCode::COMMAND_LISTEN_LIVE_BROADCAST, "ListenLiveBroadcast", "OnScreen" },
+    { IIntentionIpcCode::COMMAND_GET_LIVE_STATUS, "GetLiveStatus", "OnScreen" },
+    { IIntentionIpcCode::COMMAND_REGISTER_AWARENESS_CALLBACK, "RegisterAwarenessCallback", "OnScreen" },
+    { IIntentionIpcCode::COMMAND_UNREGISTER_AWARENESS_CALLBACK, "UnregisterAwarenessCallback", "OnScreen" },
+    { IIntentionIpcCode::COMMAND_TRIGGER, "Trigger", "OnScreen" },
+    { IIntentionIpcCode::COMMAND_SUBSCRIBE_CAPABILITY, "SubscribeCapability", "CarAwareness" },
+    { IIntentionIpcCode::COMMAND_UN_SUBSCRIBE_CAPABILITY, "UnSubscribeCapability", "CarAwareness" },
+    { IIntentionIpcCode::COMMAND_UPDATE_SPATIAL_ACTION_STATUS, "UpdateSpatialActionStatus", "CarAwareness" },
+    { IIntentionIpcCode::COMMAND_UPDATE_SPATIAL_ACTION_ZONE, "UpdateSpatialActionZone", "CarAwareness" },
+    { IIntentionIpcCode::COMMAND_GET_SUPPORT_CAPABILITY_LIST, "GetSupportCapabilityList", "CarAwareness" },
+    { IIntentionIpcCode::COMMAND_GET_CAR_AWARENESS, "GetCarAwareness", "CarAwareness" },
+};
+
+// The generated codes are numbered in IIntention.idl order with no count, so bound them by the first and
+// last methods there, and require one entry per code in the same order.
+constexpr IIntentionIpcCode FIRST_IPC_CODE { IIntentionIpcCode::COMMAND_SOCKET };
+constexpr IIntentionIpcCode LAST_IPC_CODE { IIntentionIpcCode::COMMAND_GET_CAR_AWARENESS };
+
+constexpr bool IsIpcMethodInfosInCodeOrder()
+{
+    for (size_t index = 0; index < std::size(IPC_METHOD_INFOS); ++index) {
+        if (static_cast<size_t>(IPC_METHOD_INFOS[index].code) != static_cast<size_t>(FIRST_IPC_CODE) + index) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static_assert(std::size(IPC_METHOD_INFOS) ==
+    static_cast<size_t>(LAST_IPC_CODE) - static_cast<size_t>(FIRST_IPC_CODE) + 1,
+    "IPC_METHOD_INFOS must have one entry for each method of IIntention.idl");
+static_assert(IsIpcMethodInfosInCodeOrder(), "IPC_METHOD_INFOS must follow the method order of IIntention.idl");
 };
 IntentionService::IntentionService(IContext *context)
     : context_(context), socketServer_(context),
@@ -47,6 +154,9 @@ IntentionService::IntentionService(IContext *context)
     drag_(context), dumper_(context, stationary_), boomerangDumper_(context, boomerang_)
 {
     (void) context_;
+    for (const auto &info : IPC_METHOD_INFOS) {
+        IpcStatistics::GetInstance().RegisterMethod(static_cast<uint32_t>(info.code), info.method, info.server);
+    }
 }
 
 // public
@@ -67,6 +177,24 @@ CallingContext IntentionService::GetCallingContext()
     return context;
 }
 
+int32_t IntentionService::OnRemoteRequest(uint32_t code, MessageParcel &data, MessageParcel &reply,
+    MessageOption &option)
+{
+    auto begin = std::chrono::steady_clock::now();
+    int32_t ret = IntentionStub::OnRemoteRequest(code, data, reply, option);
+    int64_t costTime = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - begin).count();
+    // The stub writes the result of the method ahead of any output parameter.
+    int32_t result = ret;
+    if ((ret == ERR_NONE) && (reply.GetDataSize() >= sizeof(int32_t))) {
+        size_t readPos = reply.GetReadPosition();
+        result = reply.ReadInt32();
+        reply.RewindRead(readPos);
+    }
+    IpcStatistics::GetInstance().Record(code, costTime, result);
+    return ret;
+}
+
 void IntentionService::PrintCallingContext(const CallingContext &context)
 {
     FI_HILOGI("fullTokenId:%{public}" PRIu64 ", tokenId:%{public}d, uid:%{public}d, pid:%{public}d",
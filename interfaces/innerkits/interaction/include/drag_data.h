@@ -58,6 +58,98 @@ struct ShadowInfo {
     }
 };
 
+constexpr int32_t DRAG_STYLE_PARAMS_VERSION { 1 };
+
+enum DragFilterField : uint32_t {
+    DRAG_FILTER_DIP_SCALE = 1U << 0,
+    DRAG_FILTER_SCALE = 1U << 1,
+    DRAG_FILTER_BLUR_RADIUS = 1U << 2,
+    DRAG_FILTER_EVENT_ID = 1U << 3,
+};
+
+// Typed form of DragData::filterInfo. Fields missing from the JSON keep their defaults, and fieldMask
+// tells which of the fields in DragFilterField were present.
+struct DragFilterParams {
+    std::string dragType;
+    std::string shadowPath;
+    uint32_t fieldMask { 0 };
+    bool shadowEnable { false };
+    bool shadowIsFilled { false };
+    bool shadowMask { false };
+    bool isHardwareAcceleration { false };
+    bool enableAnimation { false };
+    int32_t shadowColorStrategy { 0 };
+    int32_t blurStyle { -1 };
+    int32_t eventId { -1 };
+    uint32_t shadowArgb { 0 };
+    uint32_t blurColor { 0 };
+    float dipScale { 0.0f };
+    float scale { 1.0f };
+    float cornerRadius1 { 0.0f };
+    float cornerRadius2 { 0.0f };
+    float cornerRadius3 { 0.0f };
+    float cornerRadius4 { 0.0f };
+    float opacity { 0.95f };
+    float shadowOffsetX { 0.0f };
+    float shadowOffsetY { 0.0f };
+    float shadowCorner { 0.0f };
+    float shadowElevation { 0.0f };
+    float blurCoef1 { 0.0f };
+    float blurCoef2 { 0.0f };
+    float blurRadius { -1.0f };
+    float blurSaturation { -1.0f };
+    float blurBrightness { -1.0f };
+    float dragNodeGrayscale { 0.0f };
+
+    bool operator == (const DragFilterParams &other) const
+    {
+        return dragType == other.dragType && shadowPath == other.shadowPath && fieldMask == other.fieldMask &&
+               shadowEnable == other.shadowEnable && shadowIsFilled == other.shadowIsFilled &&
+               shadowMask == other.shadowMask && isHardwareAcceleration == other.isHardwareAcceleration &&
+               enableAnimation == other.enableAnimation && shadowColorStrategy == other.shadowColorStrategy &&
+               blurStyle == other.blurStyle && eventId == other.eventId && shadowArgb == other.shadowArgb &&
+               blurColor == other.blurColor && dipScale == other.dipScale && scale == other.scale &&
+               cornerRadius1 == other.cornerRadius1 && cornerRadius2 == other.cornerRadius2 &&
+               cornerRadius3 == other.cornerRadius3 && cornerRadius4 == other.cornerRadius4 &&
+               opacity == other.opacity && shadowOffsetX == other.shadowOffsetX &&
+               shadowOffsetY == other.shadowOffsetY && shadowCorner == other.shadowCorner &&
+               shadowElevation == other.shadowElevation && blurCoef1 == other.blurCoef1 &&
+               blurCoef2 == other.blurCoef2 && blurRadius == other.blurRadius &&
+               blurSaturation == other.blurSaturation && blurBrightness == other.blurBrightness &&
+               dragNodeGrayscale == other.dragNodeGrayscale;
+    }
+
+    bool operator != (const DragFilterParams &other) const
+    {
+        return !(*this == other);
+    }
+};
+
+// Typed form of DragData::extraInfo.
+struct DragExtraParams {
+    std::string componentType;
+    std::vector<int32_t> dropArea;
+    bool hasDropArea { false };
+    bool allowDistributed { true };
+    int32_t blurStyle { -1 };
+    float cornerRadius { 0.0f };
+    float blurCoef1 { 0.0f };
+    float blurCoef2 { 0.0f };
+
+    bool operator == (const DragExtraParams &other) const
+    {
+        return componentType == other.componentType && dropArea == other.dropArea &&
+               hasDropArea == other.hasDropArea && allowDistributed == other.allowDistributed &&
+               blurStyle == other.blurStyle && cornerRadius == other.cornerRadius &&
+               blurCoef1 == other.blurCoef1 && blurCoef2 == other.blurCoef2;
+    }
+
+    bool operator != (const DragExtraParams &other) const
+    {
+        return !(*this == other);
+    }
+};
+
 struct DragData {
     std::vector<ShadowInfo> shadowInfos;
     std::vector<uint8_t> buffer;
@@ -86,6 +178,10 @@ struct DragData {
     int32_t dragAnimationType { -1 };
     std::string appCallee;
     std::string appCaller;
+    // DRAG_STYLE_PARAMS_VERSION once filterInfo and extraInfo are parsed into filterParams and extraParams.
+    int32_t styleParamsVersion { 0 };
+    DragFilterParams filterParams;
+    DragExtraParams extraParams;
 
     bool operator == (const DragData &other) const
     {
@@ -99,7 +195,9 @@ struct DragData {
                detailedSummarys == other.detailedSummarys && summaryFormat == other.summaryFormat &&
                summaryTotalSize == other.summaryTotalSize && summaryVersion == other.summaryVersion &&
                summaryTag == other.summaryTag && materialId == other.materialId &&
-               isSetMaterialFilter == other.isSetMaterialFilter && dragAnimationType == other.dragAnimationType;
+               isSetMaterialFilter == other.isSetMaterialFilter && dragAnimationType == other.dragAnimationType &&
+               styleParamsVersion == other.styleParamsVersion && filterParams == other.filterParams &&
+               extraParams == other.extraParams;
     }
 
     bool operator != (const DragData &other) const
@@ -16,14 +16,24 @@
 #ifndef DEVICESTATUS_DATA_PARSE_H
 #define DEVICESTATUS_DATA_PARSE_H
 
+#include <atomic>
+#include <mutex>
 #include <string>
 #include <vector>
 
+#include "cJSON.h"
+
 #include "stationary_data.h"
 
 namespace OHOS {
 namespace Msdp {
 namespace DeviceStatus {
+struct MockTimelineEvent {
+    int64_t timeMs { 0 };
+    Type type { TYPE_INVALID };
+    OnChangedValue value { VALUE_INVALID };
+};
+
 class DeviceStatusDataParse {
 public:
     DeviceStatusDataParse() = default;
@@ -32,14 +42,34 @@ public:
     bool DisableCount(const Type type);
     bool DeviceStatusDataInit(const std::string &fileData, bool logStatus, Type &type, Data &data);
     int32_t CreateJsonFile();
+    bool LoadDeviceStatusData(const std::string &fileData);
+    void InvalidateData();
+    bool HasTimeline();
+    bool IsTimelineLoop() const;
+    std::vector<MockTimelineEvent> GetTimeline() const;
 
 private:
+    struct MockValue {
+        bool isNumber { false };
+        OnChangedValue value { VALUE_INVALID };
+    };
+
     bool CheckFileDir(const std::string &filePath, const std::string &dir);
     bool CheckFileSize(const std::string &filePath);
     bool CheckFileExtendName(const std::string &filePath, const std::string &checkExtension);
     std::string ReadFile(const std::string &filePath);
     std::string ReadJsonFile(const std::string &filePath);
+    bool ReloadIfNeeded();
+    void ParseTimeline(const cJSON *json);
+    bool GetNextData(Type type, Data &data);
     static std::vector<int32_t> tempcount_;
+
+    mutable std::mutex mutex_;
+    std::atomic<bool> dirty_ { true };
+    bool hasData_ { false };
+    std::vector<std::vector<MockValue>> table_;
+    std::vector<MockTimelineEvent> timeline_;
+    bool timelineLoop_ { false };
 };
 } // namespace DeviceStatus
 } // namespace Msdp
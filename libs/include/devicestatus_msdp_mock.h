@@ -17,6 +17,7 @@
 #define DEVICESTATUS_MSDP_MOCK_H
 
 #include <atomic>
+#include <chrono>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -34,7 +35,8 @@ class DeviceStatusMsdpMock final : public IMsdp {
 public:
     enum EventType {
         EVENT_UEVENT_FD,
-        EVENT_TIMER_FD
+        EVENT_TIMER_FD,
+        EVENT_INOTIFY_FD
     };
 
     DeviceStatusMsdpMock();
@@ -43,9 +45,15 @@ public:
     bool Init();
     void InitMockStore();
     int32_t SetTimerInterval(int32_t interval);
+    int32_t SetTimerTimeout(int64_t timeoutMs);
     void CloseTimer();
     void InitTimer();
     void TimerCallback();
+    void InitInotify();
+    void CloseInotify();
+    void InotifyCallback();
+    void StartTimeline();
+    void EmitTimeline();
     int32_t RegisterTimerCallback(int32_t fd, const EventType et);
     void StartThread();
     void LoopingThreadEntry();
@@ -70,6 +78,11 @@ private:
     int32_t timerInterval_ { -1 };
     int32_t timerFd_ { -1 };
     int32_t epFd_ { -1 };
+    int32_t inotifyFd_ { -1 };
+    std::vector<MockTimelineEvent> timeline_;
+    size_t timelineIndex_ { 0 };
+    bool timelineLoop_ { false };
+    std::chrono::steady_clock::time_point timelineStart_;
     std::mutex mutex_;
     std::vector<Type> enabledType_;
     std::atomic<bool> alive_ { false };
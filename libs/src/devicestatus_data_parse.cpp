@@ -21,6 +21,7 @@
 #include <sys/stat.h>
 
 #include "devicestatus_data_define.h"
+#include "devicestatus_define.h"
 #include "devicestatus_errors.h"
 #include "fi_log.h"
 #include "json_parser.h"
@@ -68,60 +69,178 @@ int32_t DeviceStatusDataParse::CreateJsonFile()
 
 bool DeviceStatusDataParse::ParseDeviceStatusData(Type type, Data& data)
 {
-    std::string jsonBuf = ReadJsonFile(MSDP_DATA_PATH.c_str());
-    if (jsonBuf.empty()) {
-        FI_HILOGE("Read json failed, errno:%{public}d", errno);
+    if (!ReloadIfNeeded()) {
+        FI_HILOGE("Mock data is not loaded");
         data.type = type;
         data.value = OnChangedValue::VALUE_INVALID;
         return false;
     }
-    return DeviceStatusDataInit(jsonBuf, true, type, data);
+    return GetNextData(type, data);
 }
 
 bool DeviceStatusDataParse::DeviceStatusDataInit(const std::string& fileData, bool logStatus, Type& type,
     Data& data)
 {
     CALL_DEBUG_ENTER;
-    JsonParser parser(fileData.c_str());
     data.type = type;
     data.value = OnChangedValue::VALUE_INVALID;
+    if (!LoadDeviceStatusData(fileData)) {
+        return false;
+    }
+    return GetNextData(type, data);
+}
+
+bool DeviceStatusDataParse::LoadDeviceStatusData(const std::string &fileData)
+{
+    CALL_DEBUG_ENTER;
+    JsonParser parser(fileData.c_str());
+    std::lock_guard lock(mutex_);
+    table_.assign(static_cast<size_t>(Type::TYPE_MAX), {});
+    timeline_.clear();
+    timelineLoop_ = false;
+    hasData_ = false;
     if (cJSON_IsArray(parser.Get())) {
         FI_HILOGE("parser is array");
         return false;
     }
+    for (int32_t type = Type::TYPE_ABSOLUTE_STILL; type < Type::TYPE_MAX; ++type) {
+        cJSON* mockarray = cJSON_GetObjectItem(parser.Get(), DeviceStatusJson[type].json.c_str());
+        if (!cJSON_IsArray(mockarray)) {
+            continue;
+        }
+        int32_t jsonsize = cJSON_GetArraySize(mockarray);
+        for (int32_t i = 0; i < jsonsize; ++i) {
+            cJSON* mockvalue = cJSON_GetArrayItem(mockarray, i);
+            MockValue value;
+            if (cJSON_IsNumber(mockvalue)) {
+                value.isNumber = true;
+                value.value = static_cast<OnChangedValue>(mockvalue->valueint);
+            }
+            table_[type].push_back(value);
+        }
+    }
+    ParseTimeline(parser.Get());
+    hasData_ = true;
+    FI_HILOGI("Mock data loaded, timeline size:%{public}zu", timeline_.size());
+    return true;
+}
 
+void DeviceStatusDataParse::ParseTimeline(const cJSON *json)
+{
+    cJSON* timeline = cJSON_GetObjectItem(json, "timeline");
+    if (!cJSON_IsObject(timeline)) {
+        return;
+    }
+    JsonParser::ParseBool(timeline, "loop", timelineLoop_);
+    cJSON* events = cJSON_GetObjectItem(timeline, "events");
+    if (!cJSON_IsArray(events)) {
+        FI_HILOGE("Timeline events is not array");
+        return;
+    }
+    int32_t eventSize = cJSON_GetArraySize(events);
+    int64_t lastTime = 0;
+    for (int32_t i = 0; i < eventSize; ++i) {
+        cJSON* event = cJSON_GetArrayItem(events, i);
+        int32_t time = 0;
+        int32_t type = Type::TYPE_INVALID;
+        int32_t value = OnChangedValue::VALUE_INVALID;
+        if ((JsonParser::ParseInt32(event, "time", time) != RET_OK) ||
+            (JsonParser::ParseInt32(event, "type", type) != RET_OK) ||
+            (JsonParser::ParseInt32(event, "value", value) != RET_OK)) {
+            FI_HILOGW("Skip malformed timeline event:%{public}d", i);
+            continue;
+        }
+        if ((type <= Type::TYPE_INVALID) || (type >= Type::TYPE_MAX) || (time < lastTime)) {
+            FI_HILOGW("Skip invalid timeline event:%{public}d", i);
+            continue;
+        }
+        lastTime = time;
+        timeline_.push_back(MockTimelineEvent {
+            .timeMs = time,
+            .type = static_cast<Type>(type),
+            .value = static_cast<OnChangedValue>(value),
+        });
+    }
+}
+
+bool DeviceStatusDataParse::GetNextData(Type type, Data &data)
+{
+    data.type = type;
+    data.value = OnChangedValue::VALUE_INVALID;
     if (type < Type::TYPE_ABSOLUTE_STILL || type >= Type::TYPE_MAX) {
         FI_HILOGE("type error");
         return false;
     }
-
-    cJSON* mockarray = cJSON_GetObjectItem(parser.Get(), DeviceStatusJson[type].json.c_str());
-    if (!cJSON_IsArray(mockarray)) {
-        FI_HILOGE("mockarray is not array");
+    std::lock_guard lock(mutex_);
+    if (static_cast<size_t>(type) >= table_.size()) {
+        FI_HILOGE("Mock data is not loaded");
         return false;
     }
-    int32_t jsonsize = cJSON_GetArraySize(mockarray);
-    if (jsonsize == 0) {
+    const auto &values = table_[type];
+    if (values.empty()) {
         FI_HILOGE("Json size is zero");
         return false;
     }
+    int32_t jsonsize = static_cast<int32_t>(values.size());
     tempcount_[type] = tempcount_[type] % jsonsize;
-    cJSON* mockvalue = cJSON_GetArrayItem(mockarray, tempcount_[type]);
-    if (mockvalue == nullptr) {
-        FI_HILOGE("Json parser number is failed");
-        return false;
-    }
+    const MockValue &mockvalue = values[tempcount_[type]];
     tempcount_[type]++;
-    data.type = type;
-    if (!cJSON_IsNumber(mockvalue)) {
+    if (!mockvalue.isNumber) {
         FI_HILOGE("Json parser number is failed");
         return false;
     }
-    data.value = static_cast<OnChangedValue>(mockvalue->valueint);
+    data.value = mockvalue.value;
     FI_HILOGD("type:%{public}d, status:%{public}d", data.type, data.value);
     return true;
 }
 
+bool DeviceStatusDataParse::ReloadIfNeeded()
+{
+    if (!dirty_.load()) {
+        std::lock_guard lock(mutex_);
+        return hasData_;
+    }
+    // Cleared up front so that a change arriving during the load is not lost, restored if the load fails.
+    dirty_.store(false);
+    std::string jsonBuf = ReadJsonFile(MSDP_DATA_PATH.c_str());
+    if (jsonBuf.empty()) {
+        std::lock_guard lock(mutex_);
+        hasData_ = false;
+        dirty_.store(true);
+        return false;
+    }
+    if (!LoadDeviceStatusData(jsonBuf)) {
+        dirty_.store(true);
+        return false;
+    }
+    return true;
+}
+
+void DeviceStatusDataParse::InvalidateData()
+{
+    FI_HILOGI("Mock data file changed");
+    dirty_.store(true);
+}
+
+bool DeviceStatusDataParse::HasTimeline()
+{
+    ReloadIfNeeded();
+    std::lock_guard lock(mutex_);
+    return !timeline_.empty();
+}
+
+bool DeviceStatusDataParse::IsTimelineLoop() const
+{
+    std::lock_guard lock(mutex_);
+    return timelineLoop_;
+}
+
+std::vector<MockTimelineEvent> DeviceStatusDataParse::GetTimeline() const
+{
+    std::lock_guard lock(mutex_);
+    return timeline_;
+}
+
 bool DeviceStatusDataParse::DisableCount(const Type type)
 {
     CALL_DEBUG_ENTER;
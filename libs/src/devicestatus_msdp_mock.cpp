@@ -15,11 +15,13 @@
 
 #include "devicestatus_msdp_mock.h"
 
+#include <algorithm>
 #include <cerrno>
 #include <string>
 #include <unistd.h>
 
 #include <sys/epoll.h>
+#include <sys/inotify.h>
 #include <sys/timerfd.h>
 
 #include "devicestatus_common.h"
@@ -37,6 +39,13 @@ namespace {
 constexpr int32_t TIMER_INTERVAL { 3 };
 constexpr int32_t ERR_INVALID_FD { -1 };
 constexpr uint64_t DOMAIN_ID { 0xD002220 };
+constexpr int64_t NANOS_PER_MILLI { 1000000 };
+constexpr int64_t MILLIS_PER_SECOND { 1000 };
+// A looped timeline restarts no more often than this, one with every event at time 0 would spin otherwise.
+constexpr int64_t MIN_TIMELINE_PERIOD_MS { 100 };
+constexpr size_t INOTIFY_BUF_SIZE { 1024 };
+const std::string MSDP_DATA_DIR { "/data/msdp" };
+const std::string MSDP_DATA_NAME { "device_status_data.json" };
 DeviceStatusMsdpMock* g_msdpMock { nullptr };
 } // namespace
 
@@ -57,6 +66,7 @@ DeviceStatusMsdpMock::~DeviceStatusMsdpMock()
     callbacks_.clear();
     alive_ = false;
     CloseTimer();
+    CloseInotify();
     if (thread_.joinable()) {
         thread_.join();
         FI_HILOGI("thread_ is stop");
@@ -97,6 +107,7 @@ ErrCode DeviceStatusMsdpMock::Disable(Type type)
     CALL_DEBUG_ENTER;
     alive_ = false;
     CloseTimer();
+    CloseInotify();
     if (thread_.joinable()) {
         thread_.join();
         FI_HILOGI("thread_ is stop");
@@ -151,6 +162,115 @@ void DeviceStatusMsdpMock::InitTimer()
         FI_HILOGE("Register timer fd failed");
         return;
     }
+    InitInotify();
+    if ((dataParse_ != nullptr) && dataParse_->HasTimeline()) {
+        StartTimeline();
+    }
+}
+
+void DeviceStatusMsdpMock::InitInotify()
+{
+    CALL_DEBUG_ENTER;
+    CloseInotify();
+    inotifyFd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (inotifyFd_ == ERR_INVALID_FD) {
+        FI_HILOGE("Create inotify fd failed, errno:%{public}d", errno);
+        return;
+    }
+    fdsan_exchange_owner_tag(inotifyFd_, 0, DOMAIN_ID);
+    if (inotify_add_watch(inotifyFd_, MSDP_DATA_DIR.c_str(),
+        IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE | IN_DELETE) == -1) {
+        FI_HILOGE("Watch mock data dir failed, errno:%{public}d", errno);
+        CloseInotify();
+        return;
+    }
+    auto [_, ret] = callbacks_.insert(std::make_pair(inotifyFd_, &DeviceStatusMsdpMock::InotifyCallback));
+    if (!ret) {
+        FI_HILOGW("Insert inotify fd failed");
+    }
+    if (RegisterTimerCallback(inotifyFd_, EVENT_INOTIFY_FD)) {
+        FI_HILOGE("Register inotify fd failed");
+    }
+}
+
+void DeviceStatusMsdpMock::CloseInotify()
+{
+    if (inotifyFd_ < 0) {
+        return;
+    }
+    callbacks_.erase(inotifyFd_);
+    if (fdsan_close_with_tag(inotifyFd_, DOMAIN_ID) < 0) {
+        FI_HILOGE("Close inotify fd failed, error:%{public}s, inotifyFd_:%{public}d", strerror(errno), inotifyFd_);
+    }
+    inotifyFd_ = -1;
+}
+
+void DeviceStatusMsdpMock::InotifyCallback()
+{
+    char buf[INOTIFY_BUF_SIZE] __attribute__((aligned(__alignof__(struct inotify_event)))) {};
+    bool changed = false;
+    ssize_t len = 0;
+    while ((len = read(inotifyFd_, buf, sizeof(buf))) > 0) {
+        for (char *ptr = buf; ptr < buf + len;) {
+            auto event = reinterpret_cast<struct inotify_event *>(ptr);
+            if ((event->len > 0) && (MSDP_DATA_NAME == event->name)) {
+                changed = true;
+            }
+            ptr += sizeof(struct inotify_event) + event->len;
+        }
+    }
+    if (!changed) {
+        return;
+    }
+    CHKPV(dataParse_);
+    dataParse_->InvalidateData();
+    if (dataParse_->HasTimeline()) {
+        StartTimeline();
+    } else if (!timeline_.empty()) {
+        timeline_.clear();
+        SetTimerInterval(TIMER_INTERVAL);
+    }
+}
+
+void DeviceStatusMsdpMock::StartTimeline()
+{
+    CHKPV(dataParse_);
+    timeline_ = dataParse_->GetTimeline();
+    timelineLoop_ = dataParse_->IsTimelineLoop();
+    timelineIndex_ = 0;
+    timelineStart_ = std::chrono::steady_clock::now();
+    if (timeline_.empty()) {
+        return;
+    }
+    FI_HILOGI("Start mock timeline, size:%{public}zu, loop:%{public}d", timeline_.size(), timelineLoop_);
+    SetTimerTimeout(timeline_.front().timeMs);
+}
+
+void DeviceStatusMsdpMock::EmitTimeline()
+{
+    int64_t elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - timelineStart_).count();
+    while ((timelineIndex_ < timeline_.size()) && (timeline_[timelineIndex_].timeMs <= elapsed)) {
+        Data data;
+        data.type = timeline_[timelineIndex_].type;
+        data.value = timeline_[timelineIndex_].value;
+        NotifyMsdpImpl(data);
+        ++timelineIndex_;
+    }
+    if (timelineIndex_ < timeline_.size()) {
+        SetTimerTimeout(timeline_[timelineIndex_].timeMs - elapsed);
+        return;
+    }
+    if (timelineLoop_) {
+        int64_t period = std::max(timeline_.back().timeMs, MIN_TIMELINE_PERIOD_MS);
+        if (elapsed < period) {
+            SetTimerTimeout(period - elapsed);
+            return;
+        }
+        StartTimeline();
+    } else {
+        FI_HILOGI("Mock timeline finished");
+    }
 }
 
 int32_t DeviceStatusMsdpMock::SetTimerInterval(int32_t interval)
@@ -176,6 +296,28 @@ int32_t DeviceStatusMsdpMock::SetTimerInterval(int32_t interval)
     return RET_OK;
 }
 
+int32_t DeviceStatusMsdpMock::SetTimerTimeout(int64_t timeoutMs)
+{
+    if (timerFd_ == ERR_INVALID_FD) {
+        FI_HILOGE("Create timer fd failed");
+        return RET_ERR;
+    }
+    if (timeoutMs < 0) {
+        timeoutMs = 0;
+    }
+    struct itimerspec itval {};
+    itval.it_value.tv_sec = timeoutMs / MILLIS_PER_SECOND;
+    itval.it_value.tv_nsec = (timeoutMs % MILLIS_PER_SECOND) * NANOS_PER_MILLI;
+    if ((itval.it_value.tv_sec == 0) && (itval.it_value.tv_nsec == 0)) {
+        itval.it_value.tv_nsec = 1;
+    }
+    if (timerfd_settime(timerFd_, 0, &itval, nullptr) == -1) {
+        FI_HILOGE("Set timer failed");
+        return RET_ERR;
+    }
+    return RET_OK;
+}
+
 void DeviceStatusMsdpMock::CloseTimer()
 {
     if (timerFd_ < 0) {
@@ -195,6 +337,10 @@ void DeviceStatusMsdpMock::TimerCallback()
         FI_HILOGE("Read timer fd failed");
         return;
     }
+    if (!timeline_.empty()) {
+        EmitTimeline();
+        return;
+    }
     GetDeviceStatusData();
 }
 
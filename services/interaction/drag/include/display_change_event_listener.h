@@ -47,10 +47,12 @@ private:
     sptr<Rosen::DisplayInfo> GetDisplayInfo(Rosen::DisplayId displayId);
     void HandleScreenRotation(Rosen::DisplayId displayId, Rosen::Rotation rotation);
     void ProcessDisplayEvent(Rosen::DisplayId displayId);
+    Rosen::FoldStatus GetFoldStatus() const;
 
 private:
     IContext *context_ { nullptr };
     std::atomic_bool isFoldPC_ { false };
+    bool isFoldable_ { false };
 };
 
 class DisplayAbilityStatusChange : public SystemAbilityStatusChangeStub {
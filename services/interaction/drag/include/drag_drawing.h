@@ -16,9 +16,13 @@
 #ifndef DRAG_DRAWING_H
 #define DRAG_DRAWING_H
 
+#include <map>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <vector>
 #include <shared_mutex>
+#include <thread>
 
 #include "display_manager.h"
 #include "event_handler.h"
@@ -33,6 +37,7 @@
 #include "vsync_receiver.h"
 
 #include "drag_data.h"
+#include "drag_frame_recorder.h"
 #include "drag_smooth_processor.h"
 #include "drag_vsync_station.h"
 #ifndef OHOS_BUILD_ENABLE_ARKUI_X
@@ -212,6 +217,14 @@ struct DragWindowRotationInfo {
     float pivotY { 0.0f };
 };
 
+struct DropAnimationInfo {
+    std::optional<bool> cubicCurveEnable;
+    std::optional<bool> springEnable;
+    std::vector<float> dropAnimationCurve;
+    std::vector<float> dropPosition;
+    std::vector<float> dropSize;
+};
+
 class DragDrawing : public IDragAnimation {
 public:
     DragDrawing() = default;
@@ -242,7 +255,18 @@ public:
 #ifndef OHOS_BUILD_ENABLE_ARKUI_X
     void OnDragSuccess(IContext* context);
     void OnDragFail(IContext* context, bool isLongPressDrag);
+    void StartVSyncSession();
     void StopVSyncStation();
+    void DumpVSyncStation(int32_t fd) const;
+    void DumpFrameRecorder(int32_t fd, bool raw) const;
+    // Loads the optional libraries, decodes the default style icons for @isRTL and pre-parses the drop
+    // animation curve ahead of the first drag, on a low-priority worker. Only the caches are filled, the
+    // drawing state is left alone.
+    void WarmUp(bool isRTL);
+    void ReleaseWarmUpCache();
+    void DumpWarmUp(int32_t fd) const;
+    // Layers of the multi-select stack and the memory taken by their pixel maps.
+    void DumpSelectedStack(int32_t fd) const;
     void SetDragStyleRTL(bool isRTL);
 #else
     void OnDragSuccess();
@@ -311,6 +335,7 @@ public:
 
 private:
     bool ParserDragAnimationInfo(std::string dragAnimationInfo);
+    static bool ParseDropAnimationInfo(const std::string &dragAnimationInfo, DropAnimationInfo &info);
     int32_t CheckDragData(const DragData &dragData);
     int32_t InitLayer();
     void InitCanvas(int32_t width, int32_t height);
@@ -331,24 +356,25 @@ private:
     void UpdateTspanNode(xmlNodePtr curNode);
     int32_t ParseAndAdjustSvgInfo(xmlNodePtr curNode);
     std::shared_ptr<Media::PixelMap> DecodeSvgToPixelMap(const std::string &filePath);
+    std::shared_ptr<Media::PixelMap> DecodeSvgToPixelMap(const std::string &filePath, bool needAdjust,
+        const Media::DecodeOptions &decodeOpts);
+    std::shared_ptr<Media::PixelMap> GetStylePixelMap(const std::string &filePath);
+    std::shared_ptr<Media::PixelMap> GetStyleIcon(const std::string &filePath, float scaling);
     void GetFilePath(std::string &filePath);
     void GetLTRFilePath(std::string &filePath);
     bool NeedAdjustSvgInfo();
     void SetDecodeOptions(Media::DecodeOptions &decodeOpts);
-    bool ParserFilterInfo(const std::string &filterInfoStr, FilterInfo &filterInfo);
-    void ParserCornerRadiusInfo(const cJSON *cornerRadiusInfoStr, FilterInfo &filterInfo);
-    void ParserBlurInfo(const cJSON *BlurInfoInfoStr, FilterInfo &filterInfo);
+    void InitStyleParams(const DragData &dragData);
+    void ApplyFilterParams(const DragFilterParams &filterParams, FilterInfo &filterInfo);
     void OnSetCustomDragBlur(const FilterInfo &filterInfo, std::shared_ptr<Rosen::RSCanvasNode> filterNode);
     void SetCustomDragBlur(const FilterInfo &filterInfo, std::shared_ptr<Rosen::RSCanvasNode> filterNode);
     void OnSetComponentDragBlur(const FilterInfo &filterInfo, const ExtraInfo &extraInfo,
         std::shared_ptr<Rosen::RSCanvasNode> filterNode);
     void SetComponentDragBlur(const FilterInfo &filterInfo, const ExtraInfo &extraInfo,
         std::shared_ptr<Rosen::RSCanvasNode> filterNode);
-    void ParserDragShadowInfo(const cJSON* filterInfoParser, FilterInfo &filterInfo);
-    void ParserTextDragShadowInfo(const cJSON* filterInfoParser, FilterInfo &filterInfo);
     void PrintDragShadowInfo();
     void ProcessFilter();
-    bool ParserExtraInfo(const std::string &extraInfoStr, ExtraInfo &extraInfo);
+    bool ApplyExtraParams(const DragExtraParams &extraParams, ExtraInfo &extraInfo);
     static float RadiusVp2Sigma(float radiusVp, float dipScale);
     void DoDrawMouse(int32_t mousePositionX, int32_t mousePositionY);
     void UpdateMousePosition(float mousePositionX, float mousePositionY);
@@ -364,6 +390,12 @@ private:
         bool isMultiSelectedAnimation = true);
     void InitMultiSelectedNodes();
     void ClearMultiSelectedData();
+    void FoldSelectedPixelMaps();
+    void UpdateShadowMemoryStat();
+#ifndef OHOS_BUILD_ENABLE_ARKUI_X
+    // Coalesces the transactions of pixel maps added within one frame into one flush.
+    void RequestSelectedFlush();
+#endif // OHOS_BUILD_ENABLE_ARKUI_X
     bool ParserRadius(float &radius);
     void OnStopAnimationSuccess();
     void OnStopAnimationFail();
@@ -390,6 +422,8 @@ private:
 #ifndef OHOS_BUILD_ENABLE_ARKUI_X
     std::shared_ptr<AppExecFwk::EventHandler> GetSuperHubHandler();
     void GetRTLFilePath(std::string &filePath);
+    static std::string GetStyleIconPath(DragCursorStyle style, bool isRTL);
+    void RunWarmUp(bool isRTL);
 #endif // OHOS_BUILD_ENABLE_ARKUI_X
     void LoadNewMaterialLib();
     void UnloadNewMaterialLib();
@@ -423,7 +457,7 @@ private:
     void DrawContentLight();
     void DoFollowHandAnimation(const float &displayX, const float &displayY);
     void CalculateLightIntensity(float degreeX, float degreeY, LightIntensity &lightIntensity);
-    bool ParseDropArea(JsonParser &jsonParser);
+    bool ParseDropArea(const DragExtraParams &extraParams);
     void ResetDragAnimationParameter();
     bool IsInitUIDirector();
 private:
@@ -471,7 +505,17 @@ private:
     ScreenSizeType currentScreenSize_ = ScreenSizeType::UNDEFINED;
     MMI::PointerStyle pointerStyle_;
     DragVSyncStation vSyncStation_;
-    DragSmoothProcessor dragSmoothProcessor_;
+    DragSmoothProcessor dragSmoothProcessor_ { DragSmoothConfig::Load() };
+#ifndef OHOS_BUILD_ENABLE_ARKUI_X
+    DragFrameRecorder frameRecorder_;
+    std::shared_ptr<DragFrameCallback> selectedFlushCallback_ { nullptr };
+    std::atomic<uint32_t> addedSelectedCount_ { 0 };
+    std::atomic<uint32_t> selectedFlushCount_ { 0 };
+#endif // OHOS_BUILD_ENABLE_ARKUI_X
+    std::atomic<size_t> stackedLayerNum_ { 0 };
+    std::atomic<size_t> foldedSelectedNum_ { 0 };
+    std::atomic<uint64_t> shadowMemoryBytes_ { 0 };
+    std::atomic<uint64_t> peakShadowMemoryBytes_ { 0 };
     std::shared_ptr<DragFrameCallback> frameCallback_ { nullptr };
     std::atomic_bool isRunningRotateAnimation_ { false };
     DragWindowRotationInfo DragWindowRotateInfo_;
@@ -484,6 +528,18 @@ private:
     std::shared_ptr<OHOS::Rosen::Filter> materialFilter_ { nullptr };
     void* newMaterialHandler_ { nullptr };
     SetMaterialEffectByIdFunc setMaterialEffectByIdFunc_ { nullptr };
+    DragStartExtFunc dragStartExtFunc_ { nullptr };
+    DragNotifyExtFunc dragNotifyExtFunc_ { nullptr };
+    // Serializes loading and unloading of the optional libraries with the warm-up worker.
+    std::mutex libMutex_;
+#ifndef OHOS_BUILD_ENABLE_ARKUI_X
+    std::atomic<int64_t> warmUpCostUs_ { -1 };
+    std::thread warmUpThread_;
+#endif // OHOS_BUILD_ENABLE_ARKUI_X
+    // Decoded style icons that do not depend on the number of dragged items, valid for styleIconScaling_.
+    mutable std::mutex styleIconMutex_;
+    std::map<std::string, std::shared_ptr<Media::PixelMap>> styleIconCache_;
+    float styleIconScaling_ { 0.0f };
     int32_t dragAnimationType_ { 0 };
     std::atomic_bool cubicCurveEnable_ { false };
     std::atomic_bool springEnable_ { false };
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DRAG_FRAME_RECORDER_H
+#define DRAG_FRAME_RECORDER_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "nocopyable.h"
+
+#include "drag_smooth_filter.h"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+enum DragFrameFlag : uint32_t {
+    // More than one vsync passed between the frame request and its callback.
+    DRAG_FRAME_MISSED_VSYNC = 1U << 0,
+    // Flushing the frame took longer than a vsync period.
+    DRAG_FRAME_LATE = 1U << 1,
+    // The latest move event was more than two vsync periods old when the frame was drawn, although a move
+    // arrived between the two previous frames.
+    DRAG_FRAME_INPUT_STARVED = 1U << 2,
+};
+
+// Timestamps of one frame of a drag on CLOCK_MONOTONIC in nanoseconds, from the move event to the
+// transaction sent to render service.
+struct DragFrameRecord {
+    uint64_t inputTime { 0 };
+    uint64_t requestTime { 0 };
+    uint64_t sampleTime { 0 };
+    uint64_t vsyncTime { 0 };
+    uint64_t flushTime { 0 };
+    float displayX { 0.0f };
+    float displayY { 0.0f };
+    uint32_t dragId { 0 };
+    uint32_t flags { 0 };
+};
+
+// Always-on recorder of drag frame timing. Frames of the current and previous drags are kept in
+// a fixed-size ring guarded by a mutex, which the vsync thread takes once per frame and Dump()
+// only for as long as it copies the ring out.
+class DragFrameRecorder final {
+public:
+    static constexpr size_t FRAME_CAPACITY { 1024 };
+    static constexpr size_t MAX_DUMPED_DRAGS { 5 };
+
+    DragFrameRecorder() = default;
+    ~DragFrameRecorder() = default;
+    DISALLOW_COPY_AND_MOVE(DragFrameRecorder);
+
+    void BeginDrag();
+    void EndDrag();
+    // Any thread. Called for each move event, and for each frame requested.
+    void RecordInput(uint64_t inputTime);
+    void RecordRequest();
+    // Vsync thread only. @flushTime is taken after the transaction of the frame was sent.
+    void RecordFrame(uint64_t vsyncTime, uint64_t vSyncPeriod, const DragMoveEvent &sample, uint64_t flushTime);
+    // Summary with percentiles for the current and last drags.
+    void Dump(int32_t fd) const;
+    // Every recorded frame, one per line, oldest first.
+    void DumpRaw(int32_t fd) const;
+    std::vector<DragFrameRecord> GetFrames() const;
+
+    static uint64_t Now();
+
+private:
+    mutable std::mutex mutex_;
+    std::array<DragFrameRecord, FRAME_CAPACITY> frames_ {};
+    uint64_t written_ { 0 };
+    uint64_t lastInputTime_ { 0 };
+    bool inputArrived_ { false };
+    std::atomic<uint32_t> dragId_ { 0 };
+    std::atomic_bool active_ { false };
+    std::atomic<uint64_t> inputTime_ { 0 };
+    std::atomic<uint64_t> requestTime_ { 0 };
+};
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+#endif // DRAG_FRAME_RECORDER_H
@@ -37,6 +37,7 @@
 #include "devicestatus_define.h"
 #include "drag_data.h"
 #include "drag_drawing.h"
+#include "drag_shadow_cache.h"
 #include "id_factory.h"
 #ifndef OHOS_BUILD_ENABLE_ARKUI_X
 #include "event_hub.h"
@@ -90,6 +91,7 @@ public:
     bool ValidateThrowConditions() { return listener_.ValidateThrowConditions(); }
     bool RegisterPullThrowListener() override { return listener_.RegisterPullThrowListener(); }
     bool RegisterVKListener() override { return listener_.RegisterVKListener(); }
+    bool GetListenedFoldStatus(Rosen::FoldStatus &foldStatus) override { return listener_.GetFoldStatus(foldStatus); }
     void RegisterVKeyboard();
     MMI::ExtraData CreatePullThrowExtraData(bool appended, bool drawCursor,
     std::shared_ptr<MMI::PointerEvent> pointerEvent);
@@ -148,6 +150,9 @@ public:
     void SetControlCollaborationVisible(bool visible) override;
 #ifndef OHOS_BUILD_ENABLE_ARKUI_X
     void Dump(int32_t fd) const override;
+    void DumpFrames(int32_t fd) const override;
+    void WarmUp() override;
+    void ReleaseWarmUpCache() override;
     void RegisterStateChange(std::function<void(DragState)> callback) override;
     void UnregisterStateChange() override;
     void RegisterNotifyPullUp(std::function<void(bool)> callback) override;
@@ -200,30 +205,41 @@ public:
     void SetDragWindowScreenId(uint64_t displayId, uint64_t screenId) override;
 #ifndef OHOS_BUILD_ENABLE_ARKUI_X
     int32_t SetMouseDragMonitorState(bool state) override;
-#ifdef OHOS_DRAG_ENABLE_INTERCEPTOR
+    // Pointer events of a drag reach the drag manager through a monitor whenever one is built in, and
+    // go on to apps untouched. Builds with only the interceptor consume them and re-inject them
+    // unchanged, in order, on the input thread.
+    struct PointerEventStats {
+        std::atomic<uint64_t> observed { 0 };
+        std::atomic<uint64_t> reinjected { 0 };
+    };
+
     class InterceptorConsumer : public MMI::IInputEventConsumer {
     public:
-        InterceptorConsumer(std::function<void (std::shared_ptr<MMI::PointerEvent>)> cb)
-            : pointerEventCallback_(cb) {}
+        // @inject puts consumed events back into the input pipeline, InputManager::SimulateInputEvent if not given.
+        InterceptorConsumer(std::function<void (std::shared_ptr<MMI::PointerEvent>)> cb, PointerEventStats &stats,
+            std::function<void (std::shared_ptr<MMI::PointerEvent>)> inject = nullptr)
+            : pointerEventCallback_(cb), injectCallback_(inject), stats_(stats) {}
         void OnInputEvent(std::shared_ptr<MMI::KeyEvent> keyEvent) const override;
         void OnInputEvent(std::shared_ptr<MMI::PointerEvent> pointerEvent) const override;
         void OnInputEvent(std::shared_ptr<MMI::AxisEvent> axisEvent) const override;
     private:
         std::function<void (std::shared_ptr<MMI::PointerEvent>)> pointerEventCallback_ { nullptr };
+        std::function<void (std::shared_ptr<MMI::PointerEvent>)> injectCallback_ { nullptr };
+        PointerEventStats &stats_;
     };
-#endif // OHOS_DRAG_ENABLE_INTERCEPTOR
 
 #ifdef OHOS_DRAG_ENABLE_MONITOR
     class MonitorConsumer : public MMI::IInputEventConsumer {
     public:
-        explicit MonitorConsumer(std::function<void (std::shared_ptr<MMI::PointerEvent>)> cb, IContext* context)
-            : pointerEventCallback_(cb), context_(context) {}
+        MonitorConsumer(std::function<void (std::shared_ptr<MMI::PointerEvent>)> cb, IContext* context,
+            PointerEventStats &stats) : pointerEventCallback_(cb), context_(context), stats_(stats) {}
         void OnInputEvent(std::shared_ptr<MMI::KeyEvent> keyEvent) const override;
         void OnInputEvent(std::shared_ptr<MMI::PointerEvent> pointerEvent) const override;
         void OnInputEvent(std::shared_ptr<MMI::AxisEvent> axisEvent) const override;
     private:
         std::function<void (std::shared_ptr<MMI::PointerEvent>)> pointerEventCallback_;
         IContext* context_ { nullptr };
+        PointerEventStats &stats_;
     };
 #endif //OHOS_DRAG_ENABLE_MONITOR
 #else
@@ -243,16 +259,27 @@ private:
 #ifndef OHOS_BUILD_ENABLE_ARKUI_X
     int32_t AddDragEventHandler(int32_t sourceType);
     int32_t AddPointerEventHandler(uint32_t deviceTags);
+#ifdef OHOS_DRAG_ENABLE_INTERCEPTOR
+    int32_t AddPointerEventInterceptor(uint32_t deviceTags);
+#endif // OHOS_DRAG_ENABLE_INTERCEPTOR
     int32_t AddKeyEventMonitor();
     int32_t RemoveDragEventHandler();
     int32_t RemoveKeyEventMonitor();
     int32_t RemovePointerEventHandler();
     int32_t NotifyDragResult(DragResult result, DragBehavior dragBehavior);
     int32_t NotifyHideIcon();
+    // Sends what the drop target usually asks for after the drop to the target, ahead of its asking.
+    int32_t PushDropBundle();
+    // Drops the bundle the target of the last drop still holds, so it is not taken for this drag.
+    void InvalidateDropBundle();
+    bool GetSystemLanguageRTL(bool &isRTL) const;
 #endif // OHOS_BUILD_ENABLE_ARKUI_X
     int32_t InitDataManager(const DragData &dragData, const std::string &appCaller = "");
 #ifndef OHOS_BUILD_ENABLE_ARKUI_X
     int32_t OnStartDrag(const struct DragRadarPackageName &dragRadarPackageName, int32_t pid = -1);
+    // The steps of StartDrag() that run within the vsync session, which StartDrag() ends if any of them fails.
+    int32_t StartDragInSession(const DragData &dragData, int32_t pid,
+        const struct DragRadarPackageName &dragRadarPackageName);
 #else
     int32_t OnStartDrag();
 #endif // OHOS_BUILD_ENABLE_ARKUI_X
@@ -320,6 +347,10 @@ private:
 #endif // OHOS_BUILD_ENABLE_ARKUI_X
     std::atomic_bool isFoldPC_ { false };
     int32_t timerId_ { -1 };
+#ifndef OHOS_BUILD_ENABLE_ARKUI_X
+    uint32_t dropBundleSeq_ { 0 };
+    int32_t dropBundlePid_ { -1 };
+#endif // OHOS_BUILD_ENABLE_ARKUI_X
     int32_t mouseDragMonitorTimerId_ { -1 };
 #ifdef OHOS_BUILD_INTERNAL_DROP_ANIMATION
     int32_t internalDropTimerId_ { -1 };
@@ -329,6 +360,7 @@ private:
     std::string appCallee_;
     std::atomic<DragAction> dragAction_ { DragAction::MOVE };
     DragDrawing dragDrawing_;
+    DragShadowCache shadowCache_;
     bool isControlCollaborationVisible_ { false };
     std::atomic_bool isCrossDragging_ { false };
     std::atomic_bool isCollaborationService_ { false };
@@ -340,6 +372,7 @@ private:
 #ifdef OHOS_DRAG_ENABLE_INTERCEPTOR
     int32_t pointerEventInterceptorId_ { -1 };
 #endif // OHOS_DRAG_ENABLE_INTERCEPTOR
+    PointerEventStats pointerEventStats_;
 #ifdef OHOS_DRAG_ENABLE_MONITOR
     int32_t pointerEventMonitorId_ { -1 };
 #endif //OHOS_DRAG_ENABLE_MONITOR
@@ -365,8 +398,12 @@ private:
     bool existMouseMoveDragCallback_ { false };
     int32_t lastDisplayId_ { -1 };
     std::string peerNetId_;
-    bool isLongPressDrag_ { false };
-    bool needLongPressDragAnimation_ { true };
+    std::atomic_bool isLongPressDrag_ { false };
+    std::atomic_bool needLongPressDragAnimation_ { true };
+    // Fields of the drag data read on every move, cached so that the move path does not copy it.
+    std::atomic<int32_t> dragSourceType_ { -1 };
+    std::atomic<int32_t> dragStartX_ { -1 };
+    std::atomic<int32_t> dragStartY_ { -1 };
     DragRadarPackageName dragPackageName_;
     int32_t dragAnimationType_ { 0 };
 #ifdef OHOS_BUILD_INTERNAL_DROP_ANIMATION
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DRAG_SHADOW_CACHE_H
+#define DRAG_SHADOW_CACHE_H
+
+#include <mutex>
+
+#include "nocopyable.h"
+
+#include "drag_data.h"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+// The shadow currently on screen. UpdateShadowPic with the same content and offset is a hit, and the
+// caller skips the redraw. Cleared when the drag ends, so a new drag never matches an old shadow.
+class DragShadowCache final {
+public:
+    DragShadowCache() = default;
+    ~DragShadowCache() = default;
+    DISALLOW_COPY_AND_MOVE(DragShadowCache);
+
+    bool IsShowing(const ShadowInfo &shadowInfo);
+    void SetShowing(const ShadowInfo &shadowInfo);
+    size_t GetHitCount();
+    void Clear();
+
+private:
+    std::mutex mutex_;
+    ShadowInfo showing_;
+    bool hasShowing_ { false };
+    size_t hitCount_ { 0 };
+};
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+#endif // DRAG_SHADOW_CACHE_H
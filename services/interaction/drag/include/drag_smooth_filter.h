@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DRAG_SMOOTH_FILTER_H
+#define DRAG_SMOOTH_FILTER_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+struct DragMoveEvent {
+    float displayX { 0.0f };
+    float displayY { 0.0f };
+    int32_t displayId { -1 };
+    uint64_t timestamp { 0 };
+};
+
+enum class DragSmoothFilterType : int32_t {
+    AVERAGE = 0,
+    ONE_EURO,
+    KALMAN,
+};
+
+struct DragSmoothConfig {
+    DragSmoothFilterType filterType { DragSmoothFilterType::AVERAGE };
+    // 1€ filter: cutoff frequency at rest in Hz, its growth per px/s of speed, and cutoff of the speed estimate.
+    double minCutoff { 1.0 };
+    double beta { 0.01 };
+    double derivativeCutoff { 1.0 };
+    // Constant velocity Kalman filter: variance of acceleration in px²/s⁴ and of measurements in px².
+    double processNoise { 1.0e7 };
+    double measurementNoise { 1.0 };
+    // Upper bound of look-ahead. The actual look-ahead is the measured input-to-present latency below it.
+    uint64_t maxPrediction { 16 * 1000 * 1000 };
+
+    // Falls back to defaults, that is averaging, for fields missing from @path, or if it can not be read.
+    static DragSmoothConfig Load(const std::string &path);
+    static DragSmoothConfig Load();
+};
+
+// Estimates the pointer position from noisy move samples, fed in order of timestamp.
+class IDragSmoothFilter {
+public:
+    IDragSmoothFilter() = default;
+    virtual ~IDragSmoothFilter() = default;
+
+    virtual void Reset() = 0;
+    virtual void Update(const DragMoveEvent &event) = 0;
+    // Position at @timestamp, extrapolated from the latest update if @timestamp is ahead of it.
+    virtual DragMoveEvent Predict(uint64_t timestamp) const = 0;
+};
+
+// Low-pass filter whose cutoff rises with speed: steady at rest, little lag when moving fast.
+class OneEuroFilter final : public IDragSmoothFilter {
+public:
+    explicit OneEuroFilter(const DragSmoothConfig &config);
+    ~OneEuroFilter() = default;
+
+    void Reset() override;
+    void Update(const DragMoveEvent &event) override;
+    DragMoveEvent Predict(uint64_t timestamp) const override;
+
+private:
+    struct Axis {
+        double position { 0.0 };
+        double velocity { 0.0 };
+    };
+    void UpdateAxis(Axis &axis, double measurement, double dt);
+
+    double minCutoff_ { 0.0 };
+    double beta_ { 0.0 };
+    double derivativeCutoff_ { 0.0 };
+    Axis x_;
+    Axis y_;
+    DragMoveEvent last_;
+    bool initialized_ { false };
+};
+
+// Kalman filter tracking position and velocity of each axis, assuming constant velocity between samples.
+class KalmanFilter final : public IDragSmoothFilter {
+public:
+    explicit KalmanFilter(const DragSmoothConfig &config);
+    ~KalmanFilter() = default;
+
+    void Reset() override;
+    void Update(const DragMoveEvent &event) override;
+    DragMoveEvent Predict(uint64_t timestamp) const override;
+
+private:
+    struct Axis {
+        double position { 0.0 };
+        double velocity { 0.0 };
+        double p00 { 0.0 };
+        double p01 { 0.0 };
+        double p11 { 0.0 };
+    };
+    void InitAxis(Axis &axis, double measurement) const;
+    void UpdateAxis(Axis &axis, double measurement, double dt) const;
+
+    double processNoise_ { 0.0 };
+    double measurementNoise_ { 0.0 };
+    Axis x_;
+    Axis y_;
+    DragMoveEvent last_;
+    bool initialized_ { false };
+};
+
+// Returns nullptr for DragSmoothFilterType::AVERAGE, which DragSmoothProcessor implements by itself.
+std::unique_ptr<IDragSmoothFilter> CreateDragSmoothFilter(const DragSmoothConfig &config);
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+#endif // DRAG_SMOOTH_FILTER_H
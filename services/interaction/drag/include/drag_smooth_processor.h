@@ -16,42 +16,102 @@
 #ifndef DRAG_SMOOTH_PROCESSOR_H
 #define DRAG_SMOOTH_PROCESSOR_H
 
+#include <array>
+#include <atomic>
 #include <cstdint>
-#include <mutex>
+#include <memory>
 #include <optional>
-#include <vector>
+
+#include "drag_smooth_filter.h"
 
 namespace OHOS {
 namespace Msdp {
 namespace DeviceStatus {
-struct DragMoveEvent {
-    float displayX { 0.0f };
-    float displayY { 0.0f };
-    int32_t displayId { -1 };
-    uint64_t timestamp { 0 };
+// Move samples drained from the ring in one frame. Fixed capacity, so draining never allocates.
+class DragMoveBatch {
+public:
+    static constexpr size_t CAPACITY { 128 };
+
+    const DragMoveEvent* begin() const { return events_.data(); }
+    const DragMoveEvent* end() const { return events_.data() + size_; }
+    size_t size() const { return size_; }
+    bool empty() const { return (size_ == 0); }
+    const DragMoveEvent& back() const { return events_[size_ - 1]; }
+    const DragMoveEvent& at(size_t index) const { return events_.at(index); }
+    void clear() { size_ = 0; }
+    // Samples beyond the capacity are dropped.
+    void push_back(const DragMoveEvent &event)
+    {
+        if (size_ < CAPACITY) {
+            events_[size_++] = event;
+        }
+    }
+
+private:
+    std::array<DragMoveEvent, CAPACITY> events_ {};
+    size_t size_ { 0 };
 };
 
+// Move samples travel to the vsync thread through a bounded multi-producer, single-consumer ring,
+// so neither side takes a lock or allocates once a drag is under way. Producers claim a slot on
+// tail_ and publish it through the slot sequence; the vsync thread consumes published slots in order.
+// With a predictive filter configured, the position is estimated ahead of the latest sample
+// by the measured input-to-present latency, capped by DragSmoothConfig::maxPrediction.
 class DragSmoothProcessor {
 public:
+    DragSmoothProcessor();
+    explicit DragSmoothProcessor(const DragSmoothConfig &config);
+
+    // Any thread. The sample is dropped if the vsync thread has fallen a whole ring behind.
     void InsertEvent(const DragMoveEvent &event);
+    // Vsync thread only.
     DragMoveEvent SmoothMoveEvent(uint64_t nanoTimestamp, uint64_t vSyncPeriod);
+    // Any thread. Samples inserted so far are discarded by the next SmoothMoveEvent().
     void ResetParameters();
+    uint64_t GetDroppedCount() const;
+    // Vsync thread only. Smoothed delay from input of a sample to the vsync that presents it.
+    uint64_t GetPresentLatency() const;
 
 private:
+    static constexpr size_t RING_CAPACITY { DragMoveBatch::CAPACITY };
+    static constexpr uint64_t NO_RESET { UINT64_MAX };
+
+    void DrainEvents();
+    DragMoveEvent FilterMoveEvent(uint64_t nanoTimestamp);
+    DragMoveBatch& CurrentEvents();
+    DragMoveBatch& HistoryEvents();
     std::optional<DragMoveEvent> GetInterpolatedEvent(const DragMoveEvent &historyAvgEvent,
         const DragMoveEvent &currentAvgEvent, uint64_t nanoTimestamp);
-    std::optional<DragMoveEvent> Resample(const std::vector<DragMoveEvent>& history,
-        const std::vector<DragMoveEvent>& current, uint64_t nanoTimestamp);
-    void DumpMoveEvent(const std::vector<DragMoveEvent>& history,
-        const std::vector<DragMoveEvent>& current, const DragMoveEvent &historyAvgEvent,
+    std::optional<DragMoveEvent> Resample(const DragMoveBatch &history,
+        const DragMoveBatch &current, uint64_t nanoTimestamp);
+    void DumpMoveEvent(const DragMoveBatch &history,
+        const DragMoveBatch &current, const DragMoveEvent &historyAvgEvent,
         const DragMoveEvent &currentAvgEvent, const DragMoveEvent &latestEvent);
-    DragMoveEvent GetNearestEvent(const std::vector<DragMoveEvent>& events, uint64_t nanoTimestamp);
-    DragMoveEvent GetAvgCoordinate(const std::vector<DragMoveEvent>& events);
-    std::optional<DragMoveEvent> GetResampleEvent(const std::vector<DragMoveEvent>& history,
-        const std::vector<DragMoveEvent>& current, uint64_t nanoTimestamp);
-    std::vector<DragMoveEvent> moveEvents_;
-    std::vector<DragMoveEvent> historyEvents_;
-    std::mutex mtx_;
+    DragMoveEvent GetNearestEvent(const DragMoveBatch &events, uint64_t nanoTimestamp);
+    DragMoveEvent GetAvgCoordinate(const DragMoveBatch &events);
+    std::optional<DragMoveEvent> GetResampleEvent(const DragMoveBatch &history,
+        const DragMoveBatch &current, uint64_t nanoTimestamp);
+
+    struct Slot {
+        // Equals the position when free for that position, and the position + 1 once published.
+        std::atomic<uint64_t> sequence { 0 };
+        DragMoveEvent event;
+    };
+
+    std::array<Slot, RING_CAPACITY> ring_ {};
+    std::atomic<uint64_t> tail_ { 0 };
+    std::atomic<uint64_t> resetMark_ { NO_RESET };
+    std::atomic<uint64_t> dropped_ { 0 };
+    // Owned by the vsync thread. Current and history batches trade places every frame.
+    uint64_t head_ { 0 };
+    uint64_t skipUntil_ { 0 };
+    std::array<DragMoveBatch, 2> batches_ {};
+    size_t current_ { 0 };
+    DragSmoothConfig config_;
+    std::unique_ptr<IDragSmoothFilter> filter_ { nullptr };
+    DragMoveEvent latestEvent_;
+    bool hasLatestEvent_ { false };
+    uint64_t presentLatency_ { 0 };
 };
 } // namespace DeviceStatus
 } // namespace Msdp
@@ -16,6 +16,8 @@
 #ifndef DRAG_VSYNC_STATION_H
 #define DRAG_VSYNC_STATION_H
 
+#include <atomic>
+#include <chrono>
 #include <memory>
 #include <mutex>
 #include <vector>
@@ -29,17 +31,32 @@ using DragFrameCallback = std::function<void(uint64_t)>;
 enum FrameRequestType {
     TYPE_FLUSH_DRAG_POSITION = 1,
     TYPE_PERFORM_ANIMATION = 2,
+    TYPE_FLUSH_SELECTED_PIXELMAPS = 3,
     REQUEST_TYPE_MAX
 };
 
+// The render runner outlives a drag session and is reused by the next one. The owner tears it down
+// from its own thread once a session has stayed stopped for IDLE_TEARDOWN_TIMEOUT_MS.
 class DragVSyncStation {
 public:
+    static constexpr int32_t IDLE_TEARDOWN_TIMEOUT_MS { 30000 };
+
+    DragVSyncStation() = default;
+    ~DragVSyncStation();
+    void StartSession();
+    // Frames are only delivered within a session, requests outside one are refused.
     int32_t RequestFrame(int32_t frameType, std::shared_ptr<DragFrameCallback> callback);
-    void StopVSyncRequest();
+    // Returns the epoch to hand to TeardownRunner().
+    uint64_t StopVSyncRequest();
+    // Not on the runner thread. Does nothing if a session started since @epoch.
+    void TeardownRunner(uint64_t epoch);
     uint64_t GetVSyncPeriod();
+    void Dump(int32_t fd) const;
 
 private:
     int32_t Init();
+    static void ReleaseRunner(std::shared_ptr<Rosen::VSyncReceiver> receiver,
+        std::shared_ptr<AppExecFwk::EventHandler> handler);
     void OnVSyncInner(uint64_t nanoTimestamp);
     static void OnVSync(uint64_t nanoTimestamp, void *client);
     void SetThreadQosLevel(std::shared_ptr<AppExecFwk::EventHandler> handler);
@@ -49,8 +66,21 @@ private:
     Rosen::VSyncReceiver::FrameCallback frameCallback_;
     uint64_t vSyncPeriod_ {0};
     std::shared_ptr<AppExecFwk::EventHandler> handler_ { nullptr };
-    std::mutex mtx_;
+    mutable std::mutex mtx_;
     int32_t mmiHandleTid_ { -1 };
+    bool sessionActive_ { false };
+    bool firstFramePending_ { false };
+    std::atomic<uint64_t> sessionEpoch_ { 0 };
+    std::chrono::steady_clock::time_point sessionStartTime_;
+    int64_t lastFirstFrameLatencyUs_ { -1 };
+    int64_t maxFirstFrameLatencyUs_ { -1 };
+    // The first drag after service start pays for cold caches, later ones are averaged separately.
+    int64_t firstDragLatencyUs_ { -1 };
+    int64_t steadyLatencySumUs_ { 0 };
+    int64_t steadyLatencyCount_ { 0 };
+    uint32_t runnerCreatedCount_ { 0 };
+    uint32_t sessionCount_ { 0 };
+    uint32_t droppedCallbackCount_ { 0 };
 };
 } // namespace DeviceStatus
 } // namespace Msdp
@@ -17,9 +17,14 @@
 #define PULL_THROW_LISTENER_H
 
 #ifndef OHOS_BUILD_ENABLE_ARKUI_X
+#include <atomic>
+#include <mutex>
+
 #include "data_ability_observer_stub.h"
 #include "datashare_helper.h"
 #include "display_manager.h"
+
+#include "pull_throw_settings.h"
 #endif // OHOS_BUILD_ENABLE_ARKUI_X
 
 namespace OHOS {
@@ -78,12 +83,15 @@ public:
     bool RegisterPullThrowListener();
     bool RegisterVKListener();
     bool ValidateThrowConditions();
+    // Latest fold status seen by the fold status listener, false if it is not registered.
+    bool GetFoldStatus(Rosen::FoldStatus &foldStatus) const;
 
 private:
     std::shared_ptr<DataShare::DataShareHelper> CreateDataShareHelper();
-    int32_t GetStringValue(const std::string &key, std::string &value);
-    int32_t GetIntValue(const std::string &key, int32_t &value);
-    int32_t GetLongValue(const std::string &key, int64_t &value);
+    // Helper shared by every settings query and observer, created on first use.
+    std::shared_ptr<DataShare::DataShareHelper> GetDataShareHelper();
+    int32_t QueryStringValue(const std::string &key, std::string &value);
+    void UpdateVKStatus();
     bool ReleaseDataShareHelper(std::shared_ptr<DataShare::DataShareHelper> &helper);
     bool RegisterFoldStatusListener();
     bool RegisterScreenMagneticStateListener();
@@ -94,9 +102,15 @@ private:
     sptr<Rosen::DisplayManager::IFoldStatusListener> foldStatusListener_;
     sptr<Rosen::DisplayManager::IScreenMagneticStateListener> screenMagneticStateListener_;
     sptr<IRemoteObject> remoteObj_ { nullptr };
-    Rosen::FoldStatus oldFoldStatus_ {Rosen::FoldStatus::UNKNOWN};
-    bool currentMagneticState_ { false };
-    int32_t obstatusVk_ = -1;
+    std::mutex helperMutex_;
+    std::shared_ptr<DataShare::DataShareHelper> helper_ { nullptr };
+    PullThrowSettings settings_ { [this](const std::string &key, std::string &value) {
+        return QueryStringValue(key, value);
+    } };
+    std::atomic_bool foldStatusListened_ { false };
+    std::atomic<Rosen::FoldStatus> foldStatus_ { Rosen::FoldStatus::UNKNOWN };
+    std::atomic_bool currentMagneticState_ { false };
+    std::atomic<int32_t> obstatusVk_ { -1 };
     sptr<VKObserver> CreateVKObserver(const VKObserver::UpdateFunc &func);
 };
 #endif // OHOS_BUILD_ENABLE_ARKUI_X
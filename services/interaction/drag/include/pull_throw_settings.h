@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef PULL_THROW_SETTINGS_H
+#define PULL_THROW_SETTINGS_H
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+
+#include "nocopyable.h"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+// Settings that pull-throw depends on. A key is queried from its source on first use, then served
+// from memory until Invalidate() is called for it, typically by the observer of that key. Queries
+// run without the lock held, and a value queried across an invalidation is not kept.
+class PullThrowSettings final {
+public:
+    using QueryFunc = std::function<int32_t(const std::string &key, std::string &value)>;
+
+    explicit PullThrowSettings(QueryFunc query) : query_(std::move(query)) {}
+    ~PullThrowSettings() = default;
+    DISALLOW_COPY_AND_MOVE(PullThrowSettings);
+
+    int32_t GetStringValue(const std::string &key, std::string &value);
+    int32_t GetIntValue(const std::string &key, int32_t &value);
+    int32_t GetLongValue(const std::string &key, int64_t &value);
+    void Invalidate(const std::string &key);
+    void Clear();
+    size_t GetQueryCount() const;
+
+private:
+    QueryFunc query_;
+    mutable std::mutex mutex_;
+    std::map<std::string, std::string> values_;
+    uint64_t generation_ { 0 };
+    size_t queryCount_ { 0 };
+};
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+#endif // PULL_THROW_SETTINGS_H
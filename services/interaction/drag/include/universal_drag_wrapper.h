@@ -41,6 +41,8 @@ public:
     void StopLongPressDrag();
  
 private:
+    void ResolveSymbols();
+
     IContext* env_ { nullptr };
     void* universalDragHandle_ { nullptr };
     InitFunc initUniversalDragHandle_ { nullptr };
@@ -18,6 +18,7 @@
 #include "devicestatus_define.h"
 #include "product_name_definition_parser.h"
 #include "parameters.h"
+#include "rotate_policy.h"
 
 #undef LOG_TAG
 #define LOG_TAG "DisplayChangeEventListener"
@@ -26,10 +27,6 @@ namespace OHOS {
 namespace Msdp {
 namespace DeviceStatus {
 namespace {
-constexpr int32_t INDEX_FOLDED { 0 };
-constexpr int32_t INDEX_EXPAND { 1 };
-constexpr size_t MAX_INDEX_LENGTH { 2 };
-const std::string SCREEN_ROTATION { "1" };
 const std::string SYS_PRODUCT_TYPE = OHOS::system::GetParameter("const.build.product", "HYM");
 const std::vector<std::string> DEVICE_TYPE_FOLD_PC_VECTOR {
     PRODUCT_NAME_DEFINITION_PARSER.GetProductNameVector("DEVICE_TYPE_FOLD_PC_VECTOR")
@@ -37,7 +34,7 @@ const std::vector<std::string> DEVICE_TYPE_FOLD_PC_VECTOR {
 } // namespace
 
 DisplayChangeEventListener::DisplayChangeEventListener(IContext *context)
-    : context_(context)
+    : context_(context), isFoldable_(Rosen::DisplayManager::GetInstance().IsFoldable())
 {
 }
 
@@ -69,6 +66,18 @@ void DisplayChangeEventListener::OnAttributeChange(Rosen::DisplayId displayId,
     FI_HILOGE("No expected attributes found for displayId:%{public}" PRIu64"", displayId);
 }
 
+Rosen::FoldStatus DisplayChangeEventListener::GetFoldStatus() const
+{
+#ifdef OHOS_ENABLE_PULLTHROW
+    // Reuse the status kept by the pull-throw fold listener when it is registered.
+    Rosen::FoldStatus foldStatus { Rosen::FoldStatus::UNKNOWN };
+    if ((context_ != nullptr) && context_->GetDragManager().GetListenedFoldStatus(foldStatus)) {
+        return foldStatus;
+    }
+#endif // OHOS_ENABLE_PULLTHROW
+    return Rosen::DisplayManager::GetInstance().GetFoldStatus();
+}
+
 void DisplayChangeEventListener::ProcessDisplayEvent(Rosen::DisplayId displayId)
 {
     CHKPV(context_);
@@ -80,7 +89,7 @@ void DisplayChangeEventListener::ProcessDisplayEvent(Rosen::DisplayId displayId)
     }
     Rosen::Rotation currentRotation = displayInfo->GetRotation();
     if (IsRotateDragScreen()) {
-        if (Rosen::DisplayManager::GetInstance().IsFoldable()) {
+        if (isFoldable_) {
             HandleScreenRotation(displayId, lastRotation);
         } else {
             ScreenRotate(currentRotation, lastRotation);
@@ -98,40 +107,20 @@ void DisplayChangeEventListener::ProcessDisplayEvent(Rosen::DisplayId displayId)
 
 bool DisplayChangeEventListener::IsRotateDragScreen()
 {
-    bool isScreenRotation = false;
-    std::vector<std::string> foldRotatePolicys;
-    GetRotatePolicy(isScreenRotation, foldRotatePolicys);
-    if (Rosen::DisplayManager::GetInstance().IsFoldable()) {
+    const RotatePolicy &rotatePolicy = RotatePolicy::GetInstance();
+    if (!isFoldable_) {
+        return rotatePolicy.IsScreenRotation(false, FoldPosture::UNKNOWN);
+    }
 #ifdef OHOS_ENABLE_PULLTHROW
-        if (IsFoldPC()) {
-            return true;
-        }
+    if (IsFoldPC()) {
+        return true;
+    }
 #endif // OHOS_ENABLE_PULLTHROW
-        if (foldRotatePolicys.size() < MAX_INDEX_LENGTH) {
-            FI_HILOGE("foldRotatePolicys is invalid");
-            return false;
-        }
-        Rosen::FoldStatus foldStatus = Rosen::DisplayManager::GetInstance().GetFoldStatus();
-        bool isExpand = (foldStatus == Rosen::FoldStatus::EXPAND || foldStatus == Rosen::FoldStatus::HALF_FOLD);
-        bool isFold = (foldStatus == Rosen::FoldStatus::FOLDED);
-        if (IsSecondaryDevice()) {
-            isExpand = (foldStatus == Rosen::FoldStatus::EXPAND || foldStatus == Rosen::FoldStatus::HALF_FOLD ||
-                foldStatus == Rosen::FoldStatus::FOLD_STATE_EXPAND_WITH_SECOND_EXPAND ||
-                foldStatus == Rosen::FoldStatus::FOLD_STATE_EXPAND_WITH_SECOND_HALF_FOLDED ||
-                foldStatus == Rosen::FoldStatus::FOLD_STATE_HALF_FOLDED_WITH_SECOND_EXPAND ||
-                foldStatus == Rosen::FoldStatus::FOLD_STATE_HALF_FOLDED_WITH_SECOND_HALF_FOLDED);
-            isFold = (foldStatus == Rosen::FoldStatus::FOLDED ||
-                foldStatus == Rosen::FoldStatus::FOLD_STATE_FOLDED_WITH_SECOND_EXPAND ||
-                foldStatus == Rosen::FoldStatus::FOLD_STATE_FOLDED_WITH_SECOND_HALF_FOLDED);
-        }
-        if ((isExpand && (foldRotatePolicys[INDEX_EXPAND] == SCREEN_ROTATION)) ||
-            (isFold && (foldRotatePolicys[INDEX_FOLDED] == SCREEN_ROTATION))) {
-            return true;
-        }
-    } else {
-        return isScreenRotation;
+    if (!rotatePolicy.IsFoldPolicyValid()) {
+        FI_HILOGE("foldRotatePolicys is invalid");
+        return false;
     }
-    return false;
+    return rotatePolicy.IsScreenRotation(true, rotatePolicy.GetFoldPosture(GetFoldStatus()));
 }
 
 void DisplayChangeEventListener::HandleScreenRotation(Rosen::DisplayId displayId, Rosen::Rotation rotation)
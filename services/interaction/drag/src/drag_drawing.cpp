@@ -16,12 +16,17 @@
 #include "drag_drawing.h"
 
 #include <atomic>
+#include <cerrno>
+#include <chrono>
 #include <cmath>
 #include <cstdint>
 #include <fstream>
 #include <limits>
+#include <mutex>
 #include <shared_mutex>
 #include <string>
+#include <sys/resource.h>
+#include <sys/syscall.h>
 #include <unistd.h>
 
 #include <dlfcn.h>
@@ -53,6 +58,7 @@
 #include "animation_curve.h"
 #include "devicestatus_define.h"
 #include "drag_data_manager.h"
+#include "drag_style_params.h"
 #ifdef MSDP_HIVIEWDFX_HISYSEVENT_ENABLE
 #include "drag_hisysevent.h"
 #endif // MSDP_HIVIEWDFX_HISYSEVENT_ENABLE
@@ -92,6 +98,9 @@ constexpr int32_t FIRST_PIXELMAP_INDEX { 0 };
 constexpr int32_t SECOND_PIXELMAP_INDEX { 1 };
 constexpr int32_t LAST_SECOND_PIXELMAP { 2 };
 constexpr int32_t LAST_THIRD_PIXELMAP { 3 };
+// Items added behind the dragged one that stay drawn. Deeper ones are folded into the drag count.
+constexpr size_t MAX_STACKED_PIXELMAPS { 2 };
+constexpr uint64_t BYTES_PER_KB { 1024 };
 constexpr size_t TOUCH_NODE_MIN_COUNT { 3 };
 constexpr size_t MOUSE_NODE_MIN_COUNT { 4 };
 constexpr float DEFAULT_SCALING { 1.0f };
@@ -199,8 +208,6 @@ constexpr float BEZIER_040 { 0.40f };
 constexpr float BEZIER_060 { 0.60f };
 constexpr float BEZIER_067 { 0.67f };
 constexpr float BEZIER_100 { 1.00f };
-constexpr float MIN_OPACITY { 0.0f };
-constexpr float MAX_OPACITY { 1.0f };
 constexpr float ADJUST_MENT { 0.4f };
 constexpr float ADJUST_MENT_DEGREE { 0.3f };
 constexpr float DEFAULT_SENSITIVITY { 2.0f };
@@ -249,6 +256,12 @@ const std::string MOUSE_DRAG_MAGIC_DEFAULT_PATH { "/system/etc/device_status/dra
 const std::string MOUSE_DRAG_CURSOR_CIRCLE_PATH { "/system/etc/device_status/drag_icon/Mouse_Drag_Cursor_Circle.png" };
 const std::string DRAG_DROP_EXTENSION_SO_PATH { "/system/lib64/drag_drop_ext/libdrag_drop_ext.z.so" };
 const std::string BIG_FOLDER_LABEL { "scb_folder" };
+#ifndef OHOS_BUILD_ENABLE_ARKUI_X
+constexpr int32_t WARM_UP_NICE { 10 };
+// The default desktop drop animation, a spring matching SPRING_ROTATION.
+const std::string WARM_UP_DRAG_ANIMATION_INFO {
+    R"({"SpringEnable":true,"dropAnimationCurve":[0.6,0.7,0.25],"dropPosition":[0,0],"dropSize":[0,0]})" };
+#endif // OHOS_BUILD_ENABLE_ARKUI_X
 
 struct DrawingInfo {
     std::atomic_bool isRunning { false };
@@ -279,6 +292,7 @@ struct DrawingInfo {
     std::vector<std::shared_ptr<Rosen::RSCanvasNode>> nodes;
     std::vector<std::shared_ptr<Rosen::RSCanvasNode>> multiSelectedNodes;
     std::vector<std::shared_ptr<Media::PixelMap>> multiSelectedPixelMaps;
+    size_t foldedSelectedNum { 0 };
     std::shared_ptr<Rosen::RSNode> rootNode { nullptr };
     std::shared_ptr<Rosen::RSNode> parentNode { nullptr };
     std::shared_ptr<Rosen::RSSurfaceNode> surfaceNode { nullptr };
@@ -396,6 +410,7 @@ int32_t DragDrawing::Init(const DragData &dragData, bool isLongPressDrag)
     }
 #ifndef OHOS_BUILD_ENABLE_ARKUI_X
     dragSmoothProcessor_.ResetParameters();
+    frameRecorder_.BeginDrag();
     LoadDragDropLib();
 #endif // OHOS_BUILD_ENABLE_ARKUI_X
     OnStartDrag(dragAnimationData);
@@ -924,13 +939,20 @@ int32_t DragDrawing::AddSelectedPixelMap(std::shared_ptr<OHOS::Media::PixelMap>
         FI_HILOGE("Update pixeMap drawing order failed");
         return RET_ERR;
     }
+    FoldSelectedPixelMaps();
     Draw(g_drawingInfo.displayId, g_drawingInfo.displayX, g_drawingInfo.displayY, false);
-    g_drawingInfo.currentDragNum = g_drawingInfo.multiSelectedPixelMaps.size() + 1;
+    g_drawingInfo.currentDragNum =
+        g_drawingInfo.multiSelectedPixelMaps.size() + g_drawingInfo.foldedSelectedNum + 1;
     if (UpdateDragStyle(g_drawingInfo.currentStyle) != RET_OK) {
         FI_HILOGE("Update drag style failed");
         return RET_ERR;
     }
+    UpdateShadowMemoryStat();
+#ifndef OHOS_BUILD_ENABLE_ARKUI_X
+    RequestSelectedFlush();
+#else
     Rosen::RSTransaction::FlushImplicitTransaction();
+#endif // OHOS_BUILD_ENABLE_ARKUI_X
     FI_HILOGD("leave");
     return RET_OK;
 }
@@ -1732,12 +1754,12 @@ void DragDrawing::OnStartDragExt()
         FI_HILOGE("Fail to open drag drop extension library");
         return;
     }
-    auto dragDropStartExtFunc = reinterpret_cast<DragStartExtFunc>(dlsym(dragExtHandler_, "OnStartDragExt"));
+    DragStartExtFunc dragDropStartExtFunc = dragStartExtFunc_;
     if (dragDropStartExtFunc == nullptr) {
         FI_HILOGE("Fail to get drag drop extension function");
-        CHKPV(dragExtHandler_);
         dlclose(dragExtHandler_);
         dragExtHandler_ = nullptr;
+        dragNotifyExtFunc_ = nullptr;
         return;
     }
 #ifdef OHOS_DRAG_ENABLE_ANIMATION
@@ -1758,12 +1780,12 @@ void DragDrawing::NotifyDragInfo(const std::string &sourceName, const std::strin
         FI_HILOGE("Fail to open drag drop extension library");
         return;
     }
-    auto dragDropExtFunc = reinterpret_cast<DragNotifyExtFunc>(dlsym(dragExtHandler_, "OnNotifyDragInfo"));
+    DragNotifyExtFunc dragDropExtFunc = dragNotifyExtFunc_;
     if (dragDropExtFunc == nullptr) {
         FI_HILOGE("Fail to get drag drop extension function");
-        CHKPV(dragExtHandler_);
         dlclose(dragExtHandler_);
         dragExtHandler_ = nullptr;
+        dragStartExtFunc_ = nullptr;
         return;
     }
     struct DragEventInfo dragEventInfo;
@@ -2212,20 +2234,27 @@ void DragDrawing::FlushDragPosition(uint64_t nanoTimestamp)
     } else {
         FI_HILOGE("rsUiDirector_ is nullptr");
     }
-    DragMoveEvent event = dragSmoothProcessor_.SmoothMoveEvent(nanoTimestamp,
-        vSyncStation_.GetVSyncPeriod());
+    uint64_t vSyncPeriod = vSyncStation_.GetVSyncPeriod();
+    DragMoveEvent event = dragSmoothProcessor_.SmoothMoveEvent(nanoTimestamp, vSyncPeriod);
     FI_HILOGD("Move position x:%{private}f, y:%{private}f, timestamp:%{public}" PRId64", displayId:%{public}d",
         event.displayX, event.displayY, event.timestamp, event.displayId);
     Rosen::Rotation currentRotation = GetRotation(event.displayId);
-    StartTrace(HITRACE_TAG_MSDP, "OnDragMove,displayX:" + std::to_string(event.displayX)
-        + ",displayY:" + std::to_string(event.displayY) + "displayId:" + std::to_string(event.displayId)
-        + ",rotation:" + std::to_string(static_cast<uint32_t>(currentRotation)));
+    bool isTracing = IsTagEnabled(HITRACE_TAG_MSDP);
+    if (isTracing) {
+        StartTrace(HITRACE_TAG_MSDP, "OnDragMove,displayX:" + std::to_string(event.displayX)
+            + ",displayY:" + std::to_string(event.displayY) + "displayId:" + std::to_string(event.displayId)
+            + ",rotation:" + std::to_string(static_cast<uint32_t>(currentRotation)));
+    }
     if (DragWindowRotationFlush_ == currentRotation) {
         UpdateDragPosition(event.displayId, event.displayX, event.displayY);
+        frameRecorder_.RecordFrame(nanoTimestamp, vSyncPeriod, event, DragFrameRecorder::Now());
+        frameRecorder_.RecordRequest();
         vSyncStation_.RequestFrame(TYPE_FLUSH_DRAG_POSITION, frameCallback_);
     }
     DragWindowRotationFlush_ = currentRotation;
-    FinishTrace(HITRACE_TAG_MSDP);
+    if (isTracing) {
+        FinishTrace(HITRACE_TAG_MSDP);
+    }
 #endif // OHOS_BUILD_ENABLE_ARKUI_X
 }
 
@@ -2265,11 +2294,13 @@ void DragDrawing::OnDragMove(int32_t displayId, int32_t displayX, int32_t displa
         .timestamp = actionTimeCount,
     };
     dragSmoothProcessor_.InsertEvent(event);
+    frameRecorder_.RecordInput(actionTimeCount);
     if (frameCallback_ == nullptr) {
         frameCallback_ = std::make_shared<DragFrameCallback>([this](uint64_t nanoTimestamp) {
             this->FlushDragPosition(nanoTimestamp);
         });
     }
+    frameRecorder_.RecordRequest();
     vSyncStation_.RequestFrame(TYPE_FLUSH_DRAG_POSITION, frameCallback_);
 #else
     UpdateDragPosition(displayId, displayX, displayY);
@@ -2349,6 +2380,25 @@ bool DragDrawing::ParserDragAnimationInfo(std::string dragAnimationInfo)
 {
     FI_HILOGI("dragAnimationInfo size:%{public}zu, dragAnimationInfo:%{public}s",
         dragAnimationInfo.size(), dragAnimationInfo.c_str());
+    DropAnimationInfo info;
+    bool ret = ParseDropAnimationInfo(dragAnimationInfo, info);
+    if (info.cubicCurveEnable.has_value()) {
+        cubicCurveEnable_.store(info.cubicCurveEnable.value());
+    }
+    if (info.springEnable.has_value()) {
+        springEnable_.store(info.springEnable.value());
+    }
+    if (!ret) {
+        return false;
+    }
+    dropAnimationCurve_ = std::move(info.dropAnimationCurve);
+    dropPosition_ = std::move(info.dropPosition);
+    dropSize_ = std::move(info.dropSize);
+    return true;
+}
+
+bool DragDrawing::ParseDropAnimationInfo(const std::string &dragAnimationInfo, DropAnimationInfo &info)
+{
     if (dragAnimationInfo.empty()) {
         FI_HILOGE("dragAnimationInfo is empty");
         return false;
@@ -2360,33 +2410,27 @@ bool DragDrawing::ParserDragAnimationInfo(std::string dragAnimationInfo)
     }
     cJSON *cubicCurveEnable = cJSON_GetObjectItemCaseSensitive(dragAnimationParser.Get(), "CubicCurveEnable");
     if (cJSON_IsBool(cubicCurveEnable)) {
-        cubicCurveEnable_.store(cJSON_IsTrue(cubicCurveEnable) ? true : false);
+        info.cubicCurveEnable = cJSON_IsTrue(cubicCurveEnable) ? true : false;
     }
     cJSON *springEnable = cJSON_GetObjectItemCaseSensitive(dragAnimationParser.Get(), "SpringEnable");
     if (cJSON_IsBool(springEnable)) {
-        springEnable_.store(cJSON_IsTrue(springEnable) ? true : false);
+        info.springEnable = cJSON_IsTrue(springEnable) ? true : false;
     }
-    std::vector<float> dropAnimationCurve;
     if (JsonParser::ParseFloatArray(
-        dragAnimationParser.Get(), "dropAnimationCurve", dropAnimationCurve, MAX_JSON_ARRAY_SIZE) != RET_OK) {
+        dragAnimationParser.Get(), "dropAnimationCurve", info.dropAnimationCurve, MAX_JSON_ARRAY_SIZE) != RET_OK) {
         FI_HILOGE("Parse cubicCurveVector failed");
         return false;
     }
-    dropAnimationCurve_ = std::move(dropAnimationCurve);
-    std::vector<float> dropPosition;
     if (JsonParser::ParseFloatArray(
-        dragAnimationParser.Get(), "dropPosition", dropPosition, MAX_JSON_ARRAY_SIZE) != RET_OK) {
+        dragAnimationParser.Get(), "dropPosition", info.dropPosition, MAX_JSON_ARRAY_SIZE) != RET_OK) {
         FI_HILOGE("Parse dropPosition failed");
         return false;
     }
-    dropPosition_ = std::move(dropPosition);
-    std::vector<float> dropSize;
     if (JsonParser::ParseFloatArray(
-        dragAnimationParser.Get(), "dropSize", dropSize, MAX_JSON_ARRAY_SIZE) != RET_OK) {
+        dragAnimationParser.Get(), "dropSize", info.dropSize, MAX_JSON_ARRAY_SIZE) != RET_OK) {
         FI_HILOGE("Parse dropSize failed");
         return false;
     }
-    dropSize_ = std::move(dropSize);
     return true;
 }
  
@@ -2703,13 +2747,9 @@ void DragDrawing::InitDrawingInfo(const DragData &dragData, bool isLongPressDrag
     g_drawingInfo.displayY = dragData.displayY;
     dragAnimationType_ = dragData.dragAnimationType;
     RotateDisplayXY(g_drawingInfo.displayX, g_drawingInfo.displayY);
-    if (!ParserExtraInfo(dragData.extraInfo, g_drawingInfo.extraInfo)) {
-        FI_HILOGI("No parser valid extraInfo data");
-    }
-    if (!ParserFilterInfo(dragData.filterInfo, g_drawingInfo.filterInfo)) {
-        FI_HILOGI("No parser valid filterInfo data");
-    }
+    InitStyleParams(dragData);
     size_t shadowInfosSize = dragData.shadowInfos.size();
+    g_drawingInfo.foldedSelectedNum = 0;
     for (size_t i = 1; i < shadowInfosSize; ++i) {
         std::shared_ptr<Media::PixelMap> pixelMap = dragData.shadowInfos[i].pixelMap;
         if (dragOriginDpi > EPSILON) {
@@ -2719,6 +2759,7 @@ void DragDrawing::InitDrawingInfo(const DragData &dragData, bool isLongPressDrag
         }
         g_drawingInfo.multiSelectedPixelMaps.emplace_back(pixelMap);
     }
+    UpdateShadowMemoryStat();
     materialId_ = dragData.materialId;
     materialFilter_ = dragData.materialFilter;
     if (isLongPressDrag) {
@@ -3098,10 +3139,18 @@ int32_t DragDrawing::ParseAndAdjustSvgInfo(xmlNodePtr curNode)
 
 std::shared_ptr<Media::PixelMap> DragDrawing::DecodeSvgToPixelMap(
     const std::string &filePath)
+{
+    Media::DecodeOptions decodeOpts;
+    SetDecodeOptions(decodeOpts);
+    return DecodeSvgToPixelMap(filePath, NeedAdjustSvgInfo(), decodeOpts);
+}
+
+std::shared_ptr<Media::PixelMap> DragDrawing::DecodeSvgToPixelMap(const std::string &filePath, bool needAdjust,
+    const Media::DecodeOptions &decodeOpts)
 {
     FI_HILOGD("enter");
     xmlDocPtr xmlDoc = xmlReadFile(filePath.c_str(), 0, XML_PARSE_NOBLANKS);
-    if (NeedAdjustSvgInfo()) {
+    if (needAdjust) {
         xmlNodePtr node = xmlDocGetRootElement(xmlDoc);
         CHKPP(node);
         int32_t ret = ParseAndAdjustSvgInfo(node);
@@ -3125,13 +3174,46 @@ std::shared_ptr<Media::PixelMap> DragDrawing::DecodeSvgToPixelMap(
     auto imageSource = Media::ImageSource::CreateImageSource(reinterpret_cast<const uint8_t*>(content.c_str()),
         content.size(), opts, errCode);
     CHKPP(imageSource);
-    Media::DecodeOptions decodeOpts;
-    SetDecodeOptions(decodeOpts);
     std::shared_ptr<Media::PixelMap> pixelMap = imageSource->CreatePixelMap(decodeOpts, errCode);
     FI_HILOGD("leave");
     return pixelMap;
 }
 
+std::shared_ptr<Media::PixelMap> DragDrawing::GetStylePixelMap(const std::string &filePath)
+{
+    if (NeedAdjustSvgInfo()) {
+        return DecodeSvgToPixelMap(filePath);
+    }
+    return GetStyleIcon(filePath, GetScaling());
+}
+
+std::shared_ptr<Media::PixelMap> DragDrawing::GetStyleIcon(const std::string &filePath, float scaling)
+{
+    {
+        std::lock_guard<std::mutex> guard(styleIconMutex_);
+        if (fabs(styleIconScaling_ - scaling) > EPSILON) {
+            styleIconCache_.clear();
+            styleIconScaling_ = scaling;
+        }
+        if (auto iter = styleIconCache_.find(filePath); iter != styleIconCache_.end()) {
+            return iter->second;
+        }
+    }
+    Media::DecodeOptions decodeOpts;
+    decodeOpts.desiredSize = {
+        .width = DEVICE_INDEPENDENT_PIXEL * scaling,
+        .height = DEVICE_INDEPENDENT_PIXEL * scaling
+    };
+    std::shared_ptr<Media::PixelMap> pixelMap = DecodeSvgToPixelMap(filePath, false, decodeOpts);
+    if (pixelMap != nullptr) {
+        std::lock_guard<std::mutex> guard(styleIconMutex_);
+        if (fabs(styleIconScaling_ - scaling) < EPSILON) {
+            styleIconCache_.emplace(filePath, pixelMap);
+        }
+    }
+    return pixelMap;
+}
+
 bool DragDrawing::NeedAdjustSvgInfo()
 {
     FI_HILOGD("enter");
@@ -3293,73 +3375,6 @@ void DragDrawing::SetDecodeOptions(Media::DecodeOptions &decodeOpts)
     FI_HILOGD("leave");
 }
 
-void DragDrawing::ParserDragShadowInfo(const cJSON* filterInfoParser, FilterInfo &filterInfo)
-{
-    CHKPV(filterInfoParser);
-    if (!cJSON_IsObject(filterInfoParser)) {
-        FI_HILOGE("FilterInfo is not json object");
-        return;
-    }
-    cJSON *offsetX = cJSON_GetObjectItemCaseSensitive(filterInfoParser, "drag_shadow_offsetX");
-    if (cJSON_IsNumber(offsetX)) {
-        filterInfo.offsetX = static_cast<float>(offsetX->valuedouble);
-    }
-    cJSON *offsetY = cJSON_GetObjectItemCaseSensitive(filterInfoParser, "drag_shadow_offsetY");
-    if (cJSON_IsNumber(offsetY)) {
-        filterInfo.offsetY = static_cast<float>(offsetY->valuedouble);
-    }
-    cJSON *argb = cJSON_GetObjectItemCaseSensitive(filterInfoParser, "drag_shadow_argb");
-    if (cJSON_IsNumber(argb)) {
-        filterInfo.argb = static_cast<uint32_t>(argb->valueint);
-    }
-    cJSON *shadowIsFilled   = cJSON_GetObjectItemCaseSensitive(filterInfoParser, "shadow_is_filled");
-    if (cJSON_IsBool(shadowIsFilled)) {
-        filterInfo.shadowIsFilled = cJSON_IsTrue(shadowIsFilled);
-    }
-    cJSON *shadowMask   = cJSON_GetObjectItemCaseSensitive(filterInfoParser, "shadow_mask");
-    if (cJSON_IsBool(shadowMask)) {
-        filterInfo.shadowMask = cJSON_IsTrue(shadowMask);
-    }
-    cJSON *shadowColorStrategy  = cJSON_GetObjectItemCaseSensitive(filterInfoParser, "shadow_color_strategy");
-    if (cJSON_IsNumber(shadowColorStrategy)) {
-        filterInfo.shadowColorStrategy = shadowColorStrategy->valueint;
-    }
-    cJSON *isHardwareAcceleration  = cJSON_GetObjectItemCaseSensitive(
-        filterInfoParser, "shadow_is_hardwareacceleration");
-    if (cJSON_IsBool(isHardwareAcceleration)) {
-        filterInfo.isHardwareAcceleration = cJSON_IsTrue(isHardwareAcceleration);
-    }
-    if (filterInfo.isHardwareAcceleration) {
-        cJSON *elevation  = cJSON_GetObjectItemCaseSensitive(filterInfoParser, "shadow_elevation");
-        if (cJSON_IsNumber(elevation)) {
-            filterInfo.elevation = static_cast<float>(elevation->valuedouble);
-        }
-    } else {
-        cJSON *shadowCorner = cJSON_GetObjectItemCaseSensitive(filterInfoParser, "shadow_corner");
-        if (cJSON_IsNumber(shadowCorner)) {
-            filterInfo.shadowCorner = static_cast<float>(shadowCorner->valuedouble);
-        }
-    }
-}
-
-void DragDrawing::ParserTextDragShadowInfo(const cJSON* filterInfoParser, FilterInfo &filterInfo)
-{
-    CHKPV(filterInfoParser);
-    if (!cJSON_IsObject(filterInfoParser)) {
-        FI_HILOGE("FilterInfo is not json object");
-        return;
-    }
-    cJSON *path = cJSON_GetObjectItemCaseSensitive(filterInfoParser, "drag_shadow_path");
-    if (cJSON_IsString(path)) {
-        float dragOriginDpi = DRAG_DATA_MGR.GetDragOriginDpi();
-        if (dragOriginDpi > EPSILON) {
-            filterInfo.path = "";
-        } else {
-            filterInfo.path = path->valuestring;
-        }
-    }
-}
-
 void DragDrawing::PrintDragShadowInfo()
 {
     FilterInfo filterInfo = g_drawingInfo.filterInfo;
@@ -3378,173 +3393,57 @@ void DragDrawing::PrintDragShadowInfo()
     }
 }
 
-bool DragDrawing::ParserFilterInfo(const std::string &filterInfoStr, FilterInfo &filterInfo)
+void DragDrawing::ApplyFilterParams(const DragFilterParams &filterParams, FilterInfo &filterInfo)
 {
-    FI_HILOGI("FilterInfo size:%{public}zu, filterInfo:%{public}s", filterInfoStr.size(), filterInfoStr.c_str());
-    if (filterInfoStr.empty()) {
-        FI_HILOGD("FilterInfo is empty");
-        return false;
-    }
-    JsonParser filterInfoParser(filterInfoStr.c_str());
-    if (!cJSON_IsObject(filterInfoParser.Get())) {
-        FI_HILOGE("FilterInfo is not json object");
-        return false;
-    }
-    cJSON *dipScale = cJSON_GetObjectItemCaseSensitive(filterInfoParser.Get(), "dip_scale");
-    if (cJSON_IsNumber(dipScale)) {
-        filterInfo.dipScale = AdjustDoubleValue(dipScale->valuedouble);
+    if ((filterParams.fieldMask & DRAG_FILTER_DIP_SCALE) != 0) {
+        filterInfo.dipScale = AdjustDoubleValue(filterParams.dipScale);
     }
-    cJSON *scale = cJSON_GetObjectItemCaseSensitive(filterInfoParser.Get(), "scale");
-    if (cJSON_IsNumber(scale)) {
-        filterInfo.scale = AdjustDoubleValue(scale->valuedouble);
-    }
-    ParserCornerRadiusInfo(filterInfoParser.Get(), g_drawingInfo.filterInfo);
-    cJSON *dragType = cJSON_GetObjectItemCaseSensitive(filterInfoParser.Get(), "drag_type");
-    if (cJSON_IsString(dragType)) {
-        filterInfo.dragType = dragType->valuestring;
-    }
-    cJSON *shadowEnable = cJSON_GetObjectItemCaseSensitive(filterInfoParser.Get(), "shadow_enable");
-    if (cJSON_IsBool(shadowEnable)) {
-        filterInfo.shadowEnable = cJSON_IsTrue(shadowEnable);
+    if ((filterParams.fieldMask & DRAG_FILTER_SCALE) != 0) {
+        filterInfo.scale = AdjustDoubleValue(filterParams.scale);
     }
+    filterInfo.cornerRadius1 = filterParams.cornerRadius1;
+    filterInfo.cornerRadius2 = filterParams.cornerRadius2;
+    filterInfo.cornerRadius3 = filterParams.cornerRadius3;
+    filterInfo.cornerRadius4 = filterParams.cornerRadius4;
+    filterInfo.dragType = filterParams.dragType;
+    filterInfo.shadowEnable = filterParams.shadowEnable;
     if (filterInfo.shadowEnable) {
-        ParserDragShadowInfo(filterInfoParser.Get(), filterInfo);
-        if (filterInfo.dragType == "text") {
-            ParserTextDragShadowInfo(filterInfoParser.Get(), filterInfo);
-        }
+        filterInfo.offsetX = filterParams.shadowOffsetX;
+        filterInfo.offsetY = filterParams.shadowOffsetY;
+        filterInfo.argb = filterParams.shadowArgb;
+        filterInfo.shadowIsFilled = filterParams.shadowIsFilled;
+        filterInfo.shadowMask = filterParams.shadowMask;
+        filterInfo.shadowColorStrategy = filterParams.shadowColorStrategy;
+        filterInfo.isHardwareAcceleration = filterParams.isHardwareAcceleration;
+        filterInfo.elevation = filterParams.shadowElevation;
+        filterInfo.shadowCorner = filterParams.shadowCorner;
+        filterInfo.path = (DRAG_DATA_MGR.GetDragOriginDpi() > EPSILON) ? "" : filterParams.shadowPath;
         PrintDragShadowInfo();
     }
-    ParserBlurInfo(filterInfoParser.Get(), g_drawingInfo.filterInfo);
-    cJSON *dragNodeGrayscale = cJSON_GetObjectItemCaseSensitive(filterInfoParser.Get(), "drag_node_gray_scale");
-    if (cJSON_IsNumber(dragNodeGrayscale)) {
-        filterInfo.dragNodeGrayscale = static_cast<float>(dragNodeGrayscale->valuedouble);
-    }
-    cJSON *eventId = cJSON_GetObjectItemCaseSensitive(filterInfoParser.Get(), "event_id");
-    if (cJSON_IsNumber(eventId)) {
-        DRAG_DATA_MGR.SetEventId(eventId->valueint);
-    }
-    cJSON *enableAnimation = cJSON_GetObjectItemCaseSensitive(filterInfoParser.Get(), "enable_animation");
-    if (cJSON_IsBool(enableAnimation)) {
-        filterInfo.enableAnimation = cJSON_IsTrue(enableAnimation) ? true : false;
-    }
-    return true;
-}
-
-void DragDrawing::ParserCornerRadiusInfo(const cJSON *cornerRadiusInfoStr, FilterInfo &filterInfo)
-{
-    CHKPV(cornerRadiusInfoStr);
-    if (!cJSON_IsObject(cornerRadiusInfoStr)) {
-        FI_HILOGE("CornerRadiusInfoStr is not json object");
-        return;
-    }
-    cJSON *cornerRadius1 = cJSON_GetObjectItemCaseSensitive(cornerRadiusInfoStr, "drag_corner_radius1");
-    if (cJSON_IsNumber(cornerRadius1)) {
-        filterInfo.cornerRadius1 = static_cast<float>(cornerRadius1->valuedouble);
-    }
-    cJSON *cornerRadius2 = cJSON_GetObjectItemCaseSensitive(cornerRadiusInfoStr, "drag_corner_radius2");
-    if (cJSON_IsNumber(cornerRadius2)) {
-        filterInfo.cornerRadius2 = static_cast<float>(cornerRadius2->valuedouble);
-    }
-    cJSON *cornerRadius3 = cJSON_GetObjectItemCaseSensitive(cornerRadiusInfoStr, "drag_corner_radius3");
-    if (cJSON_IsNumber(cornerRadius3)) {
-        filterInfo.cornerRadius3 = static_cast<float>(cornerRadius3->valuedouble);
-    }
-    cJSON *cornerRadius4 = cJSON_GetObjectItemCaseSensitive(cornerRadiusInfoStr, "drag_corner_radius4");
-    if (cJSON_IsNumber(cornerRadius4)) {
-        filterInfo.cornerRadius4 = static_cast<float>(cornerRadius4->valuedouble);
-    }
-}
-
-void DragDrawing::ParserBlurInfo(const cJSON *BlurInfoInfoStr, FilterInfo &filterInfo)
-{
-    CHKPV(BlurInfoInfoStr);
-    if (!cJSON_IsObject(BlurInfoInfoStr)) {
-        FI_HILOGE("BlurInfoInfoStr is not json object");
-        return;
-    }
-    cJSON *opacity = cJSON_GetObjectItemCaseSensitive(BlurInfoInfoStr, "dip_opacity");
-    if (cJSON_IsNumber(opacity)) {
-        if ((opacity->valuedouble) > MAX_OPACITY || (opacity->valuedouble) <= MIN_OPACITY) {
-            FI_HILOGE("Parser opacity limits abnormal, opacity:%{public}f", opacity->valuedouble);
-        } else {
-            filterInfo.opacity = static_cast<float>(opacity->valuedouble);
-        }
-    }
-    float tempCoef1 = 0.0f;
-    cJSON *coef1 = cJSON_GetObjectItemCaseSensitive(BlurInfoInfoStr, "blur_coef1");
-    if (cJSON_IsNumber(coef1)) {
-        tempCoef1 = static_cast<float>(coef1->valuedouble);
-    }
-    float tempCoef2 = 0.0f;
-    cJSON *coef2 = cJSON_GetObjectItemCaseSensitive(BlurInfoInfoStr, "blur_coef2");
-    if (cJSON_IsNumber(coef2)) {
-        tempCoef2 = static_cast<float>(coef2->valuedouble);
+    filterInfo.opacity = filterParams.opacity;
+    filterInfo.coef = { filterParams.blurCoef1, filterParams.blurCoef2 };
+    if ((filterParams.fieldMask & DRAG_FILTER_BLUR_RADIUS) != 0) {
+        filterInfo.blurRadius = AdjustDoubleValue(filterParams.blurRadius);
     }
-    filterInfo.coef = { tempCoef1, tempCoef2 };
-    cJSON *blurRadius = cJSON_GetObjectItemCaseSensitive(BlurInfoInfoStr, "blur_radius");
-    if (cJSON_IsNumber(blurRadius)) {
-        filterInfo.blurRadius = AdjustDoubleValue(blurRadius->valuedouble);
+    filterInfo.blurStaturation = filterParams.blurSaturation;
+    filterInfo.blurBrightness = filterParams.blurBrightness;
+    filterInfo.blurColor = filterParams.blurColor;
+    filterInfo.blurStyle = filterParams.blurStyle;
+    filterInfo.dragNodeGrayscale = filterParams.dragNodeGrayscale;
+    if ((filterParams.fieldMask & DRAG_FILTER_EVENT_ID) != 0) {
+        DRAG_DATA_MGR.SetEventId(filterParams.eventId);
     }
-    cJSON *blurStaturation = cJSON_GetObjectItemCaseSensitive(BlurInfoInfoStr, "blur_staturation");
-    if (cJSON_IsNumber(blurStaturation)) {
-        filterInfo.blurStaturation = static_cast<float>(blurStaturation->valuedouble);
-    }
-    cJSON *blurBrightness = cJSON_GetObjectItemCaseSensitive(BlurInfoInfoStr, "blur_brightness");
-    if (cJSON_IsNumber(blurBrightness)) {
-        filterInfo.blurBrightness = static_cast<float>(blurBrightness->valuedouble);
-    }
-    cJSON *blurColor = cJSON_GetObjectItemCaseSensitive(BlurInfoInfoStr, "blur_color");
-    if (cJSON_IsNumber(blurColor)) {
-        filterInfo.blurColor = static_cast<uint32_t>(blurColor->valueint);
-    }
-    cJSON *blurStyle = cJSON_GetObjectItemCaseSensitive(BlurInfoInfoStr, "blur_style");
-    if (cJSON_IsNumber(blurStyle)) {
-        filterInfo.blurStyle = blurStyle->valueint;
-    }
-    return;
+    filterInfo.enableAnimation = filterParams.enableAnimation;
 }
 
-bool DragDrawing::ParserExtraInfo(const std::string &extraInfoStr, ExtraInfo &extraInfo)
+bool DragDrawing::ApplyExtraParams(const DragExtraParams &extraParams, ExtraInfo &extraInfo)
 {
-    FI_HILOGD("ExtraInfo size:%{public}zu, extraInfo:%{private}s",
-        extraInfoStr.size(), extraInfoStr.c_str());
-    if (extraInfoStr.empty()) {
-        FI_HILOGD("ExtraInfo is empty");
-        return false;
-    }
-    JsonParser extraInfoParser(extraInfoStr.c_str());
-    if (!cJSON_IsObject(extraInfoParser.Get())) {
-        FI_HILOGE("ExtraInfo is not json object");
-        return false;
-    }
-    cJSON *componentType = cJSON_GetObjectItemCaseSensitive(extraInfoParser.Get(), "drag_data_type");
-    if (cJSON_IsString(componentType)) {
-        extraInfo.componentType = componentType->valuestring;
-    }
-    cJSON *blurStyle = cJSON_GetObjectItemCaseSensitive(extraInfoParser.Get(), "drag_blur_style");
-    if (cJSON_IsNumber(blurStyle)) {
-        extraInfo.blurStyle = blurStyle->valueint;
-    }
-    cJSON *cornerRadius = cJSON_GetObjectItemCaseSensitive(extraInfoParser.Get(), "drag_corner_radius");
-    if (cJSON_IsNumber(cornerRadius)) {
-        extraInfo.cornerRadius = static_cast<float>(cornerRadius->valuedouble);
-    }
-    cJSON *allowDistributed = cJSON_GetObjectItemCaseSensitive(extraInfoParser.Get(), "drag_allow_distributed");
-    if (cJSON_IsBool(allowDistributed)) {
-        extraInfo.allowDistributed = cJSON_IsTrue(allowDistributed) ? true : false;
-    }
-    float tempCoef1 = 0.0f;
-    cJSON *coef1 = cJSON_GetObjectItemCaseSensitive(extraInfoParser.Get(), "blur_coef1");
-    if (cJSON_IsNumber(coef1)) {
-        tempCoef1 = static_cast<float>(coef1->valuedouble);
-    }
-    float tempCoef2 = 0.0f;
-    cJSON *coef2 = cJSON_GetObjectItemCaseSensitive(extraInfoParser.Get(), "blur_coef2");
-    if (cJSON_IsNumber(coef2)) {
-        tempCoef2 = static_cast<float>(coef2->valuedouble);
-    }
-    extraInfo.coef = { tempCoef1, tempCoef2 };
-    if (!ParseDropArea(extraInfoParser)) {
+    extraInfo.componentType = extraParams.componentType;
+    extraInfo.blurStyle = extraParams.blurStyle;
+    extraInfo.cornerRadius = extraParams.cornerRadius;
+    extraInfo.allowDistributed = extraParams.allowDistributed;
+    extraInfo.coef = { extraParams.blurCoef1, extraParams.blurCoef2 };
+    if (!ParseDropArea(extraParams)) {
         FI_HILOGE("ParseDropArea failed");
         return false;
     }
@@ -3555,20 +3454,42 @@ bool DragDrawing::ParserExtraInfo(const std::string &extraInfoStr, ExtraInfo &ex
     return true;
 }
 
-bool DragDrawing::ParseDropArea(JsonParser &jsonParser)
+bool DragDrawing::ParseDropArea(const DragExtraParams &extraParams)
 {
     if (dragAnimationType_ == static_cast<int32_t>(DragAnimationType::FOLLOW_HAND_MORPH)) {
-        std::vector<int32_t> dropArea;
-        if (JsonParser::ParseInt32Array(
-            jsonParser.Get(), "dropArea", dropArea, MAX_JSON_ARRAY_SIZE) != RET_OK) {
+        if (!extraParams.hasDropArea) {
             FI_HILOGE("Parse dropArea failed");
             return false;
         }
-        dropArea_ = std::move(dropArea);
+        dropArea_ = extraParams.dropArea;
     }
     return true;
 }
 
+void DragDrawing::InitStyleParams(const DragData &dragData)
+{
+    if (dragData.styleParamsVersion == DRAG_STYLE_PARAMS_VERSION) {
+        if (!ApplyExtraParams(dragData.extraParams, g_drawingInfo.extraInfo)) {
+            FI_HILOGI("No parser valid extraInfo data");
+        }
+        DragFilterParams filterParams = dragData.filterParams;
+        DragStyleParamsParser::Sanitize(filterParams);
+        ApplyFilterParams(filterParams, g_drawingInfo.filterInfo);
+        return;
+    }
+    DragExtraParams extraParams;
+    if ((DragStyleParamsCache::GetInstance().GetExtraParams(dragData.extraInfo, extraParams) != RET_OK) ||
+        !ApplyExtraParams(extraParams, g_drawingInfo.extraInfo)) {
+        FI_HILOGI("No parser valid extraInfo data");
+    }
+    DragFilterParams filterParams;
+    if (DragStyleParamsCache::GetInstance().GetFilterParams(dragData.filterInfo, filterParams) != RET_OK) {
+        FI_HILOGI("No parser valid filterInfo data");
+        return;
+    }
+    ApplyFilterParams(filterParams, g_drawingInfo.filterInfo);
+}
+
 bool DragDrawing::GetAllowDragState()
 {
     return g_drawingInfo.extraInfo.allowDistributed;
@@ -3645,6 +3566,7 @@ void DragDrawing::RotateCanvasNode(float pivotX, float pivotY, float rotation)
 void DragDrawing::LoadNewMaterialLib()
 {
     FI_HILOGI("enter");
+    std::lock_guard<std::mutex> guard(libMutex_);
     if (newMaterialHandler_ == nullptr) {
         char realPath[PATH_MAX] = {};
         if (realpath(NEW_MATERIAL_SO_PATH.c_str(), realPath) == nullptr) {
@@ -3656,6 +3578,8 @@ void DragDrawing::LoadNewMaterialLib()
             FI_HILOGE("Couldn't load new material library with dlopen(). Error: %{public}s", dlerror());
             return;
         }
+        setMaterialEffectByIdFunc_ =
+            reinterpret_cast<SetMaterialEffectByIdFunc>(dlsym(newMaterialHandler_, "SetMaterialEffectById"));
     }
     FI_HILOGI("leave");
 }
@@ -3663,9 +3587,11 @@ void DragDrawing::LoadNewMaterialLib()
 void DragDrawing::UnloadNewMaterialLib()
 {
     FI_HILOGI("enter");
+    std::lock_guard<std::mutex> guard(libMutex_);
     if (newMaterialHandler_ != nullptr) {
         dlclose(newMaterialHandler_);
         newMaterialHandler_ = nullptr;
+        setMaterialEffectByIdFunc_ = nullptr;
         FI_HILOGW("Remove newMaterialHandler success");
     }
     FI_HILOGI("leave");
@@ -4192,7 +4118,7 @@ int32_t DragDrawing::UpdateValidDragStyle(DragCursorStyle style)
         FI_HILOGE("Svg file is invalid");
         return RET_ERR;
     }
-    std::shared_ptr<Media::PixelMap> pixelMap = DecodeSvgToPixelMap(filePath);
+    std::shared_ptr<Media::PixelMap> pixelMap = GetStylePixelMap(filePath);
     CHKPR(pixelMap, RET_ERR);
     bool isPreviousDefaultStyle = g_drawingInfo.isCurrentDefaultStyle;
     g_drawingInfo.isPreviousDefaultStyle = isPreviousDefaultStyle;
@@ -4363,9 +4289,51 @@ void DragDrawing::ClearMultiSelectedData()
         g_drawingInfo.multiSelectedPixelMaps.clear();
         g_drawingInfo.multiSelectedPixelMaps.shrink_to_fit();
     }
+    g_drawingInfo.foldedSelectedNum = 0;
+    stackedLayerNum_.store(0);
+    foldedSelectedNum_.store(0);
+    shadowMemoryBytes_.store(0);
     FI_HILOGD("leave");
 }
 
+void DragDrawing::FoldSelectedPixelMaps()
+{
+    // UpdatePixelMapsAngleAndAlpha() detaches the node that an addition pushes below the stack, and
+    // nothing draws it again. Only that one is folded, deeper nodes from drag start are still drawn.
+    size_t stackedSize =
+        std::min(g_drawingInfo.multiSelectedNodes.size(), g_drawingInfo.multiSelectedPixelMaps.size());
+    if (stackedSize <= MAX_STACKED_PIXELMAPS) {
+        return;
+    }
+    size_t foldedIndex = stackedSize - MAX_STACKED_PIXELMAPS - 1;
+    if ((g_drawingInfo.rootNode != nullptr) && (g_drawingInfo.multiSelectedNodes[foldedIndex] != nullptr)) {
+        g_drawingInfo.rootNode->RemoveChild(g_drawingInfo.multiSelectedNodes[foldedIndex]);
+    }
+    g_drawingInfo.multiSelectedNodes.erase(g_drawingInfo.multiSelectedNodes.begin() + foldedIndex);
+    g_drawingInfo.multiSelectedPixelMaps.erase(g_drawingInfo.multiSelectedPixelMaps.begin() + foldedIndex);
+    ++g_drawingInfo.foldedSelectedNum;
+    FI_HILOGD("Fold selected pixelMap %{public}zu, folded:%{public}zu", foldedIndex, g_drawingInfo.foldedSelectedNum);
+}
+
+void DragDrawing::UpdateShadowMemoryStat()
+{
+    uint64_t bytes = 0;
+    auto currentPixelMap = DragDrawing::AccessGlobalPixelMapLocked();
+    if (currentPixelMap != nullptr) {
+        bytes += static_cast<uint64_t>(currentPixelMap->GetByteCount());
+    }
+    for (const auto &pixelMap : g_drawingInfo.multiSelectedPixelMaps) {
+        if (pixelMap != nullptr) {
+            bytes += static_cast<uint64_t>(pixelMap->GetByteCount());
+        }
+    }
+    stackedLayerNum_.store(g_drawingInfo.multiSelectedPixelMaps.size() + 1);
+    foldedSelectedNum_.store(g_drawingInfo.foldedSelectedNum);
+    shadowMemoryBytes_.store(bytes);
+    uint64_t peak = peakShadowMemoryBytes_.load();
+    while ((bytes > peak) && !peakShadowMemoryBytes_.compare_exchange_weak(peak, bytes)) {}
+}
+
 void DragDrawing::RotateDisplayXY(int32_t &displayX, int32_t &displayY)
 {
 Rosen::Rotation rotation = GetRotation(g_drawingInfo.displayId);
@@ -4608,14 +4576,137 @@ void DragDrawing::ResetDragAnimationParameter()
 }
 
 #ifndef OHOS_BUILD_ENABLE_ARKUI_X
+void DragDrawing::StartVSyncSession()
+{
+    vSyncStation_.StartSession();
+}
+
 void DragDrawing::StopVSyncStation()
 {
     FI_HILOGI("enter");
     dragSmoothProcessor_.ResetParameters();
-    vSyncStation_.StopVSyncRequest();
+    frameRecorder_.EndDrag();
+    uint64_t epoch = vSyncStation_.StopVSyncRequest();
+    CHKPV(context_);
+    // A stale timer is a no-op, TeardownRunner() ignores it once the next session has started.
+    int32_t timerId = context_->GetTimerManager().AddTimer(DragVSyncStation::IDLE_TEARDOWN_TIMEOUT_MS, 1,
+        [this, epoch]() {
+        vSyncStation_.TeardownRunner(epoch);
+    });
+    if (timerId < 0) {
+        FI_HILOGW("Add idle teardown timer failed, render runner stays alive");
+    }
     FI_HILOGI("leave");
 }
 
+void DragDrawing::WarmUp(bool isRTL)
+{
+    if (warmUpThread_.joinable()) {
+        FI_HILOGW("Warm-up has already run");
+        return;
+    }
+    warmUpThread_ = std::thread([this, isRTL] { RunWarmUp(isRTL); });
+}
+
+void DragDrawing::RunWarmUp(bool isRTL)
+{
+    FI_HILOGI("enter");
+    SetThreadName("os_drag_warm_up");
+    if (setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), WARM_UP_NICE) != 0) {
+        FI_HILOGW("Lower warm-up priority failed, errno:%{public}d", errno);
+    }
+    auto begin = std::chrono::steady_clock::now();
+    LoadDragDropLib();
+    if (access(NEW_MATERIAL_SO_PATH.c_str(), F_OK) == 0) {
+        LoadNewMaterialLib();
+    }
+    float scaling = GetScaling();
+    for (DragCursorStyle style : { DragCursorStyle::COPY, DragCursorStyle::MOVE, DragCursorStyle::FORBIDDEN }) {
+        std::string filePath = GetStyleIconPath(style, isRTL);
+        if (IsValidSvgFile(filePath) && (GetStyleIcon(filePath, scaling) == nullptr)) {
+            FI_HILOGW("Decode style icon failed, style:%{public}d", static_cast<int32_t>(style));
+        }
+    }
+    DropAnimationInfo info;
+    if (!ParseDropAnimationInfo(WARM_UP_DRAG_ANIMATION_INFO, info)) {
+        FI_HILOGW("Pre-parse drop animation info failed");
+    }
+    warmUpCostUs_.store(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - begin).count());
+    FI_HILOGI("leave, cost:%{public}" PRId64 "us", warmUpCostUs_.load());
+}
+
+std::string DragDrawing::GetStyleIconPath(DragCursorStyle style, bool isRTL)
+{
+    switch (style) {
+        case DragCursorStyle::COPY: {
+            return (isRTL ? COPY_ONE_DRAG_RTL_PATH : COPY_ONE_DRAG_PATH);
+        }
+        case DragCursorStyle::MOVE: {
+            return (isRTL ? MOVE_DRAG_RTL_PATH : MOVE_DRAG_PATH);
+        }
+        case DragCursorStyle::FORBIDDEN: {
+            return (isRTL ? FORBID_ONE_DRAG_RTL_PATH : FORBID_ONE_DRAG_PATH);
+        }
+        default: {
+            return std::string();
+        }
+    }
+}
+
+void DragDrawing::ReleaseWarmUpCache()
+{
+    std::lock_guard<std::mutex> guard(styleIconMutex_);
+    FI_HILOGI("Release %{public}zu style icons", styleIconCache_.size());
+    styleIconCache_.clear();
+}
+
+void DragDrawing::DumpWarmUp(int32_t fd) const
+{
+    std::lock_guard<std::mutex> guard(styleIconMutex_);
+    dprintf(fd, "Drag warm-up:\n\twarmUpCost:%" PRId64 "us\n\tcachedStyleIcons:%zu\n", warmUpCostUs_.load(),
+        styleIconCache_.size());
+}
+
+void DragDrawing::RequestSelectedFlush()
+{
+    addedSelectedCount_.fetch_add(1);
+    if (selectedFlushCallback_ == nullptr) {
+        selectedFlushCallback_ = std::make_shared<DragFrameCallback>([this](uint64_t) {
+            selectedFlushCount_.fetch_add(1);
+            Rosen::RSTransaction::FlushImplicitTransaction();
+        });
+    }
+    if (vSyncStation_.RequestFrame(TYPE_FLUSH_SELECTED_PIXELMAPS, selectedFlushCallback_) != RET_OK) {
+        FI_HILOGW("Request frame failed, flush now");
+        selectedFlushCount_.fetch_add(1);
+        Rosen::RSTransaction::FlushImplicitTransaction();
+    }
+}
+
+void DragDrawing::DumpSelectedStack(int32_t fd) const
+{
+    dprintf(fd, "Drag selected stack:\n\tdragNum:%d\n\tstackedLayers:%zu\n\tfoldedItems:%zu\n"
+        "\tshadowMemory:%" PRIu64 "KB\n\tpeakShadowMemory:%" PRIu64 "KB\n\taddedPixelMaps:%u\n\tflushes:%u\n",
+        g_drawingInfo.currentDragNum, stackedLayerNum_.load(), foldedSelectedNum_.load(),
+        shadowMemoryBytes_.load() / BYTES_PER_KB,
+        peakShadowMemoryBytes_.load() / BYTES_PER_KB, addedSelectedCount_.load(), selectedFlushCount_.load());
+}
+
+void DragDrawing::DumpVSyncStation(int32_t fd) const
+{
+    vSyncStation_.Dump(fd);
+}
+
+void DragDrawing::DumpFrameRecorder(int32_t fd, bool raw) const
+{
+    if (raw) {
+        frameRecorder_.DumpRaw(fd);
+    } else {
+        frameRecorder_.Dump(fd);
+    }
+}
+
 void DragDrawing::SetDragStyleRTL(bool isRTL)
 {
     FI_HILOGI("enter");
@@ -4870,9 +4961,14 @@ bool DragDrawing::ParserRadius(float &radius)
 DragDrawing::~DragDrawing()
 {
 #ifndef OHOS_BUILD_ENABLE_ARKUI_X
+    if (warmUpThread_.joinable()) {
+        warmUpThread_.join();
+    }
     if (dragExtHandler_ != nullptr) {
         dlclose(dragExtHandler_);
         dragExtHandler_ = nullptr;
+        dragStartExtFunc_ = nullptr;
+        dragNotifyExtFunc_ = nullptr;
     }
 #endif // OHOS_BUILD_ENABLE_ARKUI_X
     UnloadNewMaterialLib();
@@ -5498,10 +5594,16 @@ void DragDrawing::SetSVGFilePath(const std::string &filePath)
 void DragDrawing::LoadDragDropLib()
 {
     FI_HILOGI("Begin to open drag drop extension library");
+    std::lock_guard<std::mutex> guard(libMutex_);
     if (dragExtHandler_ == nullptr) {
         dragExtHandler_ = dlopen(DRAG_DROP_EXTENSION_SO_PATH.c_str(), RTLD_LAZY);
+        if (dragExtHandler_ == nullptr) {
+            FI_HILOGW("Drag drop extension library is not available");
+            return;
+        }
+        dragStartExtFunc_ = reinterpret_cast<DragStartExtFunc>(dlsym(dragExtHandler_, "OnStartDragExt"));
+        dragNotifyExtFunc_ = reinterpret_cast<DragNotifyExtFunc>(dlsym(dragExtHandler_, "OnNotifyDragInfo"));
     }
-    CHKPL(dragExtHandler_);
     FI_HILOGI("End to open drag drop extension library");
 }
 
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "drag_frame_recorder.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+
+#include "devicestatus_define.h"
+
+#undef LOG_TAG
+#define LOG_TAG "DragFrameRecorder"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace {
+constexpr uint64_t VSYNC_JITTER_NS { 1 * 1000 * 1000 };
+constexpr uint64_t STARVED_PERIODS { 2 };
+constexpr double NS_PER_MS { 1.0e6 };
+constexpr size_t PERCENT { 100 };
+constexpr size_t P50 { 50 };
+constexpr size_t P90 { 90 };
+constexpr size_t P99 { 99 };
+
+uint64_t Elapsed(uint64_t from, uint64_t to)
+{
+    return ((from != 0) && (to > from)) ? (to - from) : 0;
+}
+
+double Percentile(const std::vector<uint64_t> &sorted, size_t percent)
+{
+    if (sorted.empty()) {
+        return 0.0;
+    }
+    size_t rank = (sorted.size() * percent + PERCENT - 1) / PERCENT;
+    return sorted[std::clamp<size_t>(rank, 1, sorted.size()) - 1] / NS_PER_MS;
+}
+
+void DumpPercentiles(int32_t fd, const char *name, std::vector<uint64_t> &values)
+{
+    std::sort(values.begin(), values.end());
+    dprintf(fd, " | %s p50/p90/p99:%.2f/%.2f/%.2fms", name, Percentile(values, P50), Percentile(values, P90),
+        Percentile(values, P99));
+}
+
+void DumpDrag(int32_t fd, const std::vector<DragFrameRecord> &frames, size_t begin, size_t end, bool current)
+{
+    size_t missedVSyncs = 0;
+    size_t lateFrames = 0;
+    size_t starvedFrames = 0;
+    std::vector<uint64_t> latencies;
+    std::vector<uint64_t> workTimes;
+    latencies.reserve(end - begin);
+    workTimes.reserve(end - begin);
+    for (size_t index = begin; index < end; ++index) {
+        const DragFrameRecord &frame = frames[index];
+        missedVSyncs += ((frame.flags & DRAG_FRAME_MISSED_VSYNC) != 0) ? 1 : 0;
+        lateFrames += ((frame.flags & DRAG_FRAME_LATE) != 0) ? 1 : 0;
+        starvedFrames += ((frame.flags & DRAG_FRAME_INPUT_STARVED) != 0) ? 1 : 0;
+        latencies.push_back(Elapsed(frame.inputTime, frame.flushTime));
+        workTimes.push_back(Elapsed(frame.vsyncTime, frame.flushTime));
+    }
+    dprintf(fd, "drag:%u%s | frames:%zu | missedVSync:%zu | late:%zu | inputStarved:%zu", frames[begin].dragId,
+        current ? "(current)" : "", end - begin, missedVSyncs, lateFrames, starvedFrames);
+    DumpPercentiles(fd, "input-to-flush", latencies);
+    DumpPercentiles(fd, "vsync-to-flush", workTimes);
+    dprintf(fd, "\n");
+}
+} // namespace
+
+uint64_t DragFrameRecorder::Now()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void DragFrameRecorder::BeginDrag()
+{
+    dragId_.fetch_add(1, std::memory_order_relaxed);
+    inputTime_.store(0, std::memory_order_relaxed);
+    requestTime_.store(0, std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        lastInputTime_ = 0;
+        inputArrived_ = false;
+    }
+    active_.store(true, std::memory_order_release);
+}
+
+void DragFrameRecorder::EndDrag()
+{
+    active_.store(false, std::memory_order_release);
+}
+
+void DragFrameRecorder::RecordInput(uint64_t inputTime)
+{
+    inputTime_.store(inputTime, std::memory_order_relaxed);
+}
+
+void DragFrameRecorder::RecordRequest()
+{
+    uint64_t expected = 0;
+    requestTime_.compare_exchange_strong(expected, Now(), std::memory_order_relaxed);
+}
+
+void DragFrameRecorder::RecordFrame(uint64_t vsyncTime, uint64_t vSyncPeriod, const DragMoveEvent &sample,
+    uint64_t flushTime)
+{
+    if (!active_.load(std::memory_order_acquire)) {
+        return;
+    }
+    std::lock_guard<std::mutex> guard(mutex_);
+    DragFrameRecord &frame = frames_[written_ % FRAME_CAPACITY];
+    frame.inputTime = inputTime_.load(std::memory_order_relaxed);
+    frame.requestTime = requestTime_.exchange(0, std::memory_order_relaxed);
+    frame.sampleTime = sample.timestamp;
+    frame.vsyncTime = vsyncTime;
+    frame.flushTime = flushTime;
+    frame.displayX = sample.displayX;
+    frame.displayY = sample.displayY;
+    frame.dragId = dragId_.load(std::memory_order_relaxed);
+    frame.flags = 0;
+    if (Elapsed(frame.requestTime, vsyncTime) > vSyncPeriod + VSYNC_JITTER_NS) {
+        frame.flags |= DRAG_FRAME_MISSED_VSYNC;
+    }
+    if (Elapsed(vsyncTime, flushTime) > vSyncPeriod) {
+        frame.flags |= DRAG_FRAME_LATE;
+    }
+    // A drag held still sends no moves, so a stale move only counts while moves were still arriving.
+    if (inputArrived_ && (Elapsed(frame.inputTime, vsyncTime) > STARVED_PERIODS * vSyncPeriod)) {
+        frame.flags |= DRAG_FRAME_INPUT_STARVED;
+    }
+    inputArrived_ = (frame.inputTime != lastInputTime_);
+    lastInputTime_ = frame.inputTime;
+    ++written_;
+}
+
+std::vector<DragFrameRecord> DragFrameRecorder::GetFrames() const
+{
+    std::vector<DragFrameRecord> frames;
+    frames.reserve(FRAME_CAPACITY);
+    std::lock_guard<std::mutex> guard(mutex_);
+    uint64_t begin = (written_ > FRAME_CAPACITY) ? (written_ - FRAME_CAPACITY) : 0;
+    for (uint64_t index = begin; index < written_; ++index) {
+        frames.push_back(frames_[index % FRAME_CAPACITY]);
+    }
+    return frames;
+}
+
+void DragFrameRecorder::Dump(int32_t fd) const
+{
+    std::vector<DragFrameRecord> frames = GetFrames();
+    dprintf(fd, "Drag frames:%zu recorded\n", frames.size());
+    std::vector<std::pair<size_t, size_t>> drags;
+    for (size_t end = frames.size(); (end > 0) && (drags.size() < MAX_DUMPED_DRAGS);) {
+        size_t begin = end - 1;
+        while ((begin > 0) && (frames[begin - 1].dragId == frames[end - 1].dragId)) {
+            --begin;
+        }
+        drags.emplace_back(begin, end);
+        end = begin;
+    }
+    uint32_t currentDragId = active_.load(std::memory_order_acquire) ? dragId_.load(std::memory_order_relaxed) : 0;
+    for (auto iter = drags.rbegin(); iter != drags.rend(); ++iter) {
+        DumpDrag(fd, frames, iter->first, iter->second, frames[iter->first].dragId == currentDragId);
+    }
+}
+
+void DragFrameRecorder::DumpRaw(int32_t fd) const
+{
+    std::vector<DragFrameRecord> frames = GetFrames();
+    dprintf(fd, "dragId,inputTime,requestTime,sampleTime,vsyncTime,flushTime,displayX,displayY,flags\n");
+    for (const auto &frame : frames) {
+        dprintf(fd, "%u,%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%.1f,%.1f,%u\n", frame.dragId,
+            frame.inputTime, frame.requestTime, frame.sampleTime, frame.vsyncTime, frame.flushTime,
+            frame.displayX, frame.displayY, frame.flags);
+    }
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
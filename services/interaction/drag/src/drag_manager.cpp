@@ -16,6 +16,7 @@
 #include "drag_manager.h"
 
 #include <atomic>
+#include <cinttypes>
 
 #include "display_manager.h"
 #include "product_name_definition_parser.h"
@@ -35,6 +36,8 @@
 #endif // MSDP_FRAMEWORK_UDMF_ENABLED
 #include "unified_types.h"
 #include "window_manager_lite.h"
+
+#include "drop_bundle.h"
 #endif // OHOS_BUILD_ENABLE_ARKUI_X
 
 #include <dlfcn.h>
@@ -56,7 +59,6 @@ namespace DeviceStatus {
 namespace {
 constexpr int32_t TIMEOUT_MS { 3000 };
 constexpr int32_t INTERVAL_MS { 500 };
-constexpr int32_t POWER_SQUARED { 2 };
 constexpr int32_t TEN_POWER { 10 * 10 };
 constexpr int32_t DUMP_PID { 0 };
 std::atomic<int64_t> g_startFilterTime { -1 };
@@ -84,6 +86,9 @@ static std::map<std::string, std::string> g_rtlLanguageMap {
     { "he", "hebrew" },
     { "ug", "uyghur" },
 };
+const std::string DRAG_WARM_UP_DELAY_KEY {"const.msdp.drag.warmup_delay_ms"};
+constexpr int32_t DEFAULT_WARM_UP_DELAY_MS { 3000 };
+constexpr int32_t MAX_WARM_UP_DELAY_MS { 60000 };
 const std::string PRODUCT_TYPE = OHOS::system::GetParameter("const.build.product", "HYM");
 #endif // OHOS_BUILD_ENABLE_ARKUI_X
 #ifdef OHOS_ENABLE_PULLTHROW
@@ -137,6 +142,13 @@ int32_t DragManager::Init(IContext* context)
     CHKPR(context, RET_ERR);
     context_ = context;
     int32_t repeatCount = 1;
+    int32_t warmUpDelay = OHOS::system::GetIntParameter(DRAG_WARM_UP_DELAY_KEY, DEFAULT_WARM_UP_DELAY_MS, 0,
+        MAX_WARM_UP_DELAY_MS);
+    if (warmUpDelay > 0) {
+        context_->GetTimerManager().AddTimer(warmUpDelay, repeatCount, [this]() {
+            WarmUp();
+        });
+    }
     context_->GetTimerManager().AddTimer(INTERVAL_MS, repeatCount, [this]() {
         if (eventHub_ == nullptr) {
             eventHub_ = EventHub::GetEventHub(context_);
@@ -394,6 +406,28 @@ int32_t DragManager::StartDrag(
         dragRadarPackageName);
     dragPackageName_ = dragRadarPackageName;
     PrintDragData(dragData, packageName);
+    dragDrawing_.StartVSyncSession();
+    if (StartDragInSession(dragData, pid, dragRadarPackageName) != RET_OK) {
+        dragDrawing_.StopVSyncStation();
+        return RET_ERR;
+    }
+    dragAnimationType_ = dragData.dragAnimationType;
+    SetDragState(DragState::START);
+    dragDrawing_.OnStartDragExt();
+    stateNotify_.StateChangedNotify(DragState::START);
+    StateChangedNotify(DragState::START);
+    ReportStartDragRadarInfo(BizState::STATE_IDLE, StageRes::RES_SUCCESS, DragRadarErrCode::DRAG_SUCCESS, peerNetId,
+        dragRadarPackageName);
+    if ((pid == -1) && !isLongPressDrag_) {
+        ReportStartDragUEInfo(packageName);
+    }
+    FI_HILOGI("leave");
+    return RET_OK;
+}
+
+int32_t DragManager::StartDragInSession(const DragData &dragData, int32_t pid,
+    const DragRadarPackageName &dragRadarPackageName)
+{
     if (InitDataManager(dragData, dragRadarPackageName.appCaller) != RET_OK) {
         FI_HILOGE("Failed to init data manager");
         ResetMouseDragMonitorInfo();
@@ -409,6 +443,7 @@ int32_t DragManager::StartDrag(
         ResetMouseDragMonitorInfo();
         return RET_ERR;
     }
+    InvalidateDropBundle();
     if (notifyPullUpCallback_ != nullptr) {
         notifyPullUpCallback_(false);
     }
@@ -416,17 +451,6 @@ int32_t DragManager::StartDrag(
         FI_HILOGE("Deliver nonce to input failed");
         return RET_ERR;
     }
-    dragAnimationType_ = dragData.dragAnimationType;
-    SetDragState(DragState::START);
-    dragDrawing_.OnStartDragExt();
-    stateNotify_.StateChangedNotify(DragState::START);
-    StateChangedNotify(DragState::START);
-    ReportStartDragRadarInfo(BizState::STATE_IDLE, StageRes::RES_SUCCESS, DragRadarErrCode::DRAG_SUCCESS, peerNetId,
-        dragRadarPackageName);
-    if ((pid == -1) && !isLongPressDrag_) {
-        ReportStartDragUEInfo(packageName);
-    }
-    FI_HILOGI("leave");
     return RET_OK;
 }
 
@@ -614,6 +638,7 @@ int32_t DragManager::StopDrag(const DragDropResult &dropResult, const std::strin
     DRAG_DATA_MGR.ResetDragData();
     dragResult_ = static_cast<DragResult>(dropResult.result);
 #endif // OHOS_BUILD_ENABLE_ARKUI_X
+    shadowCache_.Clear();
     SetDragState(DragState::STOP);
     if (GetControlCollaborationVisible()) {
         SetControlCollaborationVisible(false);
@@ -673,21 +698,27 @@ int32_t DragManager::GetUdKey(std::string &udKey) const
 }
 
 #ifndef OHOS_BUILD_ENABLE_ARKUI_X
-void DragManager::UpdateDragStylePositon()
+bool DragManager::GetSystemLanguageRTL(bool &isRTL) const
 {
-    FI_HILOGI("enter");
     std::string systemLanguage = system::GetParameter(LANGUAGE_KEY, "");
     if (systemLanguage.empty()) {
         systemLanguage = system::GetParameter(DEFAULT_LANGUAGE_KEY, "");
         if (systemLanguage.empty()) {
             FI_HILOGE("Get systemLanguage failed");
-            return;
+            return false;
         }
     }
     std::transform(systemLanguage.begin(), systemLanguage.end(), systemLanguage.begin(), ::tolower);
+    isRTL = (g_rtlLanguageMap.find(systemLanguage) != g_rtlLanguageMap.end());
+    return true;
+}
+
+void DragManager::UpdateDragStylePositon()
+{
+    FI_HILOGI("enter");
     bool isCurrentRTL = false;
-    if (g_rtlLanguageMap.find(systemLanguage) != g_rtlLanguageMap.end()) {
-        isCurrentRTL = true;
+    if (!GetSystemLanguageRTL(isCurrentRTL)) {
+        return;
     }
     if (isRTL_ != isCurrentRTL) {
         isRTL_ = isCurrentRTL;
@@ -759,9 +790,19 @@ int32_t DragManager::UpdateShadowPic(const ShadowInfo &shadowInfo)
         FI_HILOGE("No drag instance running, can not update shadow picture");
         return RET_ERR;
     }
+    if (shadowCache_.IsShowing(shadowInfo)) {
+        FI_HILOGI("Same shadow on screen, skip redraw");
+        return RET_OK;
+    }
     DRAG_DATA_MGR.SetShadowInfos({ shadowInfo });
+    if (dragDrawing_.UpdateShadowPic(shadowInfo) != RET_OK) {
+        FI_HILOGE("Update shadow picture failed");
+        shadowCache_.Clear();
+        return RET_ERR;
+    }
+    shadowCache_.SetShowing(shadowInfo);
     FI_HILOGI("leave");
-    return dragDrawing_.UpdateShadowPic(shadowInfo);
+    return RET_OK;
 }
 
 int32_t DragManager::GetDragData(DragData &dragData)
@@ -842,6 +883,73 @@ int32_t DragManager::NotifyHideIcon()
     return RET_OK;
 }
 
+int32_t DragManager::PushDropBundle()
+{
+    CHKPR(context_, RET_ERR);
+    DropBundle bundle;
+    bundle.targetPid = GetDragTargetPid();
+    bundle.dragSeq = dropBundleSeq_;
+    SocketSessionPtr session = context_->GetSocketSessionManager().FindSessionByPid(bundle.targetPid);
+    if (session == nullptr) {
+        FI_HILOGD("No session of target:%{public}d", bundle.targetPid);
+        return RET_ERR;
+    }
+    // Fields are taken through the same checks as the requests they answer, with the target as caller.
+    if ((GetUdKey(bundle.targetPid, bundle.udKey, false) == RET_OK) && !bundle.udKey.empty()) {
+        bundle.fields |= DROP_BUNDLE_UD_KEY;
+    }
+    if (GetDragSummary(bundle.summarys) == RET_OK) {
+        bundle.fields |= DROP_BUNDLE_SUMMARY;
+    }
+    if (GetExtraInfo(bundle.extraInfo) == RET_OK) {
+        bundle.fields |= DROP_BUNDLE_EXTRA_INFO;
+    }
+    if ((GetDragBundleInfo(bundle.bundleInfo) == RET_OK) && !bundle.bundleInfo.bundleName.empty()) {
+        bundle.fields |= DROP_BUNDLE_BUNDLE_INFO;
+    }
+    NetPacket pkt(MessageId::DRAG_DROP_BUNDLE);
+    if (DropBundlePacker::Marshalling(bundle, pkt) != RET_OK) {
+        // Extra info is the only field of unbounded size, leave it to be asked for.
+        FI_HILOGW("Drop bundle too large, extraInfo size:%{public}zu", bundle.extraInfo.size());
+        bundle.fields &= ~DROP_BUNDLE_EXTRA_INFO;
+        NetPacket smallPkt(MessageId::DRAG_DROP_BUNDLE);
+        if (DropBundlePacker::Marshalling(bundle, smallPkt) != RET_OK) {
+            return RET_ERR;
+        }
+        pkt = smallPkt;
+    }
+    if (!session->SendMsg(pkt)) {
+        FI_HILOGE("Failed to send drop bundle");
+        return MSG_SEND_FAIL;
+    }
+    dropBundlePid_ = bundle.targetPid;
+    FI_HILOGI("Drop bundle pushed to target:%{public}d, dragSeq:%{public}u, fields:%{public}u",
+        bundle.targetPid, bundle.dragSeq, bundle.fields);
+    return RET_OK;
+}
+
+void DragManager::InvalidateDropBundle()
+{
+    ++dropBundleSeq_;
+    if (dropBundlePid_ < 0) {
+        return;
+    }
+    DropBundle bundle;
+    bundle.targetPid = dropBundlePid_;
+    bundle.dragSeq = dropBundleSeq_;
+    dropBundlePid_ = -1;
+    CHKPV(context_);
+    SocketSessionPtr session = context_->GetSocketSessionManager().FindSessionByPid(bundle.targetPid);
+    if (session == nullptr) {
+        FI_HILOGD("No session of target:%{public}d", bundle.targetPid);
+        return;
+    }
+    NetPacket pkt(MessageId::DRAG_DROP_BUNDLE);
+    if ((DropBundlePacker::Marshalling(bundle, pkt) != RET_OK) || !session->SendMsg(pkt)) {
+        FI_HILOGW("Failed to invalidate drop bundle of target:%{public}d", bundle.targetPid);
+    }
+}
+
 int32_t DragManager::DealPullInWindowEvent(std::shared_ptr<MMI::PointerEvent> pointerEvent, int32_t targetDisplayId)
 {
     CHKPR(pointerEvent, RET_ERR);
@@ -1026,6 +1134,8 @@ void DragManager::InPullThrow(std::shared_ptr<MMI::PointerEvent> pointerEvent)
         throwState_ = ThrowState::NOT_THROW;
     } else {
         inHoveringState_ = false;
+        // OnPullThrow() ended the vsync session, the drag goes on from here and needs frames again.
+        dragDrawing_.StartVSyncSession();
         dragDrawing_.PullThrowZoomOutAnimation();
         FI_HILOGD("inHoveringState_: %{public}d", inHoveringState_);
         if (pointerEvent->GetPointerAction() == MMI::PointerEvent::POINTER_ACTION_BUTTON_DOWN) {
@@ -1189,35 +1299,35 @@ void DragManager::DragCallback(std::shared_ptr<MMI::PointerEvent> pointerEvent)
 
 void DragManager::DoLongPressDragZoomOutAnimation(int32_t displayX, int32_t displayY)
 {
-    auto LongPressDragZoomOutAnimation = [displayX, displayY, this]() {
-        if (needLongPressDragAnimation_) {
-            DragData dragData = DRAG_DATA_MGR.GetDragData();
-            int32_t deltaX = abs(displayX - dragData.displayX);
-            int32_t deltaY = abs(displayY - dragData.displayY);
-            if ((pow(deltaX, POWER_SQUARED) + pow(deltaY, POWER_SQUARED)) > TEN_POWER) {
-                dragDrawing_.LongPressDragZoomOutAnimation();
-                needLongPressDragAnimation_ = false;
-            }
-        }
+    if (!isLongPressDrag_ || !needLongPressDragAnimation_) {
+        return;
+    }
+    int64_t deltaX = static_cast<int64_t>(displayX) - dragStartX_.load();
+    int64_t deltaY = static_cast<int64_t>(displayY) - dragStartY_.load();
+    if ((deltaX * deltaX + deltaY * deltaY) <= TEN_POWER) {
+        return;
+    }
+    if (!needLongPressDragAnimation_.exchange(false)) {
+        return;
+    }
+    CHKPV(context_);
+    int32_t ret = context_->GetDelegateTasks().PostAsyncTask([this] {
+        dragDrawing_.LongPressDragZoomOutAnimation();
         return RET_OK;
-    };
-    if (isLongPressDrag_) {
-        CHKPV(context_);
-        int32_t ret = context_->GetDelegateTasks().PostAsyncTask(LongPressDragZoomOutAnimation);
-        if (ret != RET_OK) {
-            FI_HILOGE("Post async task failed, ret:%{public}d", ret);
-        }
+    });
+    if (ret != RET_OK) {
+        FI_HILOGE("Post async task failed, ret:%{public}d", ret);
     }
 }
 
 void DragManager::OnDragMove(std::shared_ptr<MMI::PointerEvent> pointerEvent)
 {
     CHKPV(pointerEvent);
-    DragData dragData = DRAG_DATA_MGR.GetDragData();
-    if (pointerEvent->GetSourceType() != dragData.sourceType) {
+    int32_t dragSourceType = dragSourceType_.load();
+    if (pointerEvent->GetSourceType() != dragSourceType) {
         FI_HILOGW("The pointer source type invaild, the event should be ignored,"
             "pointer sourceType:%{public}d, drag sourceType:%{public}d",
-            pointerEvent->GetSourceType(), dragData.sourceType);
+            pointerEvent->GetSourceType(), dragSourceType);
         return;
     }
     MMI::PointerEvent::PointerItem pointerItem;
@@ -1326,6 +1436,7 @@ int32_t DragManager::OnDragUp(std::shared_ptr<MMI::PointerEvent> pointerEvent)
 #endif // OHOS_BUILD_PC_PRODUCT
 
 #ifndef OHOS_BUILD_ENABLE_ARKUI_X
+    PushDropBundle();
     CHKPR(context_, RET_ERR);
     int32_t repeatCount = 1;
     timerId_ = context_->GetTimerManager().AddTimer(TIMEOUT_MS, repeatCount, [this, dragData]() {
@@ -1348,7 +1459,6 @@ int32_t DragManager::OnDragUp(std::shared_ptr<MMI::PointerEvent> pointerEvent)
 }
 
 #ifndef OHOS_BUILD_ENABLE_ARKUI_X
-#ifdef OHOS_DRAG_ENABLE_INTERCEPTOR
 void DragManager::InterceptorConsumer::OnInputEvent(std::shared_ptr<MMI::KeyEvent> keyEvent) const
 {
 }
@@ -1368,7 +1478,12 @@ void DragManager::InterceptorConsumer::OnInputEvent(std::shared_ptr<MMI::Pointer
     CHKPV(pointerEventCallback_);
     pointerEventCallback_(pointerEvent);
     pointerEvent->AddFlag(MMI::InputEvent::EVENT_FLAG_NO_INTERCEPT);
-    MMI::InputManager::GetInstance()->SimulateInputEvent(pointerEvent);
+    if (injectCallback_ != nullptr) {
+        injectCallback_(pointerEvent);
+    } else {
+        MMI::InputManager::GetInstance()->SimulateInputEvent(pointerEvent);
+    }
+    ++stats_.reinjected;
     if (pointerEvent->GetPointerAction() == MMI::PointerEvent::POINTER_ACTION_PULL_UP) {
         FI_HILOGI("Pointer button is released, appened extra data");
         MMI::InputManager::GetInstance()->AppendExtraData(DragManager::CreateExtraData(false));
@@ -1378,7 +1493,6 @@ void DragManager::InterceptorConsumer::OnInputEvent(std::shared_ptr<MMI::Pointer
 void DragManager::InterceptorConsumer::OnInputEvent(std::shared_ptr<MMI::AxisEvent> axisEvent) const
 {
 }
-#endif // OHOS_DRAG_ENABLE_INTERCEPTOR
 
 #ifdef OHOS_DRAG_ENABLE_MONITOR
 void DragManager::MonitorConsumer::OnInputEvent(std::shared_ptr<MMI::KeyEvent> keyEvent) const
@@ -1391,6 +1505,7 @@ void DragManager::MonitorConsumer::OnInputEvent(std::shared_ptr<MMI::PointerEven
     FI_HILOGD("enter");
     CHKPV(pointerEvent);
     CHKPV(pointerEventCallback_);
+    ++stats_.observed;
     pointerEventCallback_(pointerEvent);
     if (pointerEvent->GetPointerAction() == MMI::PointerEvent::POINTER_ACTION_PULL_UP) {
         FI_HILOGI("Pointer button is released, appened extra data");
@@ -1429,6 +1544,8 @@ void DragManager::Dump(int32_t fd) const
             GetDragResult(dragResult_).c_str(), pointerEventMonitorId_, GetDragTargetPid(), targetTid,
             GetDragCursorStyle(style).c_str(), DRAG_DATA_MGR.GetDragWindowVisible() ? "true" : "false");
 #endif // OHOS_DRAG_ENABLE_MONITOR
+    dprintf(fd, "pointerEvents | observed:%" PRIu64 " | reinjected:%" PRIu64 "\n",
+            pointerEventStats_.observed.load(), pointerEventStats_.reinjected.load());
     DragData dragData = DRAG_DATA_MGR.GetDragData();
     std::string udKey;
     if (RET_ERR == GetUdKey(DUMP_PID, udKey, true)) {
@@ -1452,6 +1569,31 @@ void DragManager::Dump(int32_t fd) const
         }
     }
     dprintf(fd, "}\n");
+    dragDrawing_.DumpVSyncStation(fd);
+    dragDrawing_.DumpWarmUp(fd);
+    dragDrawing_.DumpSelectedStack(fd);
+    dragDrawing_.DumpFrameRecorder(fd, false);
+}
+
+void DragManager::DumpFrames(int32_t fd) const
+{
+    dragDrawing_.DumpFrameRecorder(fd, true);
+}
+
+void DragManager::WarmUp()
+{
+    if (dragState_ != DragState::STOP) {
+        FI_HILOGI("Dragging, skip warm-up");
+        return;
+    }
+    bool isRTL = false;
+    GetSystemLanguageRTL(isRTL);
+    dragDrawing_.WarmUp(isRTL);
+}
+
+void DragManager::ReleaseWarmUpCache()
+{
+    dragDrawing_.ReleaseWarmUpCache();
 }
 #endif // OHOS_BUILD_ENABLE_ARKUI_X
 
@@ -1530,6 +1672,7 @@ MMI::ExtraData DragManager::CreatePullThrowExtraData(bool appended, bool drawCur
     mouseDragData.sourceType = MMI::PointerEvent::SOURCE_TYPE_MOUSE;
     mouseDragData.pointerId = pointerEvent->GetPointerId();
     DRAG_DATA_MGR.Init(mouseDragData, mouseDragData.appCaller);
+    dragSourceType_ = mouseDragData.sourceType;
 
     MMI::ExtraData extraData;
     extraData.buffer = mouseDragData.buffer;
@@ -1550,6 +1693,9 @@ int32_t DragManager::InitDataManager(const DragData &dragData, const std::string
 {
     FI_HILOGI("enter");
     DRAG_DATA_MGR.Init(dragData, appCaller);
+    dragSourceType_ = dragData.sourceType;
+    dragStartX_ = dragData.displayX;
+    dragStartY_ = dragData.displayY;
     FI_HILOGI("leave");
     return RET_OK;
 }
@@ -1585,36 +1731,52 @@ int32_t DragManager::AddDragEventHandler(int32_t sourceType)
 int32_t DragManager::AddPointerEventHandler(uint32_t deviceTags)
 {
     FI_HILOGI("enter");
-    if (pointerEventMonitorId_ <= 0) {
 #ifdef OHOS_DRAG_ENABLE_MONITOR
-        auto monitor = std::make_shared<MonitorConsumer>([this](std::shared_ptr<MMI::PointerEvent> pointerEvent) {
-            return this->DragCallback(pointerEvent);
-        }, context_);
-        pointerEventMonitorId_ = MMI::InputManager::GetInstance()->AddMonitor(monitor);
-        if (pointerEventMonitorId_ <= 0) {
-            FI_HILOGE("Failed to add pointer event monitor");
-            return RET_ERR;
-        }
+    if (pointerEventMonitorId_ > 0) {
+        FI_HILOGI("leave");
+        return RET_ERR;
+    }
+    auto monitor = std::make_shared<MonitorConsumer>([this](std::shared_ptr<MMI::PointerEvent> pointerEvent) {
+        return this->DragCallback(pointerEvent);
+    }, context_, pointerEventStats_);
+    pointerEventMonitorId_ = MMI::InputManager::GetInstance()->AddMonitor(monitor);
+    if (pointerEventMonitorId_ <= 0) {
+        FI_HILOGE("Failed to add pointer event monitor");
+        return RET_ERR;
+    }
+    FI_HILOGI("Add drag poniter event handle successfully");
+    FI_HILOGI("leave");
+    return RET_OK;
+#elif defined(OHOS_DRAG_ENABLE_INTERCEPTOR)
+    return AddPointerEventInterceptor(deviceTags);
 #else
-        auto callback = [this](std::shared_ptr<MMI::PointerEvent> pointerEvent) {
-            return this->DragCallback(pointerEvent);
-        };
-        auto interceptor = std::make_shared<InterceptorConsumer>(callback);
-        pointerEventInterceptorId_ = MMI::InputManager::GetInstance()->AddInterceptor(
-            interceptor, DRAG_PRIORITY, deviceTags);
-        if (pointerEventInterceptorId_ <= 0) {
-            FI_HILOGE("Failed to add pointer event interceptor");
-            return RET_ERR;
-        }
+    FI_HILOGE("No pointer event handler is built in");
+    return RET_ERR;
 #endif // OHOS_DRAG_ENABLE_MONITOR
-        FI_HILOGI("Add drag poniter event handle successfully");
-        FI_HILOGI("leave");
-        return RET_OK;
-    } else {
+}
+
+#ifdef OHOS_DRAG_ENABLE_INTERCEPTOR
+int32_t DragManager::AddPointerEventInterceptor(uint32_t deviceTags)
+{
+    if (pointerEventInterceptorId_ > 0) {
         FI_HILOGI("leave");
         return RET_ERR;
     }
+    auto callback = [this](std::shared_ptr<MMI::PointerEvent> pointerEvent) {
+        return this->DragCallback(pointerEvent);
+    };
+    auto interceptor = std::make_shared<InterceptorConsumer>(callback, pointerEventStats_);
+    pointerEventInterceptorId_ = MMI::InputManager::GetInstance()->AddInterceptor(
+        interceptor, DRAG_PRIORITY, deviceTags);
+    if (pointerEventInterceptorId_ <= 0) {
+        FI_HILOGE("Failed to add pointer event interceptor");
+        return RET_ERR;
+    }
+    FI_HILOGI("Add drag poniter event interceptor successfully");
+    FI_HILOGI("leave");
+    return RET_OK;
 }
+#endif // OHOS_DRAG_ENABLE_INTERCEPTOR
 
 int32_t DragManager::AddKeyEventMonitor()
 {
@@ -1640,6 +1802,16 @@ int32_t DragManager::AddKeyEventMonitor()
 int32_t DragManager::RemovePointerEventHandler()
 {
     FI_HILOGI("enter");
+    FI_HILOGI("Pointer events observed:%{public}" PRIu64 ", reinjected:%{public}" PRIu64,
+        pointerEventStats_.observed.load(), pointerEventStats_.reinjected.load());
+#ifdef OHOS_DRAG_ENABLE_INTERCEPTOR
+    if (pointerEventInterceptorId_ > 0) {
+        MMI::InputManager::GetInstance()->RemoveInterceptor(pointerEventInterceptorId_);
+        pointerEventInterceptorId_ = -1;
+        FI_HILOGI("Remove drag pointer event interceptor successfully");
+        return RET_OK;
+    }
+#endif // OHOS_DRAG_ENABLE_INTERCEPTOR
 #ifdef OHOS_DRAG_ENABLE_MONITOR
     if (pointerEventMonitorId_ <= 0) {
         FI_HILOGE("Invalid pointer event monitor id:%{public}d", pointerEventMonitorId_);
@@ -1647,12 +1819,6 @@ int32_t DragManager::RemovePointerEventHandler()
     }
     MMI::InputManager::GetInstance()->RemoveMonitor(pointerEventMonitorId_);
     pointerEventMonitorId_ = -1;
-#else
-    if (pointerEventInterceptorId_ <= 0) {
-        FI_HILOGE("Invalid pointer event interceptor id:%{public}d", pointerEventInterceptorId_);
-    }
-    MMI::InputManager::GetInstance()->RemoveInterceptor(pointerEventInterceptorId_);
-    pointerEventInterceptorId_ = -1;
 #endif // OHOS_DRAG_ENABLE_MONITOR
     FI_HILOGI("Remove drag pointer event handler successfully");
     return RET_OK;
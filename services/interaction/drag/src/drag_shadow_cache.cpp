@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "drag_shadow_cache.h"
+
+#include "devicestatus_define.h"
+
+#undef LOG_TAG
+#define LOG_TAG "DragShadowCache"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+
+bool DragShadowCache::IsShowing(const ShadowInfo &shadowInfo)
+{
+    if ((shadowInfo.pixelMap == nullptr) || (shadowInfo.pixelMap->GetPixels() == nullptr)) {
+        return false;
+    }
+    std::lock_guard lock(mutex_);
+    if (!hasShowing_ || (showing_.pixelMap == nullptr) || (showing_.pixelMap->GetPixels() == nullptr)) {
+        return false;
+    }
+    // Content is compared even for the same PixelMap, since it may have been changed in place.
+    if (showing_ != shadowInfo) {
+        return false;
+    }
+    ++hitCount_;
+    FI_HILOGD("Shadow already on screen");
+    return true;
+}
+
+void DragShadowCache::SetShowing(const ShadowInfo &shadowInfo)
+{
+    std::lock_guard lock(mutex_);
+    showing_ = shadowInfo;
+    hasShowing_ = true;
+}
+
+size_t DragShadowCache::GetHitCount()
+{
+    std::lock_guard lock(mutex_);
+    return hitCount_;
+}
+
+void DragShadowCache::Clear()
+{
+    std::lock_guard lock(mutex_);
+    showing_ = {};
+    hasShowing_ = false;
+    hitCount_ = 0;
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
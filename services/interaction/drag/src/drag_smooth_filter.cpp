@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "drag_smooth_filter.h"
+
+#include <cmath>
+
+#include "devicestatus_common.h"
+#include "include/util.h"
+#include "json_parser.h"
+
+#undef LOG_TAG
+#define LOG_TAG "DragSmoothFilter"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace {
+const std::string DRAG_SMOOTH_CONFIG_PATH { "/system/etc/device_status/drag_smooth_config.json" };
+constexpr double NANOS_PER_SECOND { 1.0e9 };
+constexpr double TWO_PI { 2.0 * M_PI };
+constexpr double INITIAL_VELOCITY_VARIANCE { 1.0e8 };
+constexpr int32_t MAX_PREDICTION_MS { 50 };
+constexpr uint64_t ONE_MS_IN_NS { 1 * 1000 * 1000 };
+
+double Elapsed(uint64_t from, uint64_t to)
+{
+    if (to >= from) {
+        return static_cast<double>(to - from) / NANOS_PER_SECOND;
+    }
+    return -static_cast<double>(from - to) / NANOS_PER_SECOND;
+}
+
+double SmoothingFactor(double cutoff, double dt)
+{
+    double tau = 1.0 / (TWO_PI * cutoff);
+    return 1.0 / (1.0 + tau / dt);
+}
+
+void ParsePositive(const cJSON *json, const std::string &key, double &value)
+{
+    if (cJSON_GetObjectItemCaseSensitive(json, key.c_str()) == nullptr) {
+        return;
+    }
+    double parsed { 0.0 };
+    if ((JsonParser::ParseDouble(json, key, parsed) != RET_OK) || !std::isfinite(parsed) || (parsed <= 0.0)) {
+        FI_HILOGW("Invalid %{public}s, keep %{public}f", key.c_str(), value);
+        return;
+    }
+    value = parsed;
+}
+
+void ParseFilterType(const cJSON *json, DragSmoothFilterType &filterType)
+{
+    if (cJSON_GetObjectItemCaseSensitive(json, "filter") == nullptr) {
+        return;
+    }
+    std::string name;
+    if (JsonParser::ParseString(json, "filter", name) != RET_OK) {
+        return;
+    }
+    if (name == "average") {
+        filterType = DragSmoothFilterType::AVERAGE;
+    } else if (name == "one_euro") {
+        filterType = DragSmoothFilterType::ONE_EURO;
+    } else if (name == "kalman") {
+        filterType = DragSmoothFilterType::KALMAN;
+    } else {
+        FI_HILOGW("Unknown filter:%{public}s", name.c_str());
+    }
+}
+
+void ParseMaxPrediction(const cJSON *json, uint64_t &maxPrediction)
+{
+    if (cJSON_GetObjectItemCaseSensitive(json, "max_prediction_ms") == nullptr) {
+        return;
+    }
+    int32_t ms { 0 };
+    if ((JsonParser::ParseInt32(json, "max_prediction_ms", ms) != RET_OK) || (ms < 0) ||
+        (ms > MAX_PREDICTION_MS)) {
+        FI_HILOGW("Invalid max_prediction_ms");
+        return;
+    }
+    maxPrediction = static_cast<uint64_t>(ms) * ONE_MS_IN_NS;
+}
+} // namespace
+
+DragSmoothConfig DragSmoothConfig::Load(const std::string &path)
+{
+    DragSmoothConfig config;
+    std::string jsonStr = ReadJsonFile(path);
+    if (jsonStr.empty()) {
+        FI_HILOGI("No drag smooth config, use averaging");
+        return config;
+    }
+    JsonParser parser(jsonStr.c_str());
+    if (!cJSON_IsObject(parser.Get())) {
+        FI_HILOGE("Not valid object");
+        return config;
+    }
+    ParseFilterType(parser.Get(), config.filterType);
+    ParsePositive(parser.Get(), "min_cutoff", config.minCutoff);
+    ParsePositive(parser.Get(), "beta", config.beta);
+    ParsePositive(parser.Get(), "derivative_cutoff", config.derivativeCutoff);
+    ParsePositive(parser.Get(), "process_noise", config.processNoise);
+    ParsePositive(parser.Get(), "measurement_noise", config.measurementNoise);
+    ParseMaxPrediction(parser.Get(), config.maxPrediction);
+    FI_HILOGI("Drag smooth filter:%{public}d, max prediction:%{public}" PRIu64 "ns",
+        static_cast<int32_t>(config.filterType), config.maxPrediction);
+    return config;
+}
+
+DragSmoothConfig DragSmoothConfig::Load()
+{
+    return Load(DRAG_SMOOTH_CONFIG_PATH);
+}
+
+OneEuroFilter::OneEuroFilter(const DragSmoothConfig &config)
+    : minCutoff_(config.minCutoff), beta_(config.beta), derivativeCutoff_(config.derivativeCutoff)
+{}
+
+void OneEuroFilter::Reset()
+{
+    initialized_ = false;
+}
+
+void OneEuroFilter::Update(const DragMoveEvent &event)
+{
+    if (!initialized_) {
+        x_ = Axis { .position = event.displayX };
+        y_ = Axis { .position = event.displayY };
+        last_ = event;
+        initialized_ = true;
+        return;
+    }
+    double dt = Elapsed(last_.timestamp, event.timestamp);
+    if (dt > 0.0) {
+        UpdateAxis(x_, event.displayX, dt);
+        UpdateAxis(y_, event.displayY, dt);
+    }
+    last_ = event;
+}
+
+void OneEuroFilter::UpdateAxis(Axis &axis, double measurement, double dt)
+{
+    double rawVelocity = (measurement - axis.position) / dt;
+    axis.velocity += SmoothingFactor(derivativeCutoff_, dt) * (rawVelocity - axis.velocity);
+    double cutoff = minCutoff_ + beta_ * std::fabs(axis.velocity);
+    axis.position += SmoothingFactor(cutoff, dt) * (measurement - axis.position);
+}
+
+DragMoveEvent OneEuroFilter::Predict(uint64_t timestamp) const
+{
+    if (!initialized_) {
+        return DragMoveEvent {};
+    }
+    double dt = Elapsed(last_.timestamp, timestamp);
+    return DragMoveEvent {
+        .displayX = static_cast<float>(x_.position + x_.velocity * dt),
+        .displayY = static_cast<float>(y_.position + y_.velocity * dt),
+        .displayId = last_.displayId,
+        .timestamp = timestamp,
+    };
+}
+
+KalmanFilter::KalmanFilter(const DragSmoothConfig &config)
+    : processNoise_(config.processNoise), measurementNoise_(config.measurementNoise)
+{}
+
+void KalmanFilter::Reset()
+{
+    initialized_ = false;
+}
+
+void KalmanFilter::Update(const DragMoveEvent &event)
+{
+    if (!initialized_) {
+        InitAxis(x_, event.displayX);
+        InitAxis(y_, event.displayY);
+        last_ = event;
+        initialized_ = true;
+        return;
+    }
+    double dt = Elapsed(last_.timestamp, event.timestamp);
+    if (dt < 0.0) {
+        return;
+    }
+    UpdateAxis(x_, event.displayX, dt);
+    UpdateAxis(y_, event.displayY, dt);
+    last_ = event;
+}
+
+void KalmanFilter::InitAxis(Axis &axis, double measurement) const
+{
+    axis = Axis {
+        .position = measurement,
+        .velocity = 0.0,
+        .p00 = measurementNoise_,
+        .p01 = 0.0,
+        .p11 = INITIAL_VELOCITY_VARIANCE,
+    };
+}
+
+void KalmanFilter::UpdateAxis(Axis &axis, double measurement, double dt) const
+{
+    double dt2 = dt * dt;
+    axis.position += axis.velocity * dt;
+    axis.p00 += 2.0 * dt * axis.p01 + dt2 * axis.p11 + processNoise_ * dt2 * dt2 / 4.0;
+    axis.p01 += dt * axis.p11 + processNoise_ * dt2 * dt / 2.0;
+    axis.p11 += processNoise_ * dt2;
+
+    double innovation = measurement - axis.position;
+    double s = axis.p00 + measurementNoise_;
+    double k0 = axis.p00 / s;
+    double k1 = axis.p01 / s;
+    axis.position += k0 * innovation;
+    axis.velocity += k1 * innovation;
+    axis.p11 -= k1 * axis.p01;
+    axis.p00 *= (1.0 - k0);
+    axis.p01 *= (1.0 - k0);
+}
+
+DragMoveEvent KalmanFilter::Predict(uint64_t timestamp) const
+{
+    if (!initialized_) {
+        return DragMoveEvent {};
+    }
+    double dt = Elapsed(last_.timestamp, timestamp);
+    return DragMoveEvent {
+        .displayX = static_cast<float>(x_.position + x_.velocity * dt),
+        .displayY = static_cast<float>(y_.position + y_.velocity * dt),
+        .displayId = last_.displayId,
+        .timestamp = timestamp,
+    };
+}
+
+std::unique_ptr<IDragSmoothFilter> CreateDragSmoothFilter(const DragSmoothConfig &config)
+{
+    switch (config.filterType) {
+        case DragSmoothFilterType::ONE_EURO: {
+            return std::make_unique<OneEuroFilter>(config);
+        }
+        case DragSmoothFilterType::KALMAN: {
+            return std::make_unique<KalmanFilter>(config);
+        }
+        default: {
+            return nullptr;
+        }
+    }
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
@@ -15,6 +15,7 @@
 
 #include "drag_smooth_processor.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "devicestatus_common.h"
@@ -31,71 +32,161 @@ constexpr uint64_t ONE_MS_IN_NS { 1 * 1000 * 1000 }; // 1ms
 constexpr int32_t RESAMPLE_COORD_TIME_THRESHOLD { 20 * 1000 * 1000 };  // 20ms
 constexpr uint64_t INTERPOLATION_THRESHOLD { 100 * 1000 * 1000 }; // 100ms
 constexpr size_t PREVIOUS_HISTORY_EVENT { 2 };
+constexpr uint64_t LATENCY_SMOOTHING_SHIFT { 3 };
 }
+DragSmoothProcessor::DragSmoothProcessor()
+    : DragSmoothProcessor(DragSmoothConfig {})
+{}
+
+DragSmoothProcessor::DragSmoothProcessor(const DragSmoothConfig &config)
+    : config_(config), filter_(CreateDragSmoothFilter(config))
+{
+    for (size_t i = 0; i < RING_CAPACITY; ++i) {
+        ring_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
 void DragSmoothProcessor::InsertEvent(const DragMoveEvent &event)
 {
-    std::lock_guard<std::mutex> lock(mtx_);
-    moveEvents_.emplace_back(event);
+    uint64_t pos = tail_.load(std::memory_order_relaxed);
+    for (;;) {
+        Slot &slot = ring_[pos % RING_CAPACITY];
+        uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+        if (sequence == pos) {
+            if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                slot.event = event;
+                slot.sequence.store(pos + 1, std::memory_order_release);
+                return;
+            }
+        } else if (sequence < pos) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        } else {
+            pos = tail_.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+DragMoveBatch& DragSmoothProcessor::CurrentEvents()
+{
+    return batches_[current_];
+}
+
+DragMoveBatch& DragSmoothProcessor::HistoryEvents()
+{
+    return batches_[current_ ^ 1];
+}
+
+void DragSmoothProcessor::DrainEvents()
+{
+    DragMoveBatch &moveEvents = CurrentEvents();
+    moveEvents.clear();
+    if (uint64_t mark = resetMark_.exchange(NO_RESET, std::memory_order_acq_rel); mark != NO_RESET) {
+        skipUntil_ = std::max(skipUntil_, mark);
+        HistoryEvents().clear();
+        if (filter_ != nullptr) {
+            filter_->Reset();
+        }
+        hasLatestEvent_ = false;
+        presentLatency_ = 0;
+    }
+    for (;; ++head_) {
+        Slot &slot = ring_[head_ % RING_CAPACITY];
+        if (slot.sequence.load(std::memory_order_acquire) != head_ + 1) {
+            break;
+        }
+        if (head_ >= skipUntil_) {
+            moveEvents.push_back(slot.event);
+        }
+        slot.sequence.store(head_ + RING_CAPACITY, std::memory_order_release);
+    }
 }
 
 DragMoveEvent DragSmoothProcessor::SmoothMoveEvent(uint64_t nanoTimestamp, uint64_t vSyncPeriod)
 {
+    DrainEvents();
+    if (filter_ != nullptr) {
+        return FilterMoveEvent(nanoTimestamp);
+    }
     auto targetTimeStamp = nanoTimestamp - vSyncPeriod + ONE_MS_IN_NS;
-    std::vector<DragMoveEvent> currentEvents;
-    std::vector<DragMoveEvent> historyEvents;
-    {
-        std::lock_guard<std::mutex> lock(mtx_);
-        currentEvents.swap(moveEvents_);
-        historyEvents = historyEvents_;
-    }
-    if (currentEvents.empty() && historyEvents.empty()) {
+    DragMoveBatch &moveEvents = CurrentEvents();
+    DragMoveBatch &historyEvents = HistoryEvents();
+    if (moveEvents.empty() && historyEvents.empty()) {
         FI_HILOGW("Both currentEvents and historyEvents are empty, return default event");
         return DragMoveEvent {};
     }
     size_t historyEventSize = historyEvents.size();
-    if (currentEvents.empty() && historyEventSize > 0) {
+    if (moveEvents.empty()) {
+        DragMoveEvent resampleEvent = historyEvents.back();
         if (historyEventSize > 1) {
             auto event = GetInterpolatedEvent(historyEvents.at(historyEventSize - PREVIOUS_HISTORY_EVENT),
                 historyEvents.back(), targetTimeStamp);
-            auto resampleEvent = event.has_value() ? event.value() : historyEvents.back();
-            std::lock_guard<std::mutex> lock(mtx_);
-            historyEvents_ = currentEvents;
-            historyEvents_.emplace_back(resampleEvent);
-            return resampleEvent;
+            resampleEvent = event.value_or(historyEvents.back());
         } else {
-            DragMoveEvent event = historyEvents.back();
-            event.timestamp = targetTimeStamp;
-            std::lock_guard<std::mutex> lock(mtx_);
-            historyEvents_ = currentEvents;
-            historyEvents_.emplace_back(event);
-            return event;
+            resampleEvent.timestamp = targetTimeStamp;
         }
+        historyEvents.clear();
+        historyEvents.push_back(resampleEvent);
+        return resampleEvent;
     }
-    DragMoveEvent latestEvent = currentEvents.back();
-    auto resampleEvent = GetResampleEvent(historyEvents, currentEvents, targetTimeStamp);
-    {
-        std::lock_guard<std::mutex> lock(mtx_);
-        historyEvents_ = currentEvents;
+    DragMoveEvent latestEvent = moveEvents.back();
+    auto resampleEvent = GetResampleEvent(historyEvents, moveEvents, targetTimeStamp);
+    current_ ^= 1;
+    return resampleEvent.value_or(latestEvent);
+}
+
+DragMoveEvent DragSmoothProcessor::FilterMoveEvent(uint64_t nanoTimestamp)
+{
+    for (const auto &event : CurrentEvents()) {
+        if (hasLatestEvent_ && ((event.displayId != latestEvent_.displayId) ||
+            (event.timestamp < latestEvent_.timestamp))) {
+            filter_->Reset();
+        }
+        filter_->Update(event);
+        latestEvent_ = event;
+        hasLatestEvent_ = true;
     }
-    return resampleEvent.has_value() ? resampleEvent.value() : latestEvent;
+    if (!hasLatestEvent_) {
+        FI_HILOGW("No move event yet, return default event");
+        return DragMoveEvent {};
+    }
+    if (nanoTimestamp > latestEvent_.timestamp) {
+        uint64_t latency = nanoTimestamp - latestEvent_.timestamp;
+        if (latency > static_cast<uint64_t>(RESAMPLE_COORD_TIME_THRESHOLD)) {
+            FI_HILOGD("Input is idle, use the latest event");
+            return latestEvent_;
+        }
+        presentLatency_ = (presentLatency_ == 0) ? latency :
+            (presentLatency_ - (presentLatency_ >> LATENCY_SMOOTHING_SHIFT) + (latency >> LATENCY_SMOOTHING_SHIFT));
+    }
+    uint64_t lookAhead = std::min(presentLatency_, config_.maxPrediction);
+    return filter_->Predict(latestEvent_.timestamp + lookAhead);
 }
 
 void DragSmoothProcessor::ResetParameters()
 {
-    std::lock_guard<std::mutex> lock(mtx_);
-    moveEvents_.clear();
-    historyEvents_.clear();
+    resetMark_.store(tail_.load(std::memory_order_acquire), std::memory_order_release);
+}
+
+uint64_t DragSmoothProcessor::GetDroppedCount() const
+{
+    return dropped_.load(std::memory_order_relaxed);
+}
+
+uint64_t DragSmoothProcessor::GetPresentLatency() const
+{
+    return presentLatency_;
 }
 
-std::optional<DragMoveEvent> DragSmoothProcessor::GetResampleEvent(const std::vector<DragMoveEvent>& history,
-    const std::vector<DragMoveEvent>& current, uint64_t nanoTimestamp)
+std::optional<DragMoveEvent> DragSmoothProcessor::GetResampleEvent(const DragMoveBatch &history,
+    const DragMoveBatch &current, uint64_t nanoTimestamp)
 {
     auto event = Resample(history, current, nanoTimestamp);
     DragMoveEvent nearestEvent = GetNearestEvent(current, nanoTimestamp);
     return event.has_value() ? event.value() : nearestEvent;
 }
 
-DragMoveEvent DragSmoothProcessor::GetNearestEvent(const std::vector<DragMoveEvent>& events, uint64_t nanoTimestamp)
+DragMoveEvent DragSmoothProcessor::GetNearestEvent(const DragMoveBatch &events, uint64_t nanoTimestamp)
 {
     DragMoveEvent nearestEvent;
     uint64_t gap = UINT64_MAX;
@@ -119,8 +210,8 @@ DragMoveEvent DragSmoothProcessor::GetNearestEvent(const std::vector<DragMoveEve
     return nearestEvent;
 }
 
-std::optional<DragMoveEvent> DragSmoothProcessor::Resample(const std::vector<DragMoveEvent>& history,
-    const std::vector<DragMoveEvent>& current, uint64_t nanoTimestamp)
+std::optional<DragMoveEvent> DragSmoothProcessor::Resample(const DragMoveBatch &history,
+    const DragMoveBatch &current, uint64_t nanoTimestamp)
 {
     if (history.empty() || current.empty()) {
         FI_HILOGW("history or current is empty, history size:%{public}zu, current size:%{public}zu,"
@@ -182,8 +273,8 @@ std::optional<DragMoveEvent> DragSmoothProcessor::GetInterpolatedEvent(const Dra
     return event;
 }
 
-void DragSmoothProcessor::DumpMoveEvent(const std::vector<DragMoveEvent>& history,
-    const std::vector<DragMoveEvent>& current, const DragMoveEvent &historyAvgEvent,
+void DragSmoothProcessor::DumpMoveEvent(const DragMoveBatch &history,
+    const DragMoveBatch &current, const DragMoveEvent &historyAvgEvent,
     const DragMoveEvent &currentAvgEvent, const DragMoveEvent &latestEvent)
 {
     for (const auto &event : history) {
@@ -202,7 +293,7 @@ void DragSmoothProcessor::DumpMoveEvent(const std::vector<DragMoveEvent>& histor
         latestEvent.displayX, latestEvent.displayY, latestEvent.timestamp, latestEvent.displayId);
 }
 
-DragMoveEvent DragSmoothProcessor::GetAvgCoordinate(const std::vector<DragMoveEvent>& events)
+DragMoveEvent DragSmoothProcessor::GetAvgCoordinate(const DragMoveBatch &events)
 {
     DragMoveEvent avgEvent;
     if (events.empty()) {
@@ -15,6 +15,8 @@
 
 #include "drag_vsync_station.h"
 
+#include <algorithm>
+#include <cinttypes>
 #include <cstdint>
 
 #include "concurrent_task_client.h"
@@ -34,6 +36,31 @@ const std::string THREAD_NAME { "os_dragRenderRunner" };
 constexpr int32_t INVALID_VALUE { -1 };
 }
 
+DragVSyncStation::~DragVSyncStation()
+{
+    std::shared_ptr<Rosen::VSyncReceiver> receiver;
+    std::shared_ptr<AppExecFwk::EventHandler> handler;
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+        vSyncCallbacks_.clear();
+        receiver.swap(receiver_);
+        handler.swap(handler_);
+    }
+    ReleaseRunner(std::move(receiver), std::move(handler));
+}
+
+void DragVSyncStation::StartSession()
+{
+    std::lock_guard<std::mutex> lock(mtx_);
+    if (sessionActive_) {
+        return;
+    }
+    sessionActive_ = true;
+    firstFramePending_ = true;
+    sessionStartTime_ = std::chrono::steady_clock::now();
+    ++sessionCount_;
+}
+
 int32_t DragVSyncStation::RequestFrame(int32_t frameType, std::shared_ptr<DragFrameCallback> callback)
 {
     CHKPR(callback, RET_ERR);
@@ -42,6 +69,14 @@ int32_t DragVSyncStation::RequestFrame(int32_t frameType, std::shared_ptr<DragFr
         return RET_ERR;
     }
     std::lock_guard<std::mutex> lock(mtx_);
+    if (!sessionActive_) {
+        FI_HILOGW("No drag session, frame type:%{public}d refused", frameType);
+        return RET_ERR;
+    }
+    if (mmiHandleTid_ <= 0) {
+        mmiHandleTid_ = gettid();
+        SetQosForOtherThread(mmiHandleTid_);
+    }
     int32_t ret = Init();
     if (ret != RET_OK) {
         FI_HILOGE("Init receiver failed");
@@ -52,26 +87,54 @@ int32_t DragVSyncStation::RequestFrame(int32_t frameType, std::shared_ptr<DragFr
         FI_HILOGE("Request next vSync failed");
         return RET_ERR;
     }
-    vSyncCallbacks_.emplace(frameType, callback);
+    vSyncCallbacks_.try_emplace(frameType, callback);
     return RET_OK;
 }
 
-void DragVSyncStation::StopVSyncRequest()
+uint64_t DragVSyncStation::StopVSyncRequest()
 {
     FI_HILOGI("StopVSyncRequest in");
     std::lock_guard<std::mutex> lock(mtx_);
-    vSyncCallbacks_.erase(vSyncCallbacks_.begin(), vSyncCallbacks_.end());
-    if (handler_ != nullptr) {
-        handler_->RemoveAllEvents();
-        handler_->RemoveAllFileDescriptorListeners();
-        handler_ = nullptr;
-    }
-    receiver_ = nullptr;
-    vSyncPeriod_ = 0;
+    vSyncCallbacks_.clear();
+    uint64_t epoch = ++sessionEpoch_;
+    sessionActive_ = false;
+    firstFramePending_ = false;
     if (mmiHandleTid_ > 0) {
         OHOS::QOS::ResetQosForOtherThread(mmiHandleTid_);
         mmiHandleTid_ = INVALID_VALUE;
     }
+    return epoch;
+}
+
+void DragVSyncStation::TeardownRunner(uint64_t epoch)
+{
+    std::shared_ptr<Rosen::VSyncReceiver> receiver;
+    std::shared_ptr<AppExecFwk::EventHandler> handler;
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+        if (sessionActive_ || (epoch != sessionEpoch_.load())) {
+            return;
+        }
+        FI_HILOGI("Render runner is idle, tear it down");
+        receiver.swap(receiver_);
+        handler.swap(handler_);
+        vSyncPeriod_ = 0;
+    }
+    ReleaseRunner(std::move(receiver), std::move(handler));
+}
+
+void DragVSyncStation::ReleaseRunner(std::shared_ptr<Rosen::VSyncReceiver> receiver,
+    std::shared_ptr<AppExecFwk::EventHandler> handler)
+{
+    if (handler != nullptr) {
+        handler->RemoveAllEvents();
+        handler->RemoveAllFileDescriptorListeners();
+        // Waits for a vsync callback still running on the runner, so neither the runner nor the station
+        // goes away under it. The last references are then dropped here, off the runner thread.
+        handler->PostSyncTask([] {});
+    }
+    receiver = nullptr;
+    handler = nullptr;
 }
 
 uint64_t DragVSyncStation::GetVSyncPeriod()
@@ -91,6 +154,18 @@ uint64_t DragVSyncStation::GetVSyncPeriod()
     return vSyncPeriod_;
 }
 
+void DragVSyncStation::Dump(int32_t fd) const
+{
+    std::lock_guard<std::mutex> lock(mtx_);
+    dprintf(fd, "DragVSyncStation:\n"
+            "\trunnerAlive:%s\n\trunnerCreatedCount:%u\n\tsessionCount:%u\n\tdroppedCallbackCount:%u\n"
+            "\tlastFirstFrameLatency:%" PRId64 "us\n\tmaxFirstFrameLatency:%" PRId64 "us\n"
+            "\tfirstDragFirstFrameLatency:%" PRId64 "us\n\tsteadyFirstFrameLatency:%" PRId64 "us\n",
+            (handler_ != nullptr) ? "true" : "false", runnerCreatedCount_, sessionCount_, droppedCallbackCount_,
+            lastFirstFrameLatencyUs_, maxFirstFrameLatencyUs_, firstDragLatencyUs_,
+            (steadyLatencyCount_ > 0) ? (steadyLatencySumUs_ / steadyLatencyCount_) : -1);
+}
+
 int32_t DragVSyncStation::Init()
 {
     FI_HILOGD("Init receiver in");
@@ -102,15 +177,15 @@ int32_t DragVSyncStation::Init()
         CHKPR(runner, RET_ERR);
         handler_ = std::make_shared<AppExecFwk::EventHandler>(std::move(runner));
         SetThreadQosLevel(handler_);
+        ++runnerCreatedCount_;
     }
-    mmiHandleTid_ = gettid();
-    SetQosForOtherThread(mmiHandleTid_);
     CHKPR(handler_, RET_ERR);
     receiver_ = Rosen::RSInterfaces::GetInstance().CreateVSyncReceiver("DragVSyncStation", handler_);
     CHKPR(receiver_, RET_ERR);
     int32_t ret = receiver_->Init();
     if (ret != RET_OK) {
         FI_HILOGE("Init receiver, %{public}d", ret);
+        receiver_ = nullptr;
         return RET_ERR;
     }
     frameCallback_ = {
@@ -154,11 +229,32 @@ void DragVSyncStation::SetQosForOtherThread(int32_t tid)
 void DragVSyncStation::OnVSyncInner(uint64_t nanoTimestamp)
 {
     std::map<int32_t, std::shared_ptr<DragFrameCallback>> vSyncCallbacks;
+    uint64_t epoch = 0;
     {
         std::lock_guard<std::mutex> lock(mtx_);
         vSyncCallbacks.swap(vSyncCallbacks_);
+        epoch = sessionEpoch_.load();
+        if (firstFramePending_ && !vSyncCallbacks.empty()) {
+            firstFramePending_ = false;
+            lastFirstFrameLatencyUs_ = std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - sessionStartTime_).count();
+            maxFirstFrameLatencyUs_ = std::max(maxFirstFrameLatencyUs_, lastFirstFrameLatencyUs_);
+            if (firstDragLatencyUs_ < 0) {
+                firstDragLatencyUs_ = lastFirstFrameLatencyUs_;
+            } else {
+                steadyLatencySumUs_ += lastFirstFrameLatencyUs_;
+                ++steadyLatencyCount_;
+            }
+            FI_HILOGI("First frame latency:%{public}" PRId64 "us", lastFirstFrameLatencyUs_);
+        }
     }
     for (auto const &callback : vSyncCallbacks) {
+        if (epoch != sessionEpoch_.load()) {
+            std::lock_guard<std::mutex> lock(mtx_);
+            droppedCallbackCount_ += static_cast<uint32_t>(vSyncCallbacks.size());
+            FI_HILOGW("Drag session changed, drop stale frame callbacks");
+            return;
+        }
         if (callback.second != nullptr) {
             (*callback.second)(nanoTimestamp);
         }
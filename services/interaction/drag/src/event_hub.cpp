@@ -91,6 +91,17 @@ void EventHub::OnReceiveEvent(const EventFwk::CommonEventData &event)
             FI_HILOGE("Post async task failed");
         }
     }
+    if (eventId == EventId::EVENT_SCREEN_OFF) {
+        CHKPV(context_);
+        int32_t ret = context_->GetDelegateTasks().PostAsyncTask([this] {
+            CHKPR(this->context_, RET_ERR);
+            this->context_->GetDragManager().ReleaseWarmUpCache();
+            return RET_OK;
+        });
+        if (ret != RET_OK) {
+            FI_HILOGE("Post async task failed");
+        }
+    }
 #endif // OHOS_BUILD_ENABLE_ARKUI_X
     if (eventId != EventId::EVENT_SCREEN_LOCK) {
         return;
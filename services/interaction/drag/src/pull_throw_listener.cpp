@@ -31,7 +31,6 @@ constexpr const char *SETTINGS_DATA_EXT_URI = "datashare:///com.ohos.settingsdat
 const std::string SETTING_VK_KEY = "virtualKeyBoardType";
 constexpr int32_t DATA_SHARE_READY = 0;
 constexpr int32_t DATA_SHARE_NOT_READY = 1055;
-constexpr int32_t DECEM_BASE = 10;
 } // namespace
 
 PullThrowListener::PullThrowListener(DragManager* manager) : manager_(manager)
@@ -39,7 +38,14 @@ PullThrowListener::PullThrowListener(DragManager* manager) : manager_(manager)
     FI_HILOGI("PullThrowListener initialized with DragManager");
 }
 
-PullThrowListener::~PullThrowListener() {}
+PullThrowListener::~PullThrowListener()
+{
+    std::lock_guard<std::mutex> guard(helperMutex_);
+    if (helper_ != nullptr) {
+        ReleaseDataShareHelper(helper_);
+        helper_ = nullptr;
+    }
+}
 
 bool PullThrowListener::RegisterFoldStatusListener()
 {
@@ -54,6 +60,8 @@ bool PullThrowListener::RegisterFoldStatusListener()
         delete foldStatusListener_;
         return false;
     }
+    foldStatus_ = Rosen::DisplayManager::GetInstance().GetFoldStatus();
+    foldStatusListened_ = true;
     FI_HILOGI("RegisterFoldStatusListener success");
     return true;
 }
@@ -64,7 +72,7 @@ void PullThrowListener::FoldStatusListener::OnFoldStatusChanged(Rosen::FoldStatu
     CHKPV(listener_->manager_);
     FI_HILOGD("OnFoldStatusChanged foldStatus is %{public}d, throw state: %{public}d",
               static_cast<int32_t>(foldStatus), listener_->manager_->throwState_);
-    
+    listener_->foldStatus_ = foldStatus;
     if (foldStatus != Rosen::FoldStatus::HALF_FOLD && listener_->manager_->throwState_ != ThrowState::NOT_THROW) {
         std::shared_ptr<MMI::PointerEvent> pointerEvent = listener_->manager_->currentPointerEvent_;
         CHKPV(pointerEvent);
@@ -74,6 +82,15 @@ void PullThrowListener::FoldStatusListener::OnFoldStatusChanged(Rosen::FoldStatu
     }
 }
 
+bool PullThrowListener::GetFoldStatus(Rosen::FoldStatus &foldStatus) const
+{
+    if (!foldStatusListened_) {
+        return false;
+    }
+    foldStatus = foldStatus_;
+    return true;
+}
+
 bool PullThrowListener::RegisterScreenMagneticStateListener()
 {
     screenMagneticStateListener_ = new (std::nothrow) ScreenMagneticStateListener(this);
@@ -134,57 +151,40 @@ bool PullThrowListener::ReleaseDataShareHelper(std::shared_ptr<DataShare::DataSh
     return true;
 }
 
-int32_t PullThrowListener::GetIntValue(const std::string &key, int32_t &value)
-{
-    int64_t valueLong;
-    int32_t ret = GetLongValue(key, valueLong);
-    if (ret != ERR_OK) {
-        FI_HILOGE("GetIntValue fail");
-        return ret;
-    }
-    value = static_cast<int32_t>(valueLong);
-    return ERR_OK;
-}
-
-int32_t PullThrowListener::GetLongValue(const std::string &key, int64_t &value)
+std::shared_ptr<DataShare::DataShareHelper> PullThrowListener::GetDataShareHelper()
 {
-    std::string valueStr;
-    int32_t ret = GetStringValue(key, valueStr);
-    if (ret != ERR_OK) {
-        FI_HILOGE("GetLongValue fail");
-        return ret;
+    std::lock_guard<std::mutex> guard(helperMutex_);
+    if (helper_ == nullptr) {
+        std::string callingIdentity = IPCSkeleton::ResetCallingIdentity();
+        helper_ = CreateDataShareHelper();
+        IPCSkeleton::SetCallingIdentity(callingIdentity);
     }
-    value = static_cast<int64_t>(strtoll(valueStr.c_str(), nullptr, DECEM_BASE));
-    return ERR_OK;
+    return helper_;
 }
 
-int32_t PullThrowListener::GetStringValue(const std::string &key, std::string &value)
+int32_t PullThrowListener::QueryStringValue(const std::string &key, std::string &value)
 {
-    FI_HILOGI("enter");
-    auto helper = CreateDataShareHelper();
+    FI_HILOGI("Query setting:%{public}s", key.c_str());
+    auto helper = GetDataShareHelper();
+    CHKPR(helper, RET_ERR);
     std::vector<std::string> columns = {"VALUE"};
     DataShare::DataSharePredicates predicates;
     predicates.EqualTo("KEYWORD", key);
     Uri uri((SETTING_URI_PROXY + "&key=" + key));
-    CHKPR(helper, RET_ERR);
     auto resultSet = helper->Query(uri, predicates, columns);
     const int32_t index = 0;
     if (resultSet == nullptr) {
         FI_HILOGE("resultSet is nullptr");
-        ReleaseDataShareHelper(helper);
         return RET_ERR;
     }
     resultSet->GoToRow(index);
     int32_t ret = resultSet->GetString(index, value);
+    resultSet->Close();
     if (ret != ERR_OK) {
         FI_HILOGE("GetString failed, ret:%{public}d", ret);
-        resultSet->Close();
-        ReleaseDataShareHelper(helper);
         return ret;
     }
-    resultSet->Close();
-    ReleaseDataShareHelper(helper);
-    return ERR_OK;
+    return RET_OK;
 }
 
 bool PullThrowListener::RegisterVKObserver(const sptr<VKObserver> &observer)
@@ -195,17 +195,14 @@ bool PullThrowListener::RegisterVKObserver(const sptr<VKObserver> &observer)
         FI_HILOGD("observer is nullptr");
         return false;
     }
-    std::string callingIdentity = IPCSkeleton::ResetCallingIdentity();
-    auto helper = CreateDataShareHelper();
+    auto helper = GetDataShareHelper();
     if (helper == nullptr) {
-        IPCSkeleton::SetCallingIdentity(callingIdentity);
         return false;
     }
+    std::string callingIdentity = IPCSkeleton::ResetCallingIdentity();
     Uri uriFeedback((SETTING_URI_PROXY + "&key=" + SETTING_VK_KEY));
     helper->RegisterObserver(uriFeedback, observer);
     helper->NotifyChange(uriFeedback);
-
-    ReleaseDataShareHelper(helper);
     IPCSkeleton::SetCallingIdentity(callingIdentity);
     FI_HILOGI("Succeed to register observer of virtual keyboard");
     return true;
@@ -243,17 +240,28 @@ bool PullThrowListener::RegisterPullThrowListener()
     return true;
 }
 
+void PullThrowListener::UpdateVKStatus()
+{
+    int32_t statusVk = -1;
+    if (settings_.GetIntValue(SETTING_VK_KEY, statusVk) != RET_OK) {
+        FI_HILOGE("Read virtual keyboard status failed");
+        return;
+    }
+    obstatusVk_ = statusVk;
+    if (statusVk == 1) {
+        FI_HILOGI("VK UpdateFunc Thorw cancel; obstatusVk_: %{public}d", statusVk);
+        CHKPV(manager_);
+        manager_->OnDragCancel(manager_->currentPointerEvent_);
+    } else {
+        FI_HILOGD("Virtual keyboard obstatusVk_: %{public}d", statusVk);
+    }
+}
+
 bool PullThrowListener::RegisterVKListener()
 {
-    const VKObserver::UpdateFunc updateFunc = [&]() {
-        GetIntValue(SETTING_VK_KEY, obstatusVk_);
-        if (obstatusVk_ == 1) {
-            FI_HILOGI("VK UpdateFunc Thorw cancel; obstatusVk_: %{public}d", obstatusVk_);
-            CHKPV(manager_);
-            manager_->OnDragCancel(manager_->currentPointerEvent_);
-        } else {
-            FI_HILOGD("Virtual keyboard obstatusVk_: %{public}d", obstatusVk_);
-        }
+    const VKObserver::UpdateFunc updateFunc = [this]() {
+        settings_.Invalidate(SETTING_VK_KEY);
+        UpdateVKStatus();
     };
     auto VKobserver_ = CreateVKObserver(updateFunc);
     if (!RegisterVKObserver(VKobserver_)) {
@@ -265,10 +273,14 @@ bool PullThrowListener::RegisterVKListener()
 
 bool PullThrowListener::ValidateThrowConditions()
 {
-    oldFoldStatus_ = Rosen::DisplayManager::GetInstance().GetFoldStatus();
+    // Every input is kept up to date by its listener, so no IPC is made on the gesture path.
+    Rosen::FoldStatus foldStatus = foldStatusListened_ ? foldStatus_.load() :
+        Rosen::DisplayManager::GetInstance().GetFoldStatus();
+    int32_t statusVk = obstatusVk_;
+    bool magneticState = currentMagneticState_;
     FI_HILOGI("Listener params: VK Status=%{public}d, MK Status=%{public}d, Fold Status=%{public}u",
-              obstatusVk_, currentMagneticState_, oldFoldStatus_);
-    return !(obstatusVk_ == 1 || oldFoldStatus_ != Rosen::FoldStatus::HALF_FOLD || currentMagneticState_);
+              statusVk, magneticState, static_cast<uint32_t>(foldStatus));
+    return !(statusVk == 1 || foldStatus != Rosen::FoldStatus::HALF_FOLD || magneticState);
 }
 #endif // OHOS_BUILD_ENABLE_ARKUI_X
 
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "pull_throw_settings.h"
+
+#include <cstdlib>
+
+#include "devicestatus_define.h"
+
+#undef LOG_TAG
+#define LOG_TAG "PullThrowSettings"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace {
+constexpr int32_t DECEM_BASE { 10 };
+} // namespace
+
+int32_t PullThrowSettings::GetStringValue(const std::string &key, std::string &value)
+{
+    uint64_t generation = 0;
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        if (auto iter = values_.find(key); iter != values_.end()) {
+            value = iter->second;
+            return RET_OK;
+        }
+        if (query_ == nullptr) {
+            FI_HILOGE("No query for settings");
+            return RET_ERR;
+        }
+        ++queryCount_;
+        generation = generation_;
+    }
+    std::string queried;
+    int32_t ret = query_(key, queried);
+    if (ret != RET_OK) {
+        FI_HILOGE("Query %{public}s failed, ret:%{public}d", key.c_str(), ret);
+        return ret;
+    }
+    value = queried;
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (generation == generation_) {
+        values_.emplace(key, std::move(queried));
+    }
+    return RET_OK;
+}
+
+int32_t PullThrowSettings::GetIntValue(const std::string &key, int32_t &value)
+{
+    int64_t valueLong { 0 };
+    int32_t ret = GetLongValue(key, valueLong);
+    if (ret != RET_OK) {
+        FI_HILOGE("GetIntValue fail");
+        return ret;
+    }
+    value = static_cast<int32_t>(valueLong);
+    return RET_OK;
+}
+
+int32_t PullThrowSettings::GetLongValue(const std::string &key, int64_t &value)
+{
+    std::string valueStr;
+    int32_t ret = GetStringValue(key, valueStr);
+    if (ret != RET_OK) {
+        FI_HILOGE("GetLongValue fail");
+        return ret;
+    }
+    value = static_cast<int64_t>(strtoll(valueStr.c_str(), nullptr, DECEM_BASE));
+    return RET_OK;
+}
+
+void PullThrowSettings::Invalidate(const std::string &key)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    values_.erase(key);
+    ++generation_;
+}
+
+void PullThrowSettings::Clear()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    values_.clear();
+    ++generation_;
+}
+
+size_t PullThrowSettings::GetQueryCount() const
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return queryCount_;
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
@@ -39,6 +39,7 @@ bool UniversalDragWrapper::InitUniversalDrag()
         FI_HILOGE("Couldn't load universal drag handler library with dlopen(). Error: %{public}s", error);
         return false;
     }
+    ResolveSymbols();
     if (initUniversalDragHandle_ == nullptr) {
         initUniversalDragHandle_ =
             reinterpret_cast<InitFunc>(dlsym(universalDragHandle_, "Init"));
@@ -54,6 +55,35 @@ bool UniversalDragWrapper::InitUniversalDrag()
     return initUniversalDragHandle_(env_);
 }
 
+void UniversalDragWrapper::ResolveSymbols()
+{
+    // Resolve all entries while the library is loaded at service start, rather than on the first drag.
+    if (removeUniversalDragHandle_ == nullptr) {
+        removeUniversalDragHandle_ =
+            reinterpret_cast<RemoveUniversalDragFunc>(dlsym(universalDragHandle_, "RemoveUniversalDrag"));
+    }
+    if (setDragableStateHandle_ == nullptr) {
+        setDragableStateHandle_ =
+            reinterpret_cast<SetDragableStateFunc>(dlsym(universalDragHandle_, "SetDragableState"));
+    }
+    if (getAppDragSwitchStateHandle_ == nullptr) {
+        getAppDragSwitchStateHandle_ =
+            reinterpret_cast<GetAppDragSwitchStateFunc>(dlsym(universalDragHandle_, "GetAppDragSwitchState"));
+    }
+    if (setDraggableStateAsyncHandle_ == nullptr) {
+        setDraggableStateAsyncHandle_ =
+            reinterpret_cast<SetDraggableStateAsyncFunc>(dlsym(universalDragHandle_, "SetDraggableStateAsync"));
+    }
+    if (StopLongPressDragHandle_ == nullptr) {
+        StopLongPressDragHandle_ =
+            reinterpret_cast<StopLongPressDragFunc>(dlsym(universalDragHandle_, "StopLongPressDrag"));
+    }
+    char *error = nullptr;
+    if ((error = dlerror()) != nullptr) {
+        FI_HILOGW("Some symbols of universal drag are missing: %{public}s", error);
+    }
+}
+
 void UniversalDragWrapper::RemoveUniversalDrag()
 {
     FI_HILOGI("Enter RemoveUniversalDrag");
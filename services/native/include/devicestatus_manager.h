@@ -26,6 +26,7 @@
 #include "boomerang_data.h"
 #include "devicestatus_msdp_client_impl.h"
 #include "devicestatus_napi_manager.h"
+#include "devicestatus_notifier.h"
 #include "iremote_boomerang_callback.h"
 #include "iremote_dev_sta_callback.h"
 #include "stationary_data.h"
@@ -44,14 +45,17 @@ using namespace OHOS::Rosen;
 class DeviceStatusService;
 class DeviceStatusManager {
 public:
-    DeviceStatusManager() = default;
+    DeviceStatusManager();
     ~DeviceStatusManager() = default;
 
     class DeviceStatusCallbackDeathRecipient : public IRemoteObject::DeathRecipient {
     public:
-        DeviceStatusCallbackDeathRecipient() = default;
+        DeviceStatusCallbackDeathRecipient(DeviceStatusManager* deviceStatusManager) : manager_(deviceStatusManager) {}
         virtual void OnRemoteDied(const wptr<IRemoteObject> &remote);
         virtual ~DeviceStatusCallbackDeathRecipient() = default;
+    private:
+        DeviceStatusManager* manager_ { nullptr };
+        friend class DeviceStatusManager;
     };
 
     class BoomerangCallbackDeathRecipient : public IRemoteObject::DeathRecipient {
@@ -134,6 +138,7 @@ private:
     void SystemBarHiddedInit();
 #endif
     void TimerTask();
+    void RemoveDeviceStatusListener(const sptr<IRemoteObject> &remote);
     void RemoveLibTimerTask(const std::shared_ptr<BoomerangAlgoImpl> &boomerangAlgo);
     static constexpr int32_t argSize_ { TYPE_MAX };
 
@@ -162,6 +167,7 @@ private:
     std::atomic<bool> hasSubmitted_ { false };
     static std::mutex g_mutex_;
     std::recursive_mutex countMutex_;
+    DeviceStatusNotifier notifier_;
 };
 } // namespace DeviceStatus
 } // namespace Msdp
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DEVICESTATUS_NOTIFIER_H
+#define DEVICESTATUS_NOTIFIER_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "nocopyable.h"
+
+#include "iremote_dev_sta_callback.h"
+#include "stationary_data.h"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+// Delivers device status changes to subscribers off the caller's thread.
+// Every listener owns a small queue in which pending notifications are coalesced
+// per type (latest value wins). Callbacks are oneway calls, so a listener that does
+// not consume them cannot hold a worker. A listener whose remote object has died is evicted.
+class DeviceStatusNotifier final {
+public:
+    using EvictCallback = std::function<void(sptr<IRemoteDevStaCallback>)>;
+
+    DeviceStatusNotifier() = default;
+    ~DeviceStatusNotifier();
+    DISALLOW_COPY_AND_MOVE(DeviceStatusNotifier);
+
+    void SetEvictCallback(EvictCallback callback);
+    void Post(const std::vector<sptr<IRemoteDevStaCallback>> &listeners, const Data &data);
+    void Remove(sptr<IRemoteDevStaCallback> listener);
+    void Stop();
+    size_t GetDroppedCount() const;
+    size_t GetEvictedCount() const;
+
+private:
+    struct Channel {
+        sptr<IRemoteDevStaCallback> listener { nullptr };
+        std::map<Type, Data> pending;
+        std::deque<Type> order;
+        bool scheduled { false };
+        bool inFlight { false };
+        bool evicted { false };
+    };
+
+    void StartWorkersLocked();
+    void Worker();
+    void EvictLocked(const std::shared_ptr<Channel> &channel, std::vector<sptr<IRemoteDevStaCallback>> &evicted);
+    void NotifyEvicted(const std::vector<sptr<IRemoteDevStaCallback>> &evicted);
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::map<IRemoteObject*, std::shared_ptr<Channel>> channels_;
+    std::deque<std::shared_ptr<Channel>> ready_;
+    std::vector<std::thread> workers_;
+    EvictCallback evictCallback_ { nullptr };
+    bool running_ { false };
+    bool stopped_ { false };
+    size_t droppedCount_ { 0 };
+    size_t evictedCount_ { 0 };
+};
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+#endif // DEVICESTATUS_NOTIFIER_H
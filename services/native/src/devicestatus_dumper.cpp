@@ -30,6 +30,7 @@
 #include "devicestatus_common.h"
 #include "devicestatus_define.h"
 #include "include/util.h"
+#include "ipc_statistics.h"
 
 #undef LOG_TAG
 #define LOG_TAG "DeviceStatusDumper"
@@ -86,12 +87,14 @@ void DeviceStatusDumper::ParseCommand(int32_t fd, const std::vector<std::string>
         { "coordination", no_argument, nullptr, 'o' },
         { "drag", no_argument, nullptr, 'd' },
         { "macroState", no_argument, nullptr, 'm' },
+        { "ipc", no_argument, nullptr, 'i' },
+        { "dragFrames", no_argument, nullptr, 'f' },
         { nullptr, 0, nullptr, 0 }
     };
     optind = 0;
 
     for (;;) {
-        int32_t opt = getopt_long(argv.size(), argv.data(), "+hslcodm", dumpOptions, nullptr);
+        int32_t opt = getopt_long(argv.size(), argv.data(), "+hslcodmif", dumpOptions, nullptr);
         if (opt < 0) {
             break;
         }
@@ -133,6 +136,15 @@ void DeviceStatusDumper::ExecutDump(int32_t fd, const std::vector<Data> &datas,
             DumpCheckDefine(fd);
             break;
         }
+        case 'i': {
+            IpcStatistics::GetInstance().Dump(fd);
+            break;
+        }
+        case 'f': {
+            CHKPV(context_);
+            context_->GetDragManager().DumpFrames(fd);
+            break;
+        }
         default: {
             dprintf(fd, "cmd param is error\n");
             DumpHelpInfo(fd);
@@ -267,6 +279,8 @@ void DeviceStatusDumper::DumpHelpInfo(int32_t fd) const
     dprintf(fd, "      -o: dump the coordination status\n");
     dprintf(fd, "      -d: dump the drag status\n");
     dprintf(fd, "      -m, dump the macro state\n");
+    dprintf(fd, "      -i: dump the latency of ipc requests\n");
+    dprintf(fd, "      -f: dump the timing of recent drag frames as csv\n");
 }
 
 void DeviceStatusDumper::SaveAppInfo(std::shared_ptr<AppInfo> appInfo)
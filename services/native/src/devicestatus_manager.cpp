@@ -50,10 +50,20 @@ std::shared_ptr<DeviceStatusManager> DeviceStatusManager::g_deviceManager_;
 #endif
 std::mutex DeviceStatusManager::g_mutex_;
 
+DeviceStatusManager::DeviceStatusManager()
+{
+    notifier_.SetEvictCallback([this](sptr<IRemoteDevStaCallback> listener) {
+        CHKPV(listener);
+        this->RemoveDeviceStatusListener(listener->AsObject());
+    });
+}
+
 void DeviceStatusManager::DeviceStatusCallbackDeathRecipient::OnRemoteDied(const wptr<IRemoteObject>& remote)
 {
     CHKPV(remote);
     FI_HILOGI("Recv death notice");
+    CHKPV(manager_);
+    manager_->RemoveDeviceStatusListener(remote.promote());
 }
 
 void DeviceStatusManager::BoomerangCallbackDeathRecipient::OnRemoteDied(const wptr<IRemoteObject>& remote)
@@ -154,7 +164,7 @@ bool DeviceStatusManager::Init()
 {
     CALL_DEBUG_ENTER;
     if (devicestatusCBDeathRecipient_ == nullptr) {
-        devicestatusCBDeathRecipient_ = new (std::nothrow) DeviceStatusCallbackDeathRecipient();
+        devicestatusCBDeathRecipient_ = new (std::nothrow) DeviceStatusCallbackDeathRecipient(this);
         if (devicestatusCBDeathRecipient_ == nullptr) {
             FI_HILOGE("devicestatusCBDeathRecipient_ failed");
             return false;
@@ -271,39 +281,33 @@ int32_t DeviceStatusManager::NotifyDeviceStatusChange(const Data &deviceStatusDa
 {
     CALL_DEBUG_ENTER;
     FI_HILOGI("type:%{public}d, value:%{public}d", deviceStatusData.type, deviceStatusData.value);
-    std::set<const sptr<IRemoteDevStaCallback>, classcomp> listeners;
-    std::lock_guard lock(mutex_);
-    auto iter = listeners_.find(deviceStatusData.type);
-    if (iter == listeners_.end()) {
-        FI_HILOGE("type:%{public}d is not exits", deviceStatusData.type);
-        return RET_ERR;
-    }
     if ((deviceStatusData.type <= TYPE_INVALID) || (deviceStatusData.type >= TYPE_MAX)) {
         FI_HILOGE("Check deviceStatusData.type is invalid");
         return RET_ERR;
     }
-    listeners = (std::set<const sptr<IRemoteDevStaCallback>, classcomp>)(iter->second);
-    for (const auto &listener : listeners) {
-        if (listener == nullptr) {
-            FI_HILOGE("listener is nullptr");
+    std::vector<sptr<IRemoteDevStaCallback>> listeners;
+    {
+        std::lock_guard lock(mutex_);
+        auto iter = listeners_.find(deviceStatusData.type);
+        if (iter == listeners_.end()) {
+            FI_HILOGE("type:%{public}d is not exits", deviceStatusData.type);
             return RET_ERR;
         }
         FI_HILOGI("type:%{public}d, arrs_:%{public}d", deviceStatusData.type, arrs_[deviceStatusData.type]);
         switch (arrs_[deviceStatusData.type]) {
             case ENTER: {
-                if (deviceStatusData.value == VALUE_ENTER) {
-                    listener->OnDeviceStatusChanged(deviceStatusData);
+                if (deviceStatusData.value != VALUE_ENTER) {
+                    return RET_OK;
                 }
                 break;
             }
             case EXIT: {
-                if (deviceStatusData.value == VALUE_EXIT) {
-                    listener->OnDeviceStatusChanged(deviceStatusData);
+                if (deviceStatusData.value != VALUE_EXIT) {
+                    return RET_OK;
                 }
                 break;
             }
             case ENTER_EXIT: {
-                listener->OnDeviceStatusChanged(deviceStatusData);
                 break;
             }
             default: {
@@ -311,10 +315,51 @@ int32_t DeviceStatusManager::NotifyDeviceStatusChange(const Data &deviceStatusDa
                 return RET_ERR;
             }
         }
+        for (const auto &listener : iter->second) {
+            if (listener == nullptr) {
+                FI_HILOGE("listener is nullptr");
+                return RET_ERR;
+            }
+            listeners.push_back(listener);
+        }
     }
+    notifier_.Post(listeners, deviceStatusData);
     return RET_OK;
 }
 
+void DeviceStatusManager::RemoveDeviceStatusListener(const sptr<IRemoteObject> &remote)
+{
+    CHKPV(remote);
+    std::lock_guard lock(mutex_);
+    std::vector<Type> emptiedTypes;
+    for (auto typeIter = listeners_.begin(); typeIter != listeners_.end();) {
+        auto &callbacks = typeIter->second;
+        for (auto iter = callbacks.begin(); iter != callbacks.end();) {
+            if ((*iter)->AsObject() == remote) {
+                notifier_.Remove(*iter);
+                remote->RemoveDeathRecipient(devicestatusCBDeathRecipient_);
+                iter = callbacks.erase(iter);
+            } else {
+                ++iter;
+            }
+        }
+        if (callbacks.empty()) {
+            Type type = typeIter->first;
+            typeIter = listeners_.erase(typeIter);
+            FI_HILOGI("No listener left for type:%{public}d", type);
+            emptiedTypes.push_back(type);
+        } else {
+            ++typeIter;
+        }
+    }
+    if (!listeners_.empty()) {
+        return;
+    }
+    for (auto type : emptiedTypes) {
+        Disable(type);
+    }
+}
+
 void DeviceStatusManager::Subscribe(Type type, ActivityEvent event, ReportLatencyNs latency,
     sptr<IRemoteDevStaCallback> callback)
 {
@@ -394,6 +439,7 @@ void DeviceStatusManager::Unsubscribe(Type type, ActivityEvent event, sptr<IRemo
     auto iter = listeners_[dtTypeIter->first].find(callback);
     if (iter != listeners_[dtTypeIter->first].end()) {
         if (listeners_[dtTypeIter->first].erase(callback) != 0) {
+            notifier_.Remove(callback);
             object->RemoveDeathRecipient(devicestatusCBDeathRecipient_);
             if (listeners_[dtTypeIter->first].empty()) {
                 listeners_.erase(dtTypeIter);
@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "devicestatus_notifier.h"
+
+#include "devicestatus_define.h"
+#include "fi_log.h"
+
+#undef LOG_TAG
+#define LOG_TAG "DeviceStatusNotifier"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace {
+constexpr size_t WORKER_NUM { 2 };
+constexpr size_t MAX_PENDING_PER_LISTENER { static_cast<size_t>(TYPE_MAX) };
+} // namespace
+
+DeviceStatusNotifier::~DeviceStatusNotifier()
+{
+    Stop();
+}
+
+void DeviceStatusNotifier::SetEvictCallback(EvictCallback callback)
+{
+    std::lock_guard lock(mutex_);
+    evictCallback_ = callback;
+}
+
+void DeviceStatusNotifier::Post(const std::vector<sptr<IRemoteDevStaCallback>> &listeners, const Data &data)
+{
+    {
+        std::lock_guard lock(mutex_);
+        if (stopped_) {
+            FI_HILOGW("Notifier has been stopped");
+            return;
+        }
+        StartWorkersLocked();
+        for (const auto &listener : listeners) {
+            CHKPC(listener);
+            auto remote = listener->AsObject();
+            CHKPC(remote);
+            auto [iter, isNew] = channels_.try_emplace(remote.GetRefPtr(), nullptr);
+            if (isNew) {
+                iter->second = std::make_shared<Channel>();
+                iter->second->listener = listener;
+            }
+            auto channel = iter->second;
+            if (channel->pending.find(data.type) != channel->pending.end()) {
+                ++droppedCount_;
+            } else {
+                if (channel->order.size() >= MAX_PENDING_PER_LISTENER) {
+                    channel->pending.erase(channel->order.front());
+                    channel->order.pop_front();
+                    ++droppedCount_;
+                }
+                channel->order.push_back(data.type);
+            }
+            channel->pending[data.type] = data;
+            if (!channel->scheduled && !channel->inFlight) {
+                channel->scheduled = true;
+                ready_.push_back(channel);
+            }
+        }
+    }
+    cv_.notify_all();
+}
+
+void DeviceStatusNotifier::Remove(sptr<IRemoteDevStaCallback> listener)
+{
+    CHKPV(listener);
+    auto remote = listener->AsObject();
+    CHKPV(remote);
+    std::lock_guard lock(mutex_);
+    auto iter = channels_.find(remote.GetRefPtr());
+    if (iter == channels_.end()) {
+        return;
+    }
+    iter->second->evicted = true;
+    iter->second->pending.clear();
+    iter->second->order.clear();
+    channels_.erase(iter);
+}
+
+void DeviceStatusNotifier::Stop()
+{
+    std::vector<std::thread> workers;
+    {
+        std::lock_guard lock(mutex_);
+        stopped_ = true;
+        running_ = false;
+        workers.swap(workers_);
+    }
+    cv_.notify_all();
+    for (auto &worker : workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+size_t DeviceStatusNotifier::GetDroppedCount() const
+{
+    std::lock_guard lock(mutex_);
+    return droppedCount_;
+}
+
+size_t DeviceStatusNotifier::GetEvictedCount() const
+{
+    std::lock_guard lock(mutex_);
+    return evictedCount_;
+}
+
+void DeviceStatusNotifier::StartWorkersLocked()
+{
+    if (running_) {
+        return;
+    }
+    running_ = true;
+    for (size_t index = 0; index < WORKER_NUM; ++index) {
+        workers_.emplace_back([this] { this->Worker(); });
+    }
+}
+
+void DeviceStatusNotifier::Worker()
+{
+    while (true) {
+        std::shared_ptr<Channel> channel;
+        Data data {};
+        {
+            std::unique_lock lock(mutex_);
+            cv_.wait(lock, [this] { return !running_ || !ready_.empty(); });
+            if (!running_) {
+                return;
+            }
+            channel = ready_.front();
+            ready_.pop_front();
+            channel->scheduled = false;
+            if (channel->evicted || channel->order.empty()) {
+                continue;
+            }
+            Type type = channel->order.front();
+            channel->order.pop_front();
+            data = channel->pending[type];
+            channel->pending.erase(type);
+            channel->inFlight = true;
+        }
+        std::vector<sptr<IRemoteDevStaCallback>> evicted;
+        auto remote = channel->listener->AsObject();
+        if ((remote == nullptr) || remote->IsObjectDead()) {
+            FI_HILOGW("Listener is dead, evict it");
+            std::lock_guard lock(mutex_);
+            channel->inFlight = false;
+            EvictLocked(channel, evicted);
+        } else {
+            channel->listener->OnDeviceStatusChanged(data);
+            std::lock_guard lock(mutex_);
+            channel->inFlight = false;
+            if (!channel->evicted && !channel->order.empty() && !channel->scheduled) {
+                channel->scheduled = true;
+                ready_.push_back(channel);
+                cv_.notify_one();
+            }
+        }
+        NotifyEvicted(evicted);
+    }
+}
+
+void DeviceStatusNotifier::EvictLocked(const std::shared_ptr<Channel> &channel,
+    std::vector<sptr<IRemoteDevStaCallback>> &evicted)
+{
+    if (channel->evicted) {
+        return;
+    }
+    FI_HILOGW("Evict listener, pending:%{public}zu", channel->order.size());
+    channel->evicted = true;
+    channel->pending.clear();
+    channel->order.clear();
+    ++evictedCount_;
+    evicted.push_back(channel->listener);
+    for (auto iter = channels_.begin(); iter != channels_.end(); ++iter) {
+        if (iter->second == channel) {
+            channels_.erase(iter);
+            break;
+        }
+    }
+}
+
+void DeviceStatusNotifier::NotifyEvicted(const std::vector<sptr<IRemoteDevStaCallback>> &evicted)
+{
+    if (evicted.empty()) {
+        return;
+    }
+    EvictCallback callback;
+    {
+        std::lock_guard lock(mutex_);
+        callback = evictCallback_;
+    }
+    if (callback == nullptr) {
+        return;
+    }
+    for (const auto &listener : evicted) {
+        callback(listener);
+    }
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
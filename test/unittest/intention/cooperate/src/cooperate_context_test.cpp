@@ -37,6 +37,7 @@ using namespace Cooperate;
 namespace {
 const std::string TEST_DEV_NODE { "/dev/input/TestDeviceNode" };
 constexpr int32_t TIME_WAIT_FOR_OP_MS { 20 };
+constexpr int32_t TEST_DEVICE_ID { 1 };
 std::shared_ptr<Context> g_context { nullptr };
 std::shared_ptr<HotplugObserver> g_observer { nullptr };
 std::shared_ptr<SocketSession> g_session { nullptr };
@@ -578,6 +579,31 @@ HWTEST_F(CooperateContextTest, CooperateContextTest019, TestSize.Level1)
     };
     ASSERT_NO_FATAL_FAILURE(g_context->AdjustPointerPos(dSoftbusCooperateOptions));
 }
+
+/**
+ * @tc.name: CooperateContextTest020
+ * @tc.desc: Test a settled batch of hot-plug changes reaches cooperate as one event, removals first
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(CooperateContextTest, CooperateContextTest020, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    auto [sender, receiver] = Channel<CooperateEvent>::OpenChannel();
+    HotplugObserver observer(sender);
+    DeviceChanges changes;
+    changes.added.push_back(std::make_shared<Device>(TEST_DEVICE_ID + 1));
+    changes.removed.push_back(std::make_shared<Device>(TEST_DEVICE_ID));
+    observer.OnDevicesChanged(changes);
+    CooperateEvent event = receiver.Receive();
+    ASSERT_EQ(event.type, CooperateEventType::INPUT_HOTPLUG_BATCH_EVENT);
+    InputHotplugBatchEvent batch = std::get<InputHotplugBatchEvent>(event.event);
+    ASSERT_EQ(batch.changes.size(), changes.added.size() + changes.removed.size());
+    EXPECT_EQ(batch.changes.front().deviceId, TEST_DEVICE_ID);
+    EXPECT_EQ(batch.changes.front().type, InputHotplugType::UNPLUG);
+    EXPECT_EQ(batch.changes.back().deviceId, TEST_DEVICE_ID + 1);
+    EXPECT_EQ(batch.changes.back().type, InputHotplugType::PLUG);
+}
 } // namespace DeviceStatus
 } // namespace Msdp
 } // namespace OHOS
\ No newline at end of file
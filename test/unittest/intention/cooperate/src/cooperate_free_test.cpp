@@ -14,6 +14,9 @@
  */
 #include "cooperate_free_test.h"
 
+#include <future>
+
+#include "async_step.h"
 #include "cooperate_context.h"
 #include "cooperate_free.h"
 #include "cooperate_in.h"
@@ -52,6 +55,7 @@ std::shared_ptr<SocketSession> g_session { nullptr };
 std::shared_ptr<Cooperate::StateMachine> g_stateMachine { nullptr };
 const std::string LOCAL_NETWORKID { "testLocalNetworkId" };
 const std::string REMOTE_NETWORKID { "testRemoteNetworkId" };
+constexpr std::chrono::milliseconds STEP_DEADLINE { 5000 };
 } // namespace
 
 void CooperateFreeTest::NotifyCooperate()
@@ -69,29 +73,22 @@ void CooperateFreeTest::NotifyCooperate()
 
 void CooperateFreeTest::CheckInHot()
 {
+    auto display = HotArea::BuildHotRegions(HOTAREA_500, HOTAREA_500);
     g_context->hotArea_.displayX_ = 0;
-    g_context->hotArea_.height_ = HOTAREA_500;
     g_context->hotArea_.displayY_ = HOTAREA_250;
-    g_context->hotArea_.CheckInHotArea();
-    g_context->hotArea_.width_ = HOTAREA_200;
+    g_context->hotArea_.CheckInHotArea(display);
     g_context->hotArea_.displayX_ = HOTAREA_150;
-    g_context->hotArea_.height_ = HOTAREA_500;
     g_context->hotArea_.displayY_ = HOTAREA_250;
-    g_context->hotArea_.CheckInHotArea();
+    g_context->hotArea_.CheckInHotArea(HotArea::BuildHotRegions(HOTAREA_200, HOTAREA_500));
     g_context->hotArea_.displayY_ = HOTAREA_50;
-    g_context->hotArea_.width_ = HOTAREA_500;
     g_context->hotArea_.displayX_ = HOTAREA_250;
-    g_context->hotArea_.CheckInHotArea();
-    g_context->hotArea_.height_ = HOTAREA_500;
+    g_context->hotArea_.CheckInHotArea(display);
     g_context->hotArea_.displayY_ = HOTAREA_500;
-    g_context->hotArea_.width_ = HOTAREA_500;
     g_context->hotArea_.displayX_ = HOTAREA_250;
-    g_context->hotArea_.CheckInHotArea();
-    g_context->hotArea_.height_ = HOTAREA_500;
+    g_context->hotArea_.CheckInHotArea(display);
     g_context->hotArea_.displayY_ = HOTAREA_NEGATIVE_500;
-    g_context->hotArea_.width_ = HOTAREA_500;
     g_context->hotArea_.displayX_ = HOTAREA_NEGATIVE_200;
-    g_context->hotArea_.CheckInHotArea();
+    g_context->hotArea_.CheckInHotArea(display);
 }
 
 void CooperateFreeTest::SetUpTestCase() {}
@@ -591,6 +588,65 @@ HWTEST_F(CooperateFreeTest, CooperateFreeTest016, TestSize.Level1)
     ASSERT_NE(env, nullptr);
 }
 
+/**
+ * @tc.name: CooperateFreeTest017
+ * @tc.desc: Test AsyncStep, a step finished within its deadline hands its result to the waiter
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(CooperateFreeTest, CooperateFreeTest017, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    StepExecutor executor;
+    AsyncStep<int32_t> first(executor, [] { return RET_OK; });
+    AsyncStep<int32_t> second(executor, [] { return RET_ERR; });
+    int32_t ret = RET_ERR;
+    ASSERT_TRUE(first.Wait(STEP_DEADLINE, ret));
+    EXPECT_EQ(ret, RET_OK);
+    ASSERT_TRUE(second.Wait(STEP_DEADLINE, ret));
+    EXPECT_EQ(ret, RET_ERR);
+    EXPECT_GE(first.GetElapsed(), 0);
+    executor.Stop();
+}
+
+/**
+ * @tc.name: CooperateFreeTest018
+ * @tc.desc: Test AsyncStep, the late result of a step given up on is rolled back on the executor
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(CooperateFreeTest, CooperateFreeTest018, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    StepExecutor executor;
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::promise<int32_t> rolledBack;
+    std::future<int32_t> rollback = rolledBack.get_future();
+    int32_t ret = RET_ERR;
+    {
+        AsyncStep<int32_t> slow(executor, [released] {
+            released.wait();
+            return RET_OK;
+        }, [&rolledBack](int32_t result) { rolledBack.set_value(result); });
+        EXPECT_FALSE(slow.Wait(std::chrono::milliseconds(0), ret));
+        EXPECT_EQ(slow.GetElapsed(), -1);
+        release.set_value();
+    }
+    ASSERT_EQ(rollback.wait_for(STEP_DEADLINE), std::future_status::ready);
+    EXPECT_EQ(rollback.get(), RET_OK);
+    EXPECT_EQ(ret, RET_ERR);
+
+    executor.Stop();
+    bool ran = false;
+    AsyncStep<int32_t> dropped(executor, [&ran] {
+        ran = true;
+        return RET_OK;
+    });
+    EXPECT_FALSE(dropped.Wait(std::chrono::milliseconds(0), ret));
+    EXPECT_FALSE(ran);
+}
+
 } // namespace DeviceStatus
 } // namespace Msdp
 } // namespace OHOS
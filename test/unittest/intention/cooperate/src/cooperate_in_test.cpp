@@ -70,29 +70,22 @@ void CooperateInTest::NotifyCooperate()
 
 void CooperateInTest::CheckInHot()
 {
+    auto display = HotArea::BuildHotRegions(HOTAREA_500, HOTAREA_500);
     g_context->hotArea_.displayX_ = 0;
-    g_context->hotArea_.height_ = HOTAREA_500;
     g_context->hotArea_.displayY_ = HOTAREA_250;
-    g_context->hotArea_.CheckInHotArea();
-    g_context->hotArea_.width_ = HOTAREA_200;
+    g_context->hotArea_.CheckInHotArea(display);
     g_context->hotArea_.displayX_ = HOTAREA_150;
-    g_context->hotArea_.height_ = HOTAREA_500;
     g_context->hotArea_.displayY_ = HOTAREA_250;
-    g_context->hotArea_.CheckInHotArea();
+    g_context->hotArea_.CheckInHotArea(HotArea::BuildHotRegions(HOTAREA_200, HOTAREA_500));
     g_context->hotArea_.displayY_ = HOTAREA_50;
-    g_context->hotArea_.width_ = HOTAREA_500;
     g_context->hotArea_.displayX_ = HOTAREA_250;
-    g_context->hotArea_.CheckInHotArea();
-    g_context->hotArea_.height_ = HOTAREA_500;
+    g_context->hotArea_.CheckInHotArea(display);
     g_context->hotArea_.displayY_ = HOTAREA_500;
-    g_context->hotArea_.width_ = HOTAREA_500;
     g_context->hotArea_.displayX_ = HOTAREA_250;
-    g_context->hotArea_.CheckInHotArea();
-    g_context->hotArea_.height_ = HOTAREA_500;
+    g_context->hotArea_.CheckInHotArea(display);
     g_context->hotArea_.displayY_ = HOTAREA_NEGATIVE_500;
-    g_context->hotArea_.width_ = HOTAREA_500;
     g_context->hotArea_.displayX_ = HOTAREA_NEGATIVE_200;
-    g_context->hotArea_.CheckInHotArea();
+    g_context->hotArea_.CheckInHotArea(display);
 }
 
 void CooperateInTest::SetUpTestCase() {}
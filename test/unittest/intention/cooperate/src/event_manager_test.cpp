@@ -14,6 +14,9 @@
  */
 #include "event_manager_test.h"
 
+#include <sys/socket.h>
+#include <unistd.h>
+
 #include "cooperate_context.h"
 #include "cooperate_free.h"
 #include "cooperate_in.h"
@@ -53,6 +56,8 @@ std::shared_ptr<SocketSession> g_session { nullptr };
 std::shared_ptr<Cooperate::StateMachine> g_stateMachine { nullptr };
 const std::string LOCAL_NETWORKID { "testLocalNetworkId" };
 const std::string REMOTE_NETWORKID { "testRemoteNetworkId" };
+constexpr uint64_t DOMAIN_ID { 0xD002220 };
+constexpr size_t FILL_CHUNK_SIZE { 4096 };
 } // namespace
 
 void EventManagerTest::NotifyCooperate()
@@ -70,29 +75,22 @@ void EventManagerTest::NotifyCooperate()
 
 void EventManagerTest::CheckInHot()
 {
+    auto display = HotArea::BuildHotRegions(HOTAREA_500, HOTAREA_500);
     g_context->hotArea_.displayX_ = 0;
-    g_context->hotArea_.height_ = HOTAREA_500;
     g_context->hotArea_.displayY_ = HOTAREA_250;
-    g_context->hotArea_.CheckInHotArea();
-    g_context->hotArea_.width_ = HOTAREA_200;
+    g_context->hotArea_.CheckInHotArea(display);
     g_context->hotArea_.displayX_ = HOTAREA_150;
-    g_context->hotArea_.height_ = HOTAREA_500;
     g_context->hotArea_.displayY_ = HOTAREA_250;
-    g_context->hotArea_.CheckInHotArea();
+    g_context->hotArea_.CheckInHotArea(HotArea::BuildHotRegions(HOTAREA_200, HOTAREA_500));
     g_context->hotArea_.displayY_ = HOTAREA_50;
-    g_context->hotArea_.width_ = HOTAREA_500;
     g_context->hotArea_.displayX_ = HOTAREA_250;
-    g_context->hotArea_.CheckInHotArea();
-    g_context->hotArea_.height_ = HOTAREA_500;
+    g_context->hotArea_.CheckInHotArea(display);
     g_context->hotArea_.displayY_ = HOTAREA_500;
-    g_context->hotArea_.width_ = HOTAREA_500;
     g_context->hotArea_.displayX_ = HOTAREA_250;
-    g_context->hotArea_.CheckInHotArea();
-    g_context->hotArea_.height_ = HOTAREA_500;
+    g_context->hotArea_.CheckInHotArea(display);
     g_context->hotArea_.displayY_ = HOTAREA_NEGATIVE_500;
-    g_context->hotArea_.width_ = HOTAREA_500;
     g_context->hotArea_.displayX_ = HOTAREA_NEGATIVE_200;
-    g_context->hotArea_.CheckInHotArea();
+    g_context->hotArea_.CheckInHotArea(display);
 }
 
 void EventManagerTest::SetUpTestCase() {}
@@ -359,6 +357,48 @@ HWTEST_F(EventManagerTest, EventManagerTest006, TestSize.Level1)
     bool ret = g_context->dsoftbus_.OnPacket("test", packet1);
     EXPECT_FALSE(ret);
 }
+
+/**
+ * @tc.name: EventManagerTest007
+ * @tc.desc: Listener notices are sent through the cached session, and those for a client that is
+ *           not draining wait in the session queue instead of blocking the cooperate worker.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(EventManagerTest, EventManagerTest007, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    int32_t pid = IPCSkeleton::GetCallingPid();
+    int32_t sockFds[2] { -1, -1 };
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, sockFds), 0);
+    fdsan_exchange_owner_tag(sockFds[0], 0, DOMAIN_ID);
+    auto session = std::make_shared<SocketSession>("test", 1, 1, sockFds[0], IPCSkeleton::GetCallingUid(), pid);
+    auto env = TestContext::GetInstance();
+    env->socketSessionMgr_.sessions_[sockFds[0]] = session;
+    RegisterListenerEvent registerListenerEvent { pid, 1 };
+    g_context->eventMgr_.RegisterListener(registerListenerEvent);
+
+    g_context->eventMgr_.OnCooperateMessage(CoordinationMessage::ACTIVATE, REMOTE_NETWORKID);
+    PackHead head;
+    ASSERT_EQ(recv(sockFds[1], &head, sizeof(head), MSG_DONTWAIT), static_cast<ssize_t>(sizeof(head)));
+    EXPECT_EQ(head.idMsg, MessageId::COORDINATION_ADD_LISTENER);
+    std::vector<char> body(head.size);
+    EXPECT_EQ(recv(sockFds[1], body.data(), body.size(), MSG_DONTWAIT), static_cast<ssize_t>(body.size()));
+    auto listener = g_context->eventMgr_.listeners_[pid];
+    ASSERT_NE(listener, nullptr);
+    EXPECT_EQ(listener->session.lock(), session);
+
+    std::vector<char> chunk(FILL_CHUNK_SIZE);
+    while (send(sockFds[0], chunk.data(), chunk.size(), MSG_DONTWAIT | MSG_NOSIGNAL) > 0) {}
+    g_context->eventMgr_.OnCooperateMessage(CoordinationMessage::DEACTIVATE, REMOTE_NETWORKID);
+    EXPECT_EQ(listener->nBackpressured, 1u);
+    EXPECT_EQ(session->GetStats().depth, 1u);
+
+    g_context->eventMgr_.OnClientDied(ClientDiedEvent { .pid = pid });
+    EXPECT_TRUE(g_context->eventMgr_.listeners_.empty());
+    env->socketSessionMgr_.sessions_.erase(sockFds[0]);
+    close(sockFds[1]);
+}
 } // namespace DeviceStatus
 } // namespace Msdp
 } // namespace OHOS
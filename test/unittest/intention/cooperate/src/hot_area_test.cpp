@@ -82,29 +82,27 @@ void HotAreaTest::NotifyCooperate()
 
 void HotAreaTest::CheckInHot()
 {
+    auto display = HotArea::BuildHotRegions(HOTAREA_500, HOTAREA_500);
     g_context->hotArea_.displayX_ = 0;
-    g_context->hotArea_.height_ = HOTAREA_500;
     g_context->hotArea_.displayY_ = HOTAREA_250;
-    g_context->hotArea_.CheckInHotArea();
-    g_context->hotArea_.width_ = HOTAREA_200;
+    g_context->hotArea_.CheckInHotArea(display);
+    EXPECT_EQ(g_context->hotArea_.type_, HotAreaType::AREA_LEFT);
     g_context->hotArea_.displayX_ = HOTAREA_150;
-    g_context->hotArea_.height_ = HOTAREA_500;
     g_context->hotArea_.displayY_ = HOTAREA_250;
-    g_context->hotArea_.CheckInHotArea();
+    g_context->hotArea_.CheckInHotArea(HotArea::BuildHotRegions(HOTAREA_200, HOTAREA_500));
+    EXPECT_EQ(g_context->hotArea_.type_, HotAreaType::AREA_RIGHT);
     g_context->hotArea_.displayY_ = HOTAREA_50;
-    g_context->hotArea_.width_ = HOTAREA_500;
     g_context->hotArea_.displayX_ = HOTAREA_250;
-    g_context->hotArea_.CheckInHotArea();
-    g_context->hotArea_.height_ = HOTAREA_500;
+    g_context->hotArea_.CheckInHotArea(display);
+    EXPECT_EQ(g_context->hotArea_.type_, HotAreaType::AREA_TOP);
     g_context->hotArea_.displayY_ = HOTAREA_500;
-    g_context->hotArea_.width_ = HOTAREA_500;
     g_context->hotArea_.displayX_ = HOTAREA_250;
-    g_context->hotArea_.CheckInHotArea();
-    g_context->hotArea_.height_ = HOTAREA_500;
+    g_context->hotArea_.CheckInHotArea(display);
+    EXPECT_EQ(g_context->hotArea_.type_, HotAreaType::AREA_BOTTOM);
     g_context->hotArea_.displayY_ = HOTAREA_NEGATIVE_500;
-    g_context->hotArea_.width_ = HOTAREA_500;
     g_context->hotArea_.displayX_ = HOTAREA_NEGATIVE_200;
-    g_context->hotArea_.CheckInHotArea();
+    g_context->hotArea_.CheckInHotArea(display);
+    EXPECT_EQ(g_context->hotArea_.type_, HotAreaType::AREA_NONE);
 }
 
 void HotAreaTest::SetUpTestCase() {}
@@ -188,11 +186,12 @@ HWTEST_F(HotAreaTest, HotAreaTest001, TestSize.Level1)
     EnableCooperateEvent enableCooperateEvent{1, 1, 1};
     g_context->hotArea_.EnableCooperate(enableCooperateEvent);
     CheckInHot();
-    g_context->hotArea_.CheckPointerToEdge(HotAreaType::AREA_LEFT);
-    g_context->hotArea_.CheckPointerToEdge(HotAreaType::AREA_RIGHT);
-    g_context->hotArea_.CheckPointerToEdge(HotAreaType::AREA_TOP);
-    g_context->hotArea_.CheckPointerToEdge(HotAreaType::AREA_BOTTOM);
-    g_context->hotArea_.CheckPointerToEdge(HotAreaType::AREA_NONE);
+    auto display = HotArea::BuildHotRegions(HOTAREA_500, HOTAREA_500);
+    g_context->hotArea_.CheckPointerToEdge(display, HotAreaType::AREA_LEFT);
+    g_context->hotArea_.CheckPointerToEdge(display, HotAreaType::AREA_RIGHT);
+    g_context->hotArea_.CheckPointerToEdge(display, HotAreaType::AREA_TOP);
+    g_context->hotArea_.CheckPointerToEdge(display, HotAreaType::AREA_BOTTOM);
+    g_context->hotArea_.CheckPointerToEdge(display, HotAreaType::AREA_NONE);
     g_context->hotArea_.NotifyMessage();
 
     int32_t ret = g_context->hotArea_.ProcessData(nullptr);
@@ -207,6 +206,48 @@ HWTEST_F(HotAreaTest, HotAreaTest001, TestSize.Level1)
     ret = g_context->hotArea_.ProcessData(pointerEvent);
     EXPECT_EQ(ret, RET_OK);
 }
+
+/**
+ * @tc.name: HotAreaTest002
+ * @tc.desc: Pointer events are evaluated against the hot regions of their own display, and only a
+ *           change of region or edge state, or a newly added listener, is notified.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(HotAreaTest, HotAreaTest002, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    constexpr int32_t secondDisplayId { 1 };
+    constexpr int32_t secondDisplaySize { 1000 };
+    auto layout = std::make_shared<HotArea::HotAreaLayout>();
+    layout->defaultDisplayId = 0;
+    layout->displays.emplace(0, HotArea::BuildHotRegions(HOTAREA_500, HOTAREA_500));
+    layout->displays.emplace(secondDisplayId, HotArea::BuildHotRegions(secondDisplaySize, secondDisplaySize));
+    std::atomic_store(&g_context->hotArea_.layout_, std::shared_ptr<const HotArea::HotAreaLayout>(layout));
+
+    auto pointerEvent = MMI::PointerEvent::Create();
+    ASSERT_NE(pointerEvent, nullptr);
+    pointerEvent->SetPointerId(1);
+    pointerEvent->AddPointerItem(CreatePointerItem(1, 1, { HOTAREA_500 - 1, HOTAREA_250 }, true));
+    EXPECT_EQ(g_context->hotArea_.ProcessData(pointerEvent), RET_OK);
+    EXPECT_EQ(g_context->hotArea_.type_, HotAreaType::AREA_RIGHT);
+    EXPECT_EQ(g_context->hotArea_.lastType_, HotAreaType::AREA_RIGHT);
+    pointerEvent->SetTargetDisplayId(secondDisplayId);
+    EXPECT_EQ(g_context->hotArea_.ProcessData(pointerEvent), RET_OK);
+    EXPECT_EQ(g_context->hotArea_.type_, HotAreaType::AREA_NONE);
+
+    EXPECT_FALSE(g_context->hotArea_.IsTransition());
+    g_context->hotArea_.type_ = HotAreaType::AREA_LEFT;
+    EXPECT_TRUE(g_context->hotArea_.IsTransition());
+    EXPECT_FALSE(g_context->hotArea_.IsTransition());
+    g_context->hotArea_.isEdge_ = true;
+    EXPECT_TRUE(g_context->hotArea_.IsTransition());
+    RegisterHotareaListenerEvent registerHotareaListenerEvent{IPCSkeleton::GetCallingPid(), 1};
+    g_context->hotArea_.AddListener(registerHotareaListenerEvent);
+    EXPECT_TRUE(g_context->hotArea_.IsTransition());
+    EXPECT_FALSE(g_context->hotArea_.IsTransition());
+    g_context->hotArea_.RemoveListener(registerHotareaListenerEvent);
+}
 } // namespace DeviceStatus
 } // namespace Msdp
 } // namespace OHOS
\ No newline at end of file
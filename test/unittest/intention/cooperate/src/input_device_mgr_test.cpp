@@ -24,6 +24,7 @@
 #include "i_device.h"
 #include "i_cooperate_state.h"
 #include "input_adapter.h"
+#include "input_device_inventory.h"
 #include "input_device_mgr.h"
 #include "ipc_skeleton.h"
 #include "mouse_location.h"
@@ -54,6 +55,92 @@ std::shared_ptr<SocketSession> g_session { nullptr };
 std::shared_ptr<Cooperate::StateMachine> g_stateMachine { nullptr };
 const std::string LOCAL_NETWORKID { "testLocalNetworkId" };
 const std::string REMOTE_NETWORKID { "testRemoteNetworkId" };
+constexpr int32_t INVENTORY_SIZE { 50 };
+constexpr int32_t TEST_BUS { 3 };
+
+std::shared_ptr<IDevice> CreateInputDevice(int32_t deviceId, const std::string &name)
+{
+    auto device = std::make_shared<Device>(deviceId);
+    device->SetDevPath("/dev/input/event" + std::to_string(deviceId));
+    device->SetSysPath("/sys/devices/virtual/input/input" + std::to_string(deviceId));
+    device->SetName(name);
+    device->SetBus(TEST_BUS);
+    device->SetPhys("usb-0000:00:14.0-" + std::to_string(deviceId));
+    device->SetUniq("uniq" + std::to_string(deviceId));
+    device->AddCapability(IDevice::Capability::DEVICE_CAP_KEYBOARD);
+    return device;
+}
+
+// Sends @deltas through packets the way peers exchange them and applies them to @remote.
+size_t TransferDeltas(const std::vector<InputDeviceDelta> &deltas, InputDeviceInventory &remote,
+    std::vector<int32_t> &touchedIds)
+{
+    size_t bytes = 0;
+    for (const auto &delta : deltas) {
+        NetPacket packet(MessageId::DSOFTBUS_INPUT_DEV_DELTA);
+        EXPECT_EQ(InputDeviceInventory::WriteDelta(delta, packet), RET_OK);
+        bytes += packet.Size();
+        InputDeviceDelta received;
+        EXPECT_EQ(InputDeviceInventory::ReadDelta(packet, received), RET_OK);
+        EXPECT_EQ(remote.Apply(received, touchedIds), RET_OK);
+    }
+    return bytes;
+}
+
+// Keeps what InputDeviceMgr sends to peers instead of putting it on the bus.
+class RecordingDSoftbus final : public IDSoftbusAdapter {
+public:
+    int32_t Enable() override
+    {
+        return RET_OK;
+    }
+    void Disable() override {}
+    void AddObserver(std::shared_ptr<IDSoftbusObserver> observer) override {}
+    void RemoveObserver(std::shared_ptr<IDSoftbusObserver> observer) override {}
+    int32_t CheckDeviceOnline(const std::string &networkId) override
+    {
+        return RET_OK;
+    }
+    int32_t OpenSession(const std::string &networkId) override
+    {
+        return RET_OK;
+    }
+    void CloseSession(const std::string &networkId) override {}
+    void CloseAllSessions() override {}
+    void StartHeartBeat(const std::string &networkId) override {}
+    void StopHeartBeat(const std::string &networkId) override {}
+    int32_t SendPacket(const std::string &networkId, NetPacket &packet) override
+    {
+        sent.emplace_back(networkId, packet);
+        return RET_OK;
+    }
+    int32_t SendParcel(const std::string &networkId, Parcel &parcel) override
+    {
+        return RET_OK;
+    }
+    int32_t BroadcastPacket(NetPacket &packet) override
+    {
+        return RET_OK;
+    }
+    bool HasSessionExisted(const std::string &networkId) override
+    {
+        return true;
+    }
+
+    std::vector<std::pair<std::string, NetPacket>> sent;
+};
+
+DSoftbusSyncInputDevice MakeDeltaNotice(const std::string &networkId, const InputDeviceDelta &delta)
+{
+    return DSoftbusSyncInputDevice {
+        .networkId = networkId,
+        .devices = delta.devices,
+        .type = InputDevSyncType::DELTA,
+        .baseDigest = delta.baseDigest,
+        .digest = delta.digest,
+        .removedIds = delta.removedIds,
+    };
+}
 } // namespace
 
 void InputDeviceMgrTest::NotifyCooperate()
@@ -71,29 +158,22 @@ void InputDeviceMgrTest::NotifyCooperate()
 
 void InputDeviceMgrTest::CheckInHot()
 {
+    auto display = HotArea::BuildHotRegions(HOTAREA_500, HOTAREA_500);
     g_context->hotArea_.displayX_ = 0;
-    g_context->hotArea_.height_ = HOTAREA_500;
     g_context->hotArea_.displayY_ = HOTAREA_250;
-    g_context->hotArea_.CheckInHotArea();
-    g_context->hotArea_.width_ = HOTAREA_200;
+    g_context->hotArea_.CheckInHotArea(display);
     g_context->hotArea_.displayX_ = HOTAREA_150;
-    g_context->hotArea_.height_ = HOTAREA_500;
     g_context->hotArea_.displayY_ = HOTAREA_250;
-    g_context->hotArea_.CheckInHotArea();
+    g_context->hotArea_.CheckInHotArea(HotArea::BuildHotRegions(HOTAREA_200, HOTAREA_500));
     g_context->hotArea_.displayY_ = HOTAREA_50;
-    g_context->hotArea_.width_ = HOTAREA_500;
     g_context->hotArea_.displayX_ = HOTAREA_250;
-    g_context->hotArea_.CheckInHotArea();
-    g_context->hotArea_.height_ = HOTAREA_500;
+    g_context->hotArea_.CheckInHotArea(display);
     g_context->hotArea_.displayY_ = HOTAREA_500;
-    g_context->hotArea_.width_ = HOTAREA_500;
     g_context->hotArea_.displayX_ = HOTAREA_250;
-    g_context->hotArea_.CheckInHotArea();
-    g_context->hotArea_.height_ = HOTAREA_500;
+    g_context->hotArea_.CheckInHotArea(display);
     g_context->hotArea_.displayY_ = HOTAREA_NEGATIVE_500;
-    g_context->hotArea_.width_ = HOTAREA_500;
     g_context->hotArea_.displayX_ = HOTAREA_NEGATIVE_200;
-    g_context->hotArea_.CheckInHotArea();
+    g_context->hotArea_.CheckInHotArea(display);
 }
 
 void InputDeviceMgrTest::SetUpTestCase() {}
@@ -331,7 +411,7 @@ HWTEST_F(InputDeviceMgrTest, inputDevcieMgr_test009, TestSize.Level1)
     inputHotplugEvent.isKeyboard = true;
     inputHotplugEvent.deviceId = 1;
     inputHotplugEvent.type = InputHotplugType::UNPLUG;
-    ASSERT_NO_FATAL_FAILURE(g_context->inputDevMgr_.BroadcastHotPlugToRemote(inputHotplugEvent));
+    ASSERT_NO_FATAL_FAILURE(g_context->inputDevMgr_.BroadcastHotPlugToRemote({ inputHotplugEvent }));
 }
 
 /**
@@ -347,7 +427,7 @@ HWTEST_F(InputDeviceMgrTest, inputDevcieMgr_test010, TestSize.Level1)
     inputHotplugEvent.isKeyboard = true;
     inputHotplugEvent.deviceId = 1;
     inputHotplugEvent.type = InputHotplugType::PLUG;
-    ASSERT_NO_FATAL_FAILURE(g_context->inputDevMgr_.BroadcastHotPlugToRemote(inputHotplugEvent));
+    ASSERT_NO_FATAL_FAILURE(g_context->inputDevMgr_.BroadcastHotPlugToRemote({ inputHotplugEvent }));
 }
 
 /**
@@ -364,6 +444,217 @@ HWTEST_F(InputDeviceMgrTest, stateMachine_test011, TestSize.Level1)
     g_context->AttachSender(sender);
     ASSERT_NO_FATAL_FAILURE(g_context->inputDevMgr_.Enable(sender));
 }
+
+/**
+ * @tc.name: inputDevcieMgr_test012
+ * @tc.desc: Peers of a 50-device inventory send everything once, only a digest on reconnect,
+ *           and only the changed devices on hot plug, without touching unchanged devices.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(InputDeviceMgrTest, inputDevcieMgr_test012, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    std::vector<std::shared_ptr<IDevice>> devices;
+    size_t fullBytes = 0;
+    for (int32_t deviceId = 0; deviceId < INVENTORY_SIZE; ++deviceId) {
+        devices.push_back(CreateInputDevice(deviceId, "keyboard" + std::to_string(deviceId)));
+        NetPacket packet(MessageId::DSOFTBUS_INPUT_DEV_SYNC);
+        InputDeviceInventory::SerializeDevice(devices.back(), packet);
+        fullBytes += packet.Size();
+    }
+    InputDeviceInventory local;
+    local.Reset(devices);
+    InputDeviceInventory remote;
+
+    NetPacket pull(MessageId::DSOFTBUS_INPUT_DEV_PULL);
+    ASSERT_EQ(InputDeviceInventory::WriteEntries(remote.GetDigest(), remote.GetEntries(), pull), RET_OK);
+    uint64_t baseDigest { 0 };
+    InputDeviceEntries known;
+    ASSERT_EQ(InputDeviceInventory::ReadEntries(pull, baseDigest, known), RET_OK);
+    auto deltas = local.Diff(known, baseDigest);
+    EXPECT_GT(deltas.size(), 1u);
+    std::vector<int32_t> touchedIds;
+    EXPECT_GE(TransferDeltas(deltas, remote, touchedIds), fullBytes);
+    EXPECT_TRUE(touchedIds.empty());
+    EXPECT_EQ(remote.GetSize(), static_cast<size_t>(INVENTORY_SIZE));
+    EXPECT_EQ(remote.GetDigest(), local.GetDigest());
+
+    NetPacket digest(MessageId::DSOFTBUS_INPUT_DEV_DIGEST);
+    digest << local.GetDigest();
+    EXPECT_EQ(digest.Size(), sizeof(uint64_t));
+
+    devices[0] = CreateInputDevice(0, "renamed keyboard");
+    devices.erase(devices.begin() + 1);
+    devices.push_back(CreateInputDevice(INVENTORY_SIZE, "plugged keyboard"));
+    InputDeviceInventory current;
+    current.Reset(devices);
+    deltas = current.Diff(local.GetEntries(), local.GetDigest());
+    ASSERT_EQ(deltas.size(), 1u);
+    EXPECT_EQ(deltas[0].devices.size(), 2u);
+    EXPECT_EQ(deltas[0].removedIds, std::vector<int32_t>({ 1 }));
+    size_t deltaBytes = TransferDeltas(deltas, remote, touchedIds);
+    EXPECT_LT(deltaBytes, fullBytes / 10);
+    EXPECT_EQ(touchedIds, std::vector<int32_t>({ 1, 0 }));
+    EXPECT_EQ(remote.GetDigest(), current.GetDigest());
+}
+
+/**
+ * @tc.name: inputDevcieMgr_test013
+ * @tc.desc: A delta that does not apply on top of the cached inventory is rejected.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(InputDeviceMgrTest, inputDevcieMgr_test013, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    InputDeviceInventory local;
+    local.Reset({ CreateInputDevice(0, "keyboard") });
+    InputDeviceInventory remote;
+    remote.Reset({ CreateInputDevice(1, "mouse") });
+    auto deltas = local.Diff({}, InputDeviceInventory().GetDigest());
+    ASSERT_EQ(deltas.size(), 1u);
+    std::vector<int32_t> touchedIds;
+    EXPECT_EQ(remote.Apply(deltas[0], touchedIds), RET_ERR);
+    EXPECT_TRUE(touchedIds.empty());
+    EXPECT_EQ(remote.GetSize(), 1u);
+}
+
+/**
+ * @tc.name: inputDevcieMgr_test014
+ * @tc.desc: InputDeviceMgr answers a pull with deltas, applies deltas, restores the cache on a matching digest
+ *           and pulls on a stale digest or a delta it cannot apply.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(InputDeviceMgrTest, inputDevcieMgr_test014, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    auto env = TestContext::GetInstance();
+    auto bus = std::make_unique<RecordingDSoftbus>();
+    RecordingDSoftbus *recorder = bus.get();
+    std::unique_ptr<IDSoftbusAdapter> origin = std::move(env->dsoftbus_);
+    env->dsoftbus_ = std::move(bus);
+    auto &mgr = g_context->inputDevMgr_;
+    std::vector<std::shared_ptr<IDevice>> devices {
+        CreateInputDevice(0, "keyboard"), CreateInputDevice(1, "mouse"), CreateInputDevice(2, "touchpad") };
+    mgr.localInventory_.Reset(devices);
+
+    DSoftbusSyncInputDevice pull {
+        .networkId = REMOTE_NETWORKID,
+        .type = InputDevSyncType::PULL,
+        .baseDigest = InputDeviceInventory().GetDigest(),
+    };
+    mgr.OnRemoteInputDevice(pull);
+    std::vector<InputDeviceDelta> deltas;
+    for (auto &[networkId, packet] : recorder->sent) {
+        EXPECT_EQ(networkId, REMOTE_NETWORKID);
+        EXPECT_EQ(packet.GetMsgId(), MessageId::DSOFTBUS_INPUT_DEV_DELTA);
+        InputDeviceDelta delta;
+        EXPECT_EQ(InputDeviceInventory::ReadDelta(packet, delta), RET_OK);
+        deltas.push_back(delta);
+    }
+    ASSERT_FALSE(deltas.empty());
+    recorder->sent.clear();
+
+    for (const auto &delta : deltas) {
+        mgr.OnRemoteInputDevice(MakeDeltaNotice(REMOTE_NETWORKID, delta));
+    }
+    EXPECT_TRUE(recorder->sent.empty());
+    EXPECT_EQ(mgr.remoteInventories_[REMOTE_NETWORKID].GetDigest(), mgr.localInventory_.GetDigest());
+    EXPECT_EQ(mgr.remoteDevices_[REMOTE_NETWORKID].size(), devices.size());
+
+    mgr.remoteDevices_.erase(REMOTE_NETWORKID);
+    DSoftbusSyncInputDevice digest {
+        .networkId = REMOTE_NETWORKID,
+        .type = InputDevSyncType::DIGEST,
+        .digest = mgr.localInventory_.GetDigest(),
+    };
+    mgr.OnRemoteInputDevice(digest);
+    EXPECT_TRUE(recorder->sent.empty());
+    EXPECT_EQ(mgr.remoteDevices_[REMOTE_NETWORKID].size(), devices.size());
+
+    InputDeviceDelta stale = deltas.front();
+    stale.baseDigest = stale.digest + 1;
+    mgr.OnRemoteInputDevice(MakeDeltaNotice(REMOTE_NETWORKID, stale));
+    ASSERT_EQ(recorder->sent.size(), 1u);
+    EXPECT_EQ(recorder->sent[0].second.GetMsgId(), MessageId::DSOFTBUS_INPUT_DEV_PULL);
+    EXPECT_EQ(mgr.pendingPulls_.count(REMOTE_NETWORKID), 1u);
+    EXPECT_EQ(mgr.remoteInventories_[REMOTE_NETWORKID].GetSize(), devices.size());
+
+    digest.digest = mgr.localInventory_.GetDigest() + 1;
+    mgr.OnRemoteInputDevice(digest);
+    ASSERT_EQ(recorder->sent.size(), 2u);
+    NetPacket &repull = recorder->sent[1].second;
+    EXPECT_EQ(repull.GetMsgId(), MessageId::DSOFTBUS_INPUT_DEV_PULL);
+    uint64_t baseDigest { 0 };
+    InputDeviceEntries entries;
+    ASSERT_EQ(InputDeviceInventory::ReadEntries(repull, baseDigest, entries), RET_OK);
+    EXPECT_EQ(baseDigest, mgr.localInventory_.GetDigest());
+    EXPECT_EQ(entries.size(), devices.size());
+
+    env->dsoftbus_ = std::move(origin);
+}
+
+/**
+ * @tc.name: inputDevcieMgr_test015
+ * @tc.desc: Peers that never sent a digest get the old hot plug record and full list, peers that did get deltas.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(InputDeviceMgrTest, inputDevcieMgr_test015, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    auto env = TestContext::GetInstance();
+    auto bus = std::make_unique<RecordingDSoftbus>();
+    RecordingDSoftbus *recorder = bus.get();
+    std::unique_ptr<IDSoftbusAdapter> origin = std::move(env->dsoftbus_);
+    env->dsoftbus_ = std::move(bus);
+    auto &mgr = g_context->inputDevMgr_;
+    mgr.digestPeers_.clear();
+    mgr.openPeers_.clear();
+    mgr.openPeers_[REMOTE_NETWORKID] = false;
+    mgr.localInventory_.Reset({ CreateInputDevice(0, "keyboard") });
+
+    InputHotplugEvent unplug { .deviceId = 1, .type = InputHotplugType::UNPLUG, .isKeyboard = true };
+    mgr.BroadcastHotPlugToRemote({ unplug });
+    ASSERT_FALSE(recorder->sent.empty());
+    EXPECT_EQ(recorder->sent[0].first, REMOTE_NETWORKID);
+    EXPECT_EQ(recorder->sent[0].second.GetMsgId(), MessageId::DSOFTBUS_INPUT_DEV_HOT_PLUG);
+    for (auto &[networkId, packet] : recorder->sent) {
+        EXPECT_NE(packet.GetMsgId(), MessageId::DSOFTBUS_INPUT_DEV_DELTA);
+    }
+    recorder->sent.clear();
+
+    DSoftbusSyncInputDevice digest {
+        .networkId = REMOTE_NETWORKID,
+        .type = InputDevSyncType::DIGEST,
+        .digest = mgr.remoteInventories_[REMOTE_NETWORKID].GetDigest(),
+    };
+    mgr.OnRemoteInputDevice(digest);
+    EXPECT_EQ(mgr.digestPeers_.count(REMOTE_NETWORKID), 1u);
+    EXPECT_TRUE(mgr.openPeers_[REMOTE_NETWORKID]);
+    recorder->sent.clear();
+    mgr.localInventory_.Reset({ CreateInputDevice(0, "keyboard") });
+    mgr.BroadcastHotPlugToRemote({ unplug });
+    for (auto &[networkId, packet] : recorder->sent) {
+        EXPECT_EQ(packet.GetMsgId(), MessageId::DSOFTBUS_INPUT_DEV_DELTA);
+    }
+    recorder->sent.clear();
+
+    mgr.openPeers_[REMOTE_NETWORKID] = false;
+    DSoftbusSyncInputDevice full {
+        .networkId = REMOTE_NETWORKID,
+        .devices = { CreateInputDevice(0, "keyboard") },
+    };
+    mgr.OnRemoteInputDevice(full);
+    EXPECT_EQ(mgr.digestPeers_.count(REMOTE_NETWORKID), 0u);
+    ASSERT_EQ(recorder->sent.size(), 1u);
+    EXPECT_EQ(recorder->sent[0].second.GetMsgId(), MessageId::DSOFTBUS_INPUT_DEV_SYNC);
+
+    mgr.openPeers_.clear();
+    env->dsoftbus_ = std::move(origin);
+}
 } // namespace DeviceStatus
 } // namespace Msdp
 } // namespace OHOS
\ No newline at end of file
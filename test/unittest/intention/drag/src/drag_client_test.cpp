@@ -853,6 +853,134 @@ HWTEST_F(DragClientTest, DragClientTest36, TestSize.Level0)
         EXPECT_EQ(listeners[i]->callbackCount, 1);
     }
 }
+
+/**
+ * @tc.name: DragClientTest37
+ * @tc.desc: A drop bundle pushed to this process serves the getters without asking the server
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DragClientTest, DragClientTest37, TestSize.Level0)
+{
+    CALL_TEST_DEBUG;
+    DropBundle bundle;
+    bundle.targetPid = getpid();
+    bundle.fields = DROP_BUNDLE_UD_KEY | DROP_BUNDLE_SUMMARY | DROP_BUNDLE_EXTRA_INFO;
+    bundle.udKey = "udKey";
+    bundle.summarys = { { "general.text", 1 } };
+    bundle.extraInfo = "{\"drag_data_type\":\"text\"}";
+    NetPacket pkt(MessageId::DRAG_DROP_BUNDLE);
+    ASSERT_EQ(DropBundlePacker::Marshalling(bundle, pkt), RET_OK);
+    StreamClientTest client;
+    EXPECT_EQ(g_dragClient.OnDropBundle(client, pkt), RET_OK);
+
+    std::string udKey;
+    EXPECT_EQ(g_dragClient.GetUdKey(udKey), RET_OK);
+    EXPECT_EQ(udKey, bundle.udKey);
+    std::map<std::string, int64_t> summarys;
+    EXPECT_EQ(g_dragClient.GetDragSummary(summarys, false), RET_OK);
+    EXPECT_EQ(summarys, bundle.summarys);
+    std::string extraInfo;
+    EXPECT_EQ(g_dragClient.GetExtraInfo(extraInfo), RET_OK);
+    EXPECT_EQ(extraInfo, bundle.extraInfo);
+    DropBundle cached;
+    EXPECT_FALSE(g_dragClient.GetDropBundle(DROP_BUNDLE_BUNDLE_INFO, cached));
+    g_dragClient.ClearDropBundle();
+    EXPECT_FALSE(g_dragClient.GetDropBundle(DROP_BUNDLE_UD_KEY, cached));
+}
+
+/**
+ * @tc.name: DragClientTest38
+ * @tc.desc: Drop bundles for another process or of another version are ignored
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DragClientTest, DragClientTest38, TestSize.Level0)
+{
+    CALL_TEST_DEBUG;
+    DropBundle bundle;
+    bundle.targetPid = getpid() + 1;
+    bundle.fields = DROP_BUNDLE_UD_KEY;
+    bundle.udKey = "udKey";
+    NetPacket pkt(MessageId::DRAG_DROP_BUNDLE);
+    ASSERT_EQ(DropBundlePacker::Marshalling(bundle, pkt), RET_OK);
+    StreamClientTest client;
+    EXPECT_EQ(g_dragClient.OnDropBundle(client, pkt), RET_ERR);
+
+    NetPacket badPkt(MessageId::DRAG_DROP_BUNDLE);
+    badPkt << (DROP_BUNDLE_VERSION + 1) << getpid() << static_cast<uint32_t>(DROP_BUNDLE_UD_KEY);
+    EXPECT_EQ(g_dragClient.OnDropBundle(client, badPkt), RET_ERR);
+    DropBundle cached;
+    EXPECT_FALSE(g_dragClient.GetDropBundle(DROP_BUNDLE_UD_KEY, cached));
+}
+
+/**
+ * @tc.name: DragClientTest39
+ * @tc.desc: A cached drop bundle is dropped once the drag result or the stop drag end arrives
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DragClientTest, DragClientTest39, TestSize.Level0)
+{
+    CALL_TEST_DEBUG;
+    DropBundle bundle;
+    bundle.targetPid = getpid();
+    bundle.fields = DROP_BUNDLE_UD_KEY;
+    bundle.udKey = "udKey";
+    StreamClientTest client;
+    NetPacket pkt(MessageId::DRAG_DROP_BUNDLE);
+    ASSERT_EQ(DropBundlePacker::Marshalling(bundle, pkt), RET_OK);
+    EXPECT_EQ(g_dragClient.OnDropBundle(client, pkt), RET_OK);
+    NetPacket resultPkt(MessageId::DRAG_NOTIFY_RESULT);
+    resultPkt << 0 << 0 << static_cast<int32_t>(DragResult::DRAG_SUCCESS) << getpid() <<
+        static_cast<int32_t>(DragBehavior::COPY) << 0;
+    g_dragClient.OnNotifyResult(client, resultPkt);
+    DropBundle cached;
+    EXPECT_FALSE(g_dragClient.GetDropBundle(DROP_BUNDLE_UD_KEY, cached));
+
+    NetPacket bundlePkt(MessageId::DRAG_DROP_BUNDLE);
+    ASSERT_EQ(DropBundlePacker::Marshalling(bundle, bundlePkt), RET_OK);
+    EXPECT_EQ(g_dragClient.OnDropBundle(client, bundlePkt), RET_OK);
+    NetPacket stopPkt(MessageId::DRAG_STOP_DRAG_END);
+    g_dragClient.OnStopDragEnd(client, stopPkt);
+    EXPECT_FALSE(g_dragClient.GetDropBundle(DROP_BUNDLE_UD_KEY, cached));
+}
+
+/**
+ * @tc.name: DragClientTest40
+ * @tc.desc: A bundle with no fields from a later drag drops the cached one, and bundles of earlier drags are ignored
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DragClientTest, DragClientTest40, TestSize.Level0)
+{
+    CALL_TEST_DEBUG;
+    DropBundle bundle;
+    bundle.targetPid = getpid();
+    bundle.dragSeq = 1;
+    bundle.fields = DROP_BUNDLE_UD_KEY;
+    bundle.udKey = "udKey";
+    StreamClientTest client;
+    NetPacket pkt(MessageId::DRAG_DROP_BUNDLE);
+    ASSERT_EQ(DropBundlePacker::Marshalling(bundle, pkt), RET_OK);
+    EXPECT_EQ(g_dragClient.OnDropBundle(client, pkt), RET_OK);
+    DropBundle cached;
+    EXPECT_TRUE(g_dragClient.GetDropBundle(DROP_BUNDLE_UD_KEY, cached));
+
+    DropBundle invalidation;
+    invalidation.targetPid = getpid();
+    invalidation.dragSeq = 2;
+    NetPacket invalidationPkt(MessageId::DRAG_DROP_BUNDLE);
+    ASSERT_EQ(DropBundlePacker::Marshalling(invalidation, invalidationPkt), RET_OK);
+    EXPECT_EQ(g_dragClient.OnDropBundle(client, invalidationPkt), RET_OK);
+    EXPECT_FALSE(g_dragClient.GetDropBundle(DROP_BUNDLE_UD_KEY, cached));
+
+    NetPacket stalePkt(MessageId::DRAG_DROP_BUNDLE);
+    ASSERT_EQ(DropBundlePacker::Marshalling(bundle, stalePkt), RET_OK);
+    EXPECT_EQ(g_dragClient.OnDropBundle(client, stalePkt), RET_ERR);
+    EXPECT_FALSE(g_dragClient.GetDropBundle(DROP_BUNDLE_UD_KEY, cached));
+    g_dragClient.dropBundleSeq_ = 0;
+}
 } // namespace DeviceStatus
 } // namespace Msdp
 } // namespace OHOS
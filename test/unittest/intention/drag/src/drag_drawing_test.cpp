@@ -15,6 +15,7 @@
 #include "drag_drawing_test.h"
 
 #define BUFF_SIZE 100
+#include <cstdio>
 #include <future>
 #ifndef OHOS_BUILD_ENABLE_ARKUI_X
 #include "parameters.h"
@@ -25,6 +26,8 @@
 
 #include "devicestatus_define.h"
 #include "devicestatus_errors.h"
+#include "drag_style_params.h"
+#include "include/util.h"
 #include "interaction_manager.h"
 #include "stationary_data.h"
 
@@ -45,6 +48,8 @@ constexpr int32_t DISPLAY_Y { 50 };
 constexpr int32_t SHADOW_NUM_ONE { 1 };
 constexpr int32_t INT32_BYTE { 4 };
 constexpr int32_t POINTER_ID { 0 };
+// Mirrors MAX_STACKED_PIXELMAPS of drag_drawing.cpp.
+constexpr size_t MAX_STACKED_PIXELMAPS { 2 };
 int32_t g_shadowinfoX { 0 };
 int32_t g_shadowinfoY { 0 };
 constexpr bool HAS_CANCELED_ANIMATION { true };
@@ -1523,12 +1528,13 @@ HWTEST_F(DragDrawingTest, DragDrawingTest63, TestSize.Level0)
 HWTEST_F(DragDrawingTest, DragDrawingTest64, TestSize.Level0)
 {
     CALL_TEST_DEBUG;
-    JsonParser jsonParser("{\"dropArea\":\"2,2\"}");
+    DragExtraParams extraParams;
+    ASSERT_EQ(DragStyleParamsParser::ParseExtraInfo("{\"dropArea\":\"2,2\"}", extraParams), RET_OK);
     g_dragMgr.dragDrawing_.dragAnimationType_ = 0;
-    bool ret = g_dragMgr.dragDrawing_.ParseDropArea(jsonParser);
+    bool ret = g_dragMgr.dragDrawing_.ParseDropArea(extraParams);
     EXPECT_TRUE(ret);
     g_dragMgr.dragDrawing_.dragAnimationType_ = 1;
-    ret = g_dragMgr.dragDrawing_.ParseDropArea(jsonParser);
+    ret = g_dragMgr.dragDrawing_.ParseDropArea(extraParams);
     EXPECT_TRUE(!ret);
 }
 
@@ -1624,6 +1630,145 @@ HWTEST_F(DragDrawingTest, DragDrawingTest68, TestSize.Level0)
     g_dragMgr.dragDrawing_.CalculateRotation(100.0f, 100.0f, degreeX, degreeY);
     EXPECT_LE(degreeY, 25.0f);
 }
+
+/**
+* @tc.name: DragDrawingTest69
+* @tc.desc: Test ClearMultiSelectedData resets the selected stack reported by DumpSelectedStack
+* @tc.type: FUNC
+* @tc.require:
+*/
+HWTEST_F(DragDrawingTest, DragDrawingTest69, TestSize.Level0)
+{
+    CALL_TEST_DEBUG;
+    g_dragMgr.dragDrawing_.ClearMultiSelectedData();
+    g_dragMgr.dragDrawing_.FoldSelectedPixelMaps();
+    EXPECT_EQ(g_dragMgr.dragDrawing_.stackedLayerNum_.load(), 0U);
+    EXPECT_EQ(g_dragMgr.dragDrawing_.foldedSelectedNum_.load(), 0U);
+    EXPECT_EQ(g_dragMgr.dragDrawing_.shadowMemoryBytes_.load(), 0U);
+    FILE *file = tmpfile();
+    ASSERT_NE(file, nullptr);
+    g_dragMgr.dragDrawing_.DumpSelectedStack(fileno(file));
+    rewind(file);
+    char buf[512] = { 0 };
+    size_t size = fread(buf, 1, sizeof(buf) - 1, file);
+    fclose(file);
+    std::string dump(buf, size);
+    EXPECT_NE(dump.find("foldedItems:0"), std::string::npos);
+    EXPECT_NE(dump.find("shadowMemory:0KB"), std::string::npos);
+}
+
+/**
+* @tc.name: DragDrawingTest70
+* @tc.desc: Test AddSelectedPixelMap folds items beyond the stack and flushes once per frame
+* @tc.type: FUNC
+* @tc.require:
+*/
+HWTEST_F(DragDrawingTest, DragDrawingTest70, TestSize.Level0)
+{
+    CALL_TEST_DEBUG;
+    std::optional<DragData> dragData = CreateDragData(
+        MMI::PointerEvent::SOURCE_TYPE_MOUSE, POINTER_ID, 1, false, SHADOW_NUM_ONE);
+    ASSERT_TRUE(dragData);
+    int32_t ret = g_dragMgr.dragDrawing_.Init(dragData.value(), g_context);
+    ASSERT_EQ(ret, RET_OK);
+    g_dragMgr.dragDrawing_.StartVSyncSession();
+    auto frameCallback = std::make_shared<DragFrameCallback>([](uint64_t) {});
+    ret = g_dragMgr.dragDrawing_.vSyncStation_.RequestFrame(TYPE_PERFORM_ANIMATION, frameCallback);
+    ASSERT_EQ(ret, RET_OK);
+    auto handler = g_dragMgr.dragDrawing_.vSyncStation_.handler_;
+    ASSERT_NE(handler, nullptr);
+
+    constexpr size_t addedNum = MAX_STACKED_PIXELMAPS + 3;
+    uint32_t addedBefore = g_dragMgr.dragDrawing_.addedSelectedCount_.load();
+    uint32_t flushesBefore = g_dragMgr.dragDrawing_.selectedFlushCount_.load();
+    size_t succeeded = 0;
+    // Vsync callbacks run on this handler, so every addition below lands in the same frame.
+    bool posted = handler->PostSyncTask([this, &succeeded] {
+        for (size_t i = 0; i < addedNum; ++i) {
+            auto pixelMap = CreatePixelMap(PIXEL_MAP_WIDTH, PIXEL_MAP_HEIGHT);
+            if (g_dragMgr.dragDrawing_.AddSelectedPixelMap(pixelMap) == RET_OK) {
+                ++succeeded;
+            }
+        }
+    });
+    ASSERT_TRUE(posted);
+    ASSERT_EQ(succeeded, addedNum);
+    std::this_thread::sleep_for(std::chrono::milliseconds(TIME_WAIT_FOR_OP_MS));
+    EXPECT_EQ(g_dragMgr.dragDrawing_.addedSelectedCount_.load() - addedBefore, addedNum);
+    EXPECT_EQ(g_dragMgr.dragDrawing_.selectedFlushCount_.load() - flushesBefore, 1U);
+    EXPECT_EQ(g_dragMgr.dragDrawing_.stackedLayerNum_.load(), MAX_STACKED_PIXELMAPS + 1);
+    EXPECT_EQ(g_dragMgr.dragDrawing_.foldedSelectedNum_.load(), addedNum - MAX_STACKED_PIXELMAPS);
+
+    FILE *file = tmpfile();
+    ASSERT_NE(file, nullptr);
+    g_dragMgr.dragDrawing_.DumpSelectedStack(fileno(file));
+    rewind(file);
+    char buf[512] = { 0 };
+    size_t size = fread(buf, 1, sizeof(buf) - 1, file);
+    fclose(file);
+    std::string dump(buf, size);
+    EXPECT_NE(dump.find("dragNum:" + std::to_string(addedNum + 1)), std::string::npos);
+    g_dragMgr.dragDrawing_.StopVSyncStation();
+    g_dragMgr.dragDrawing_.ClearMultiSelectedData();
+}
+
+/**
+* @tc.name: DragDrawingTest71
+* @tc.desc: Test every shadow of drag start is kept, and an addition folds only the item it pushes below the stack
+* @tc.type: FUNC
+* @tc.require:
+*/
+HWTEST_F(DragDrawingTest, DragDrawingTest71, TestSize.Level0)
+{
+    CALL_TEST_DEBUG;
+    constexpr int32_t shadowNum = MAX_STACKED_PIXELMAPS + 3;
+    std::optional<DragData> dragData = CreateDragData(
+        MMI::PointerEvent::SOURCE_TYPE_MOUSE, POINTER_ID, 1, false, shadowNum);
+    ASSERT_TRUE(dragData);
+    int32_t ret = g_dragMgr.dragDrawing_.Init(dragData.value(), g_context);
+    ASSERT_EQ(ret, RET_OK);
+    EXPECT_EQ(g_dragMgr.dragDrawing_.stackedLayerNum_.load(), static_cast<size_t>(shadowNum));
+    EXPECT_EQ(g_dragMgr.dragDrawing_.foldedSelectedNum_.load(), 0U);
+
+    auto pixelMap = CreatePixelMap(PIXEL_MAP_WIDTH, PIXEL_MAP_HEIGHT);
+    ASSERT_EQ(g_dragMgr.dragDrawing_.AddSelectedPixelMap(pixelMap), RET_OK);
+    EXPECT_EQ(g_dragMgr.dragDrawing_.stackedLayerNum_.load(), static_cast<size_t>(shadowNum));
+    EXPECT_EQ(g_dragMgr.dragDrawing_.foldedSelectedNum_.load(), 1U);
+    g_dragMgr.dragDrawing_.ClearMultiSelectedData();
+}
+
+/**
+* @tc.name: DragDrawingTest72
+* @tc.desc: Test the warm-up fills the style icon cache on its own worker, leaving the drawing state alone
+* @tc.type: FUNC
+* @tc.require:
+*/
+HWTEST_F(DragDrawingTest, DragDrawingTest72, TestSize.Level0)
+{
+    CALL_TEST_DEBUG;
+    DragDrawing dragDrawing;
+    dragDrawing.WarmUp(true);
+    ASSERT_TRUE(dragDrawing.warmUpThread_.joinable());
+    dragDrawing.warmUpThread_.join();
+    EXPECT_GE(dragDrawing.warmUpCostUs_.load(), 0);
+    EXPECT_FALSE(dragDrawing.isRTL_);
+    std::string filePath = DragDrawing::GetStyleIconPath(DragCursorStyle::MOVE, true);
+    if (!IsValidSvgFile(filePath)) {
+        return;
+    }
+    std::shared_ptr<Media::PixelMap> cachedIcon { nullptr };
+    size_t cachedNum = 0;
+    {
+        std::lock_guard<std::mutex> guard(dragDrawing.styleIconMutex_);
+        auto iter = dragDrawing.styleIconCache_.find(filePath);
+        ASSERT_NE(iter, dragDrawing.styleIconCache_.end());
+        cachedIcon = iter->second;
+        cachedNum = dragDrawing.styleIconCache_.size();
+    }
+    EXPECT_EQ(dragDrawing.GetStyleIcon(filePath, dragDrawing.styleIconScaling_), cachedIcon);
+    std::lock_guard<std::mutex> guard(dragDrawing.styleIconMutex_);
+    EXPECT_EQ(dragDrawing.styleIconCache_.size(), cachedNum);
+}
 } // namespace DeviceStatus
 } // namespace Msdp
 } // namespace OHOS
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "drag_frame_recorder_test.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <unistd.h>
+
+#include "drag_frame_recorder.h"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+using namespace testing::ext;
+namespace {
+constexpr uint64_t VSYNC_PERIOD_NS { 16666667 };
+constexpr uint64_t ONE_MS_IN_NS { 1000000 };
+constexpr size_t FRAMES_PER_DRAG { 100 };
+constexpr size_t FRAMES_OF_LAST_DRAG { 500 };
+
+std::string ReadAll(int32_t fd)
+{
+    std::string content;
+    char buf[256] {};
+    lseek(fd, 0, SEEK_SET);
+    for (ssize_t n = read(fd, buf, sizeof(buf)); n > 0; n = read(fd, buf, sizeof(buf))) {
+        content.append(buf, static_cast<size_t>(n));
+    }
+    return content;
+}
+} // namespace
+
+/**
+ * @tc.name: DragFrameRecorderTest001
+ * @tc.desc: Verify missed vsyncs, late frames and input starvation are flagged on the frames they happen,
+ *           and a drag held still is not reported as starved.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DragFrameRecorderTest, DragFrameRecorderTest001, TestSize.Level0)
+{
+    DragFrameRecorder recorder;
+    DragMoveEvent sample { .displayX = 1.0f, .displayY = 2.0f, .displayId = 0 };
+    recorder.RecordFrame(VSYNC_PERIOD_NS, VSYNC_PERIOD_NS, sample, VSYNC_PERIOD_NS);
+    EXPECT_TRUE(recorder.GetFrames().empty());
+
+    recorder.BeginDrag();
+    uint64_t vsync = DragFrameRecorder::Now() + VSYNC_PERIOD_NS;
+    recorder.RecordInput(vsync - ONE_MS_IN_NS);
+    recorder.RecordRequest();
+    recorder.RecordFrame(vsync, VSYNC_PERIOD_NS, sample, vsync + ONE_MS_IN_NS);
+    recorder.RecordFrame(vsync + 3 * VSYNC_PERIOD_NS, VSYNC_PERIOD_NS, sample,
+        vsync + 5 * VSYNC_PERIOD_NS);
+    recorder.RecordRequest();
+    recorder.RecordFrame(DragFrameRecorder::Now() + 3 * VSYNC_PERIOD_NS, VSYNC_PERIOD_NS, sample,
+        DragFrameRecorder::Now() + 3 * VSYNC_PERIOD_NS);
+    recorder.EndDrag();
+
+    auto frames = recorder.GetFrames();
+    ASSERT_EQ(frames.size(), 3);
+    EXPECT_EQ(frames[0].flags, 0);
+    EXPECT_EQ(frames[0].displayX, 1.0f);
+    EXPECT_EQ(frames[0].flushTime - frames[0].inputTime, 2 * ONE_MS_IN_NS);
+    EXPECT_EQ(frames[1].flags, DRAG_FRAME_LATE | DRAG_FRAME_INPUT_STARVED);
+    EXPECT_NE(frames[2].flags & DRAG_FRAME_MISSED_VSYNC, 0);
+    EXPECT_EQ(frames[2].flags & DRAG_FRAME_INPUT_STARVED, 0);
+}
+
+/**
+ * @tc.name: DragFrameRecorderTest002
+ * @tc.desc: Verify the ring keeps the latest frames across drags, and the dumps cover the latest drags.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DragFrameRecorderTest, DragFrameRecorderTest002, TestSize.Level0)
+{
+    DragFrameRecorder recorder;
+    uint64_t vsync = VSYNC_PERIOD_NS;
+    for (size_t drag = 0; drag < DragFrameRecorder::MAX_DUMPED_DRAGS + 1; ++drag) {
+        recorder.BeginDrag();
+        for (size_t frame = 0; frame < FRAMES_PER_DRAG; ++frame) {
+            vsync += VSYNC_PERIOD_NS;
+            recorder.RecordInput(vsync - ONE_MS_IN_NS);
+            recorder.RecordFrame(vsync, VSYNC_PERIOD_NS, DragMoveEvent { .timestamp = vsync }, vsync + ONE_MS_IN_NS);
+        }
+        recorder.EndDrag();
+    }
+    recorder.BeginDrag();
+    for (size_t frame = 0; frame < FRAMES_OF_LAST_DRAG; ++frame) {
+        vsync += VSYNC_PERIOD_NS;
+        recorder.RecordFrame(vsync, VSYNC_PERIOD_NS, DragMoveEvent { .timestamp = vsync }, vsync + ONE_MS_IN_NS);
+    }
+    auto frames = recorder.GetFrames();
+    ASSERT_EQ(frames.size(), DragFrameRecorder::FRAME_CAPACITY);
+    EXPECT_EQ(frames.back().vsyncTime, vsync);
+    EXPECT_EQ(frames.back().dragId - frames.front().dragId, DragFrameRecorder::MAX_DUMPED_DRAGS + 1);
+
+    FILE *file = tmpfile();
+    ASSERT_NE(file, nullptr);
+    int32_t fd = fileno(file);
+    recorder.Dump(fd);
+    std::string summary = ReadAll(fd);
+    EXPECT_NE(summary.find("(current) | frames:500"), std::string::npos);
+    size_t nDrags = 0;
+    for (size_t pos = summary.find("drag:"); pos != std::string::npos; pos = summary.find("drag:", pos + 1)) {
+        ++nDrags;
+    }
+    EXPECT_EQ(nDrags, DragFrameRecorder::MAX_DUMPED_DRAGS);
+    EXPECT_NE(summary.find("vsync-to-flush p50/p90/p99:1.00/1.00/1.00ms"), std::string::npos);
+    ASSERT_EQ(ftruncate(fd, 0), 0);
+    recorder.DumpRaw(fd);
+    std::string raw = ReadAll(fd);
+    EXPECT_EQ(std::count(raw.begin(), raw.end(), '\n'), DragFrameRecorder::FRAME_CAPACITY + 1);
+    fclose(file);
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
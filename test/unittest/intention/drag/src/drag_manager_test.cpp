@@ -16,6 +16,7 @@
 
 #define BUFF_SIZE 100
 #include <future>
+#include <vector>
 #ifndef OHOS_BUILD_ENABLE_ARKUI_X
 #include "parameters.h"
 #endif // OHOS_BUILD_ENABLE_ARKUI_X
@@ -3108,6 +3109,115 @@ HWTEST_F(DragManagerTest, DragManagerTest138, TestSize.Level0)
     ret = g_dragMgr.StopDrag(dropResult);
     ASSERT_EQ(ret, RET_OK);
 }
+
+#ifdef OHOS_DRAG_ENABLE_MONITOR
+/**
+ * @tc.name: DragManagerTest139
+ * @tc.desc: Test pointer events passed to the monitor are counted as observed and not as reinjected
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DragManagerTest, DragManagerTest139, TestSize.Level0)
+{
+    CALL_TEST_DEBUG;
+    std::vector<std::shared_ptr<MMI::PointerEvent>> seen;
+    DragManager::PointerEventStats stats;
+    DragManager::MonitorConsumer monitor([&seen](std::shared_ptr<MMI::PointerEvent> pointerEvent) {
+        seen.push_back(pointerEvent);
+    }, nullptr, stats);
+    auto pointerEvent = MMI::PointerEvent::Create();
+    ASSERT_NE(pointerEvent, nullptr);
+    pointerEvent->SetSourceType(MMI::PointerEvent::SOURCE_TYPE_MOUSE);
+    pointerEvent->SetPointerAction(MMI::PointerEvent::POINTER_ACTION_MOVE);
+    monitor.OnInputEvent(pointerEvent);
+    monitor.OnInputEvent(std::shared_ptr<MMI::PointerEvent>(nullptr));
+    ASSERT_EQ(seen.size(), 1U);
+    EXPECT_EQ(stats.observed.load(), 1U);
+    EXPECT_EQ(stats.reinjected.load(), 0U);
+}
+#endif // OHOS_DRAG_ENABLE_MONITOR
+
+/**
+ * @tc.name: DragManagerTest140
+ * @tc.desc: Test pointer events handled by the drag outside the monitor path are not counted as observed
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DragManagerTest, DragManagerTest140, TestSize.Level0)
+{
+    CALL_TEST_DEBUG;
+    auto pointerEvent = MMI::PointerEvent::Create();
+    ASSERT_NE(pointerEvent, nullptr);
+    pointerEvent->SetSourceType(MMI::PointerEvent::SOURCE_TYPE_MOUSE);
+    pointerEvent->SetPointerAction(MMI::PointerEvent::POINTER_ACTION_MOVE);
+    uint64_t observed = g_dragMgr.pointerEventStats_.observed.load();
+    uint64_t reinjected = g_dragMgr.pointerEventStats_.reinjected.load();
+    g_dragMgr.DragCallback(pointerEvent);
+    g_dragMgr.DragCallback(nullptr);
+    EXPECT_EQ(g_dragMgr.pointerEventStats_.observed.load(), observed);
+    EXPECT_EQ(g_dragMgr.pointerEventStats_.reinjected.load(), reinjected);
+}
+
+/**
+ * @tc.name: DragManagerTest141
+ * @tc.desc: Test the interceptor re-injects every pull move unchanged and in order, without merging them
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DragManagerTest, DragManagerTest141, TestSize.Level0)
+{
+    CALL_TEST_DEBUG;
+    std::vector<std::shared_ptr<MMI::PointerEvent>> seen;
+    std::vector<std::shared_ptr<MMI::PointerEvent>> injected;
+    DragManager::PointerEventStats stats;
+    DragManager::InterceptorConsumer interceptor([&seen](std::shared_ptr<MMI::PointerEvent> pointerEvent) {
+        seen.push_back(pointerEvent);
+    }, stats, [&injected](std::shared_ptr<MMI::PointerEvent> pointerEvent) {
+        injected.push_back(pointerEvent);
+    });
+    std::vector<std::shared_ptr<MMI::PointerEvent>> sent;
+    constexpr int32_t pullMoveCount { 3 };
+    for (int32_t i = 0; i < pullMoveCount; ++i) {
+        auto pointerEvent = MMI::PointerEvent::Create();
+        ASSERT_NE(pointerEvent, nullptr);
+        pointerEvent->SetSourceType(MMI::PointerEvent::SOURCE_TYPE_TOUCHSCREEN);
+        pointerEvent->SetPointerAction(MMI::PointerEvent::POINTER_ACTION_PULL_MOVE);
+        pointerEvent->SetPointerId(POINTER_ID);
+        interceptor.OnInputEvent(pointerEvent);
+        sent.push_back(pointerEvent);
+    }
+    interceptor.OnInputEvent(std::shared_ptr<MMI::PointerEvent>(nullptr));
+    ASSERT_EQ(seen, sent);
+    ASSERT_EQ(injected, sent);
+    EXPECT_EQ(stats.reinjected.load(), sent.size());
+    EXPECT_EQ(stats.observed.load(), 0U);
+    for (const auto &pointerEvent : sent) {
+        EXPECT_TRUE(pointerEvent->HasFlag(MMI::InputEvent::EVENT_FLAG_NO_INTERCEPT));
+        EXPECT_EQ(pointerEvent->GetPointerAction(), MMI::PointerEvent::POINTER_ACTION_PULL_MOVE);
+    }
+}
+
+/**
+ * @tc.name: DragManagerTest142
+ * @tc.desc: Test a failed StartDrag ends the vsync session it opened, so no frame is served afterwards
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DragManagerTest, DragManagerTest142, TestSize.Level0)
+{
+    CALL_TEST_DEBUG;
+    std::optional<DragData> dragData = CreateDragData(
+        MMI::PointerEvent::SOURCE_TYPE_UNKNOWN, POINTER_ID, DRAG_NUM_ONE, false, SHADOW_NUM_ONE);
+    ASSERT_TRUE(dragData);
+    g_dragMgr.dragState_ = DragState::STOP;
+    int32_t ret = g_dragMgr.StartDrag(dragData.value(), -1, std::string(), false);
+    EXPECT_EQ(ret, RET_ERR);
+    EXPECT_FALSE(g_dragMgr.dragDrawing_.vSyncStation_.sessionActive_);
+    auto frameCallback = std::make_shared<DragFrameCallback>([](uint64_t) {});
+    ret = g_dragMgr.dragDrawing_.vSyncStation_.RequestFrame(TYPE_FLUSH_DRAG_POSITION, frameCallback);
+    EXPECT_EQ(ret, RET_ERR);
+    g_dragMgr.dragState_ = DragState::STOP;
+}
 } // namespace DeviceStatus
 } // namespace Msdp
 } // namespace OHOS
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "drag_move_path_benchmark_test.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <new>
+
+#include "drag_smooth_processor.h"
+
+// Allocations are counted in this binary alone, and only on the thread inside an AllocationScope.
+namespace {
+thread_local bool g_countAllocations { false };
+thread_local uint64_t g_allocations { 0 };
+
+class AllocationScope {
+public:
+    AllocationScope()
+    {
+        g_allocations = 0;
+        g_countAllocations = true;
+    }
+    ~AllocationScope()
+    {
+        g_countAllocations = false;
+    }
+    uint64_t Count() const
+    {
+        return g_allocations;
+    }
+};
+} // namespace
+
+void *operator new(size_t size)
+{
+    if (g_countAllocations) {
+        ++g_allocations;
+    }
+    void *ptr = std::malloc(size == 0 ? 1 : size);
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void operator delete(void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept
+{
+    std::free(ptr);
+}
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+using namespace testing::ext;
+namespace {
+constexpr uint64_t VSYNC_PERIOD_NS { 16666667 };
+constexpr uint64_t MOVE_INTERVAL_NS { 4000000 };
+constexpr size_t MOVES_PER_FRAME { 4 };
+constexpr size_t BENCHMARK_FRAMES { 5000 };
+} // namespace
+
+/**
+ * @tc.name: DragMovePathBenchmark
+ * @tc.desc: Measure ns/event and allocations/event of the move path from input insertion to vsync flush.
+ * @tc.type: PERF
+ * @tc.require:
+ */
+HWTEST_F(DragMovePathBenchmarkTest, DragMovePathBenchmark, TestSize.Level1)
+{
+    DragSmoothProcessor processor;
+    uint64_t timestamp = VSYNC_PERIOD_NS;
+    uint64_t allocations = 0;
+    std::chrono::nanoseconds elapsed {};
+    {
+        AllocationScope scope;
+        auto begin = std::chrono::steady_clock::now();
+        for (size_t frame = 0; frame < BENCHMARK_FRAMES; ++frame) {
+            for (size_t n = 0; n < MOVES_PER_FRAME; ++n) {
+                timestamp += MOVE_INTERVAL_NS;
+                processor.InsertEvent(DragMoveEvent { .displayX = static_cast<float>(frame),
+                    .displayY = static_cast<float>(n), .displayId = 0, .timestamp = timestamp });
+            }
+            processor.SmoothMoveEvent(timestamp + VSYNC_PERIOD_NS, VSYNC_PERIOD_NS);
+        }
+        elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin);
+        allocations = scope.Count();
+    }
+    double nEvents = static_cast<double>(BENCHMARK_FRAMES * MOVES_PER_FRAME);
+    GTEST_LOG_(INFO) << "Drag move path: " << (elapsed.count() / nEvents) << " ns/event, "
+        << (allocations / nEvents) << " allocations/event";
+    EXPECT_EQ(allocations, 0);
+    EXPECT_EQ(processor.GetDroppedCount(), 0);
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "drag_shadow_cache_test.h"
+
+#include <vector>
+
+#include "devicestatus_define.h"
+#include "drag_data.h"
+#include "drag_shadow_cache.h"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+using namespace testing::ext;
+namespace {
+constexpr int32_t PIXEL_MAP_WIDTH { 200 };
+constexpr int32_t PIXEL_MAP_HEIGHT { 200 };
+constexpr uint32_t FIRST_COLOR { 0xFF00FF00 };
+constexpr uint32_t SECOND_COLOR { 0xFFFF0000 };
+constexpr int32_t SHADOW_X { -50 };
+constexpr int32_t SHADOW_Y { -50 };
+} // namespace
+
+std::shared_ptr<Media::PixelMap> DragShadowCacheTest::CreatePixelMap(uint32_t color)
+{
+    Media::InitializationOptions opts;
+    opts.size.width = PIXEL_MAP_WIDTH;
+    opts.size.height = PIXEL_MAP_HEIGHT;
+    opts.pixelFormat = Media::PixelFormat::BGRA_8888;
+    opts.alphaType = Media::AlphaType::IMAGE_ALPHA_TYPE_OPAQUE;
+    opts.allocatorType = Media::AllocatorType::HEAP_ALLOC;
+    std::vector<uint32_t> colors(PIXEL_MAP_WIDTH * PIXEL_MAP_HEIGHT, color);
+    std::unique_ptr<Media::PixelMap> pixelMap =
+        Media::PixelMap::Create(colors.data(), static_cast<uint32_t>(colors.size()), opts);
+    return std::shared_ptr<Media::PixelMap>(std::move(pixelMap));
+}
+
+/**
+ * @tc.name: DragShadowCacheTest_IsShowing_001
+ * @tc.desc: A shadow with the same content and offset as the one on screen is a hit.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DragShadowCacheTest, DragShadowCacheTest_IsShowing_001, TestSize.Level1)
+{
+    DragShadowCache cache;
+    auto first = CreatePixelMap(FIRST_COLOR);
+    ASSERT_NE(first, nullptr);
+    ShadowInfo shadowInfo { first, SHADOW_X, SHADOW_Y };
+    EXPECT_FALSE(cache.IsShowing(shadowInfo));
+    cache.SetShowing(shadowInfo);
+    EXPECT_TRUE(cache.IsShowing(shadowInfo));
+
+    auto same = CreatePixelMap(FIRST_COLOR);
+    ASSERT_NE(same, nullptr);
+    EXPECT_TRUE(cache.IsShowing({ same, SHADOW_X, SHADOW_Y }));
+    EXPECT_EQ(cache.GetHitCount(), 2U);
+}
+
+/**
+ * @tc.name: DragShadowCacheTest_IsShowing_002
+ * @tc.desc: Different content or offset is a miss, and nothing matches once the cache is cleared.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DragShadowCacheTest, DragShadowCacheTest_IsShowing_002, TestSize.Level1)
+{
+    DragShadowCache cache;
+    auto first = CreatePixelMap(FIRST_COLOR);
+    ASSERT_NE(first, nullptr);
+    cache.SetShowing({ first, SHADOW_X, SHADOW_Y });
+    auto changed = CreatePixelMap(SECOND_COLOR);
+    ASSERT_NE(changed, nullptr);
+    EXPECT_FALSE(cache.IsShowing({ changed, SHADOW_X, SHADOW_Y }));
+    EXPECT_FALSE(cache.IsShowing({ first, SHADOW_X + 1, SHADOW_Y }));
+    EXPECT_FALSE(cache.IsShowing({ nullptr, SHADOW_X, SHADOW_Y }));
+    EXPECT_EQ(cache.GetHitCount(), 0U);
+
+    cache.Clear();
+    EXPECT_FALSE(cache.IsShowing({ first, SHADOW_X, SHADOW_Y }));
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
@@ -15,12 +15,116 @@
 
 #include "drag_smooth_processor_test.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <functional>
+#include <thread>
+#include <vector>
+
 #include "drag_smooth_processor.h"
 
 namespace OHOS {
 namespace Msdp {
 namespace DeviceStatus {
 using namespace testing::ext;
+namespace {
+constexpr uint64_t VSYNC_PERIOD_NS { 16666667 };
+constexpr uint64_t MOVE_INTERVAL_NS { 4000000 };
+constexpr size_t MOVES_PER_FRAME { 4 };
+constexpr uint64_t CONCURRENT_INSERTS { 10000 };
+constexpr uint64_t ONE_MS_IN_NS { 1000000 };
+constexpr uint64_t INPUT_INTERVAL_NS { 4166667 };
+constexpr uint64_t INPUT_DELAY_NS { 4 * ONE_MS_IN_NS };
+constexpr double NOISE_AMPLITUDE { 1.0 };
+constexpr double FLICK_SPEED { 4000.0 };
+constexpr double ACCELERATE_S { 0.05 };
+constexpr double CRUISE_S { 0.15 };
+constexpr double DECELERATE_S { 0.03 };
+constexpr double FLICK_STOP_S { ACCELERATE_S + CRUISE_S + DECELERATE_S };
+constexpr double TRACE_S { 0.5 };
+constexpr double SWEEP_AMPLITUDE { 200.0 };
+constexpr double SWEEP_HZ { 1.0 };
+constexpr double NANOS_PER_SECOND { 1.0e9 };
+constexpr double MAX_OVERSHOOT { 40.0 };
+constexpr double MAX_SWEEP_LAG { 40.0 };
+
+struct ReplayReport {
+    double meanLag { 0.0 };
+    double overshoot { 0.0 };
+};
+
+// Finger position in px along x at @t seconds: speeds up to FLICK_SPEED, cruises, stops hard and rests.
+double FlickTrace(double t)
+{
+    const double acceleration = FLICK_SPEED / ACCELERATE_S;
+    const double deceleration = FLICK_SPEED / DECELERATE_S;
+    double x = 0.0;
+    double phase = std::min(t, ACCELERATE_S);
+    x += acceleration * phase * phase / 2.0;
+    phase = std::clamp(t - ACCELERATE_S, 0.0, CRUISE_S);
+    x += FLICK_SPEED * phase;
+    phase = std::clamp(t - ACCELERATE_S - CRUISE_S, 0.0, DECELERATE_S);
+    x += FLICK_SPEED * phase - deceleration * phase * phase / 2.0;
+    return x;
+}
+
+double SweepTrace(double t)
+{
+    return SWEEP_AMPLITUDE * std::sin(2.0 * M_PI * SWEEP_HZ * t);
+}
+
+// Deterministic sensor noise in [-NOISE_AMPLITUDE, NOISE_AMPLITUDE].
+double Noise(uint32_t &seed)
+{
+    seed = seed * 1664525U + 1013904223U;
+    return ((static_cast<double>(seed >> 8) / static_cast<double>(1U << 24)) * 2.0 - 1.0) * NOISE_AMPLITUDE;
+}
+
+// Replays @trace sampled at 240Hz, each sample delivered INPUT_DELAY_NS late, into a processor flushed
+// at 60Hz. Lag is the mean distance from the finger at the vsync until @stopTime. Overshoot is how far
+// the shadow travels past the final position of the finger after that.
+ReplayReport ReplayTrace(const DragSmoothConfig &config, const std::function<double(double)> &trace,
+    double stopTime)
+{
+    DragSmoothProcessor processor(config);
+    ReplayReport report;
+    const uint64_t traceEnd = static_cast<uint64_t>(TRACE_S * NANOS_PER_SECOND);
+    const double finalX = trace(TRACE_S);
+    uint32_t seed = 1;
+    uint64_t nextInput = 0;
+    size_t nFrames = 0;
+    double totalLag = 0.0;
+    for (uint64_t vsync = VSYNC_PERIOD_NS; vsync <= traceEnd; vsync += VSYNC_PERIOD_NS) {
+        for (; nextInput + INPUT_DELAY_NS <= vsync; nextInput += INPUT_INTERVAL_NS) {
+            double t = static_cast<double>(nextInput) / NANOS_PER_SECOND;
+            processor.InsertEvent(DragMoveEvent { .displayX = static_cast<float>(trace(t) + Noise(seed)),
+                .displayY = 0.0f, .displayId = 0, .timestamp = nextInput });
+        }
+        DragMoveEvent event = processor.SmoothMoveEvent(vsync, VSYNC_PERIOD_NS);
+        double t = static_cast<double>(vsync) / NANOS_PER_SECOND;
+        if (t <= stopTime) {
+            totalLag += std::fabs(trace(t) - event.displayX);
+            ++nFrames;
+        } else {
+            report.overshoot = std::max(report.overshoot, event.displayX - finalX);
+        }
+    }
+    report.meanLag = (nFrames > 0) ? (totalLag / nFrames) : 0.0;
+    return report;
+}
+
+ReplayReport ReplayTrace(DragSmoothFilterType filterType, const std::function<double(double)> &trace,
+    double stopTime, const char *name)
+{
+    DragSmoothConfig config;
+    config.filterType = filterType;
+    ReplayReport report = ReplayTrace(config, trace, stopTime);
+    GTEST_LOG_(INFO) << name << " filter " << static_cast<int32_t>(filterType) << ": lag " << report.meanLag
+        << " px, overshoot " << report.overshoot << " px";
+    return report;
+}
+} // namespace
 
 /**
  * @tc.name: SmoothMoveEventBothEmpty
@@ -247,6 +351,122 @@ HWTEST_F(DragSmoothProcessorTest, GetInterpolatedEvent7, TestSize.Level0)
     EXPECT_EQ(result->timestamp, 50000000);
     EXPECT_EQ(result->displayId, 1);
 }
+/**
+ * @tc.name: SmoothMoveEventRingOverflow
+ * @tc.desc: Verify samples are dropped rather than queued without bound when the vsync thread falls behind,
+ *           and that ResetParameters discards the samples inserted so far.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DragSmoothProcessorTest, SmoothMoveEventRingOverflow, TestSize.Level0)
+{
+    DragSmoothProcessor processor;
+    for (size_t i = 0; i <= DragSmoothProcessor::RING_CAPACITY; ++i) {
+        processor.InsertEvent(DragMoveEvent { .displayX = 1.0f, .displayId = 0, .timestamp = (i + 1) * 1000 });
+    }
+    EXPECT_EQ(processor.GetDroppedCount(), 1);
+    processor.SmoothMoveEvent(VSYNC_PERIOD_NS, VSYNC_PERIOD_NS);
+    processor.InsertEvent(DragMoveEvent { .displayX = 1.0f, .displayId = 0, .timestamp = 500000 });
+    processor.ResetParameters();
+    DragMoveEvent event { .displayX = 2.0f, .displayId = 1, .timestamp = 1000000 };
+    processor.InsertEvent(event);
+    DragMoveEvent result = processor.SmoothMoveEvent(event.timestamp + VSYNC_PERIOD_NS, VSYNC_PERIOD_NS);
+    EXPECT_EQ(result.displayId, 1);
+    EXPECT_EQ(result.displayX, 2.0f);
+}
+
+/**
+ * @tc.name: SmoothMoveEventConcurrentProducers
+ * @tc.desc: Verify samples inserted from two threads while the vsync thread drains are neither lost nor torn.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DragSmoothProcessorTest, SmoothMoveEventConcurrentProducers, TestSize.Level1)
+{
+    DragSmoothProcessor processor;
+    std::atomic_bool done { false };
+    std::atomic<uint64_t> drained { 0 };
+    std::atomic<uint64_t> torn { 0 };
+    std::thread consumer([&processor, &done, &drained, &torn] {
+        auto drain = [&processor, &drained, &torn] {
+            processor.DrainEvents();
+            for (const auto &event : processor.CurrentEvents()) {
+                if (static_cast<uint64_t>(event.displayX) != event.timestamp) {
+                    torn.fetch_add(1);
+                }
+            }
+            drained.fetch_add(processor.CurrentEvents().size());
+        };
+        while (!done.load()) {
+            drain();
+        }
+        drain();
+    });
+    auto produce = [&processor](int32_t displayId) {
+        for (uint64_t i = 1; i <= CONCURRENT_INSERTS; ++i) {
+            processor.InsertEvent(DragMoveEvent { .displayX = static_cast<float>(i), .displayY = 0.0f,
+                .displayId = displayId, .timestamp = i });
+        }
+    };
+    std::thread first(produce, 0);
+    std::thread second(produce, 1);
+    first.join();
+    second.join();
+    done = true;
+    consumer.join();
+    EXPECT_EQ(torn.load(), 0);
+    EXPECT_EQ(drained.load() + processor.GetDroppedCount(), 2 * CONCURRENT_INSERTS);
+}
+
+/**
+ * @tc.name: SmoothFilterTraceReplay
+ * @tc.desc: Replay a fast flick and a slow sweep through every filter and report lag and overshoot.
+ *           Predictive filters must follow the flick more closely than averaging without running away.
+ * @tc.type: PERF
+ * @tc.require:
+ */
+HWTEST_F(DragSmoothProcessorTest, SmoothFilterTraceReplay, TestSize.Level1)
+{
+    ReplayReport average = ReplayTrace(DragSmoothFilterType::AVERAGE, FlickTrace, FLICK_STOP_S, "Flick");
+    ReplayReport oneEuro = ReplayTrace(DragSmoothFilterType::ONE_EURO, FlickTrace, FLICK_STOP_S, "Flick");
+    ReplayReport kalman = ReplayTrace(DragSmoothFilterType::KALMAN, FlickTrace, FLICK_STOP_S, "Flick");
+    EXPECT_LT(oneEuro.meanLag, average.meanLag);
+    EXPECT_LT(kalman.meanLag, average.meanLag);
+    EXPECT_LT(oneEuro.overshoot, MAX_OVERSHOOT);
+    EXPECT_LT(kalman.overshoot, MAX_OVERSHOOT);
+    for (auto filterType : { DragSmoothFilterType::AVERAGE, DragSmoothFilterType::ONE_EURO,
+        DragSmoothFilterType::KALMAN }) {
+        ReplayReport sweep = ReplayTrace(filterType, SweepTrace, TRACE_S, "Sweep");
+        EXPECT_LT(sweep.meanLag, MAX_SWEEP_LAG);
+    }
+}
+
+/**
+ * @tc.name: SmoothFilterLookAheadCap
+ * @tc.desc: Verify look-ahead follows the measured input-to-present latency and stops at maxPrediction.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DragSmoothProcessorTest, SmoothFilterLookAheadCap, TestSize.Level0)
+{
+    DragSmoothConfig config;
+    config.filterType = DragSmoothFilterType::KALMAN;
+    config.maxPrediction = 2 * ONE_MS_IN_NS;
+    DragSmoothProcessor processor(config);
+    uint64_t timestamp = 0;
+    for (size_t frame = 0; frame < MOVES_PER_FRAME; ++frame) {
+        timestamp += MOVE_INTERVAL_NS;
+        processor.InsertEvent(DragMoveEvent { .displayX = 1.0f, .displayId = 0, .timestamp = timestamp });
+        DragMoveEvent event = processor.SmoothMoveEvent(timestamp + 5 * ONE_MS_IN_NS, VSYNC_PERIOD_NS);
+        EXPECT_EQ(event.timestamp, timestamp + config.maxPrediction);
+        EXPECT_EQ(event.displayId, 0);
+    }
+    EXPECT_EQ(processor.GetPresentLatency(), 5 * ONE_MS_IN_NS);
+    processor.ResetParameters();
+    DragMoveEvent event = processor.SmoothMoveEvent(timestamp + VSYNC_PERIOD_NS, VSYNC_PERIOD_NS);
+    EXPECT_EQ(event.displayId, -1);
+    EXPECT_EQ(processor.GetPresentLatency(), 0);
+}
 } // namespace DeviceStatus
 } // namespace Msdp
 } // namespace OHOS
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "pull_throw_settings_test.h"
+
+#include <map>
+#include <string>
+
+#include "devicestatus_define.h"
+#include "pull_throw_settings.h"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+using namespace testing::ext;
+namespace {
+const std::string SETTING_VK_KEY { "virtualKeyBoardType" };
+const std::string SETTING_MISSING_KEY { "missing" };
+constexpr int32_t READ_ROUNDS { 100 };
+
+// Stands in for settings data, counting the queries that reach it.
+class FakeSettingsBackend {
+public:
+    PullThrowSettings::QueryFunc GetQueryFunc()
+    {
+        return [this](const std::string &key, std::string &value) {
+            ++queries_;
+            auto iter = values_.find(key);
+            if (iter == values_.end()) {
+                return RET_ERR;
+            }
+            value = iter->second;
+            return RET_OK;
+        };
+    }
+
+    void Put(const std::string &key, const std::string &value)
+    {
+        values_[key] = value;
+    }
+
+    int32_t GetQueries() const
+    {
+        return queries_;
+    }
+
+private:
+    std::map<std::string, std::string> values_;
+    int32_t queries_ { 0 };
+};
+} // namespace
+
+/**
+ * @tc.name: PullThrowSettingsTest001
+ * @tc.desc: Verify a setting is queried from its source once, and then read from memory.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(PullThrowSettingsTest, PullThrowSettingsTest001, TestSize.Level0)
+{
+    FakeSettingsBackend backend;
+    backend.Put(SETTING_VK_KEY, "0");
+    PullThrowSettings settings(backend.GetQueryFunc());
+    for (int32_t i = 0; i < READ_ROUNDS; ++i) {
+        int32_t value = -1;
+        ASSERT_EQ(settings.GetIntValue(SETTING_VK_KEY, value), RET_OK);
+        EXPECT_EQ(value, 0);
+    }
+    EXPECT_EQ(backend.GetQueries(), 1);
+    EXPECT_EQ(settings.GetQueryCount(), 1U);
+
+    int64_t valueLong = -1;
+    ASSERT_EQ(settings.GetLongValue(SETTING_VK_KEY, valueLong), RET_OK);
+    EXPECT_EQ(valueLong, 0);
+    EXPECT_EQ(backend.GetQueries(), 1);
+}
+
+/**
+ * @tc.name: PullThrowSettingsTest002
+ * @tc.desc: Verify an invalidated setting is queried again and picks up the new value.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(PullThrowSettingsTest, PullThrowSettingsTest002, TestSize.Level0)
+{
+    FakeSettingsBackend backend;
+    backend.Put(SETTING_VK_KEY, "0");
+    PullThrowSettings settings(backend.GetQueryFunc());
+    int32_t value = -1;
+    ASSERT_EQ(settings.GetIntValue(SETTING_VK_KEY, value), RET_OK);
+    EXPECT_EQ(value, 0);
+
+    backend.Put(SETTING_VK_KEY, "1");
+    ASSERT_EQ(settings.GetIntValue(SETTING_VK_KEY, value), RET_OK);
+    EXPECT_EQ(value, 0);
+    settings.Invalidate(SETTING_VK_KEY);
+    ASSERT_EQ(settings.GetIntValue(SETTING_VK_KEY, value), RET_OK);
+    EXPECT_EQ(value, 1);
+    EXPECT_EQ(backend.GetQueries(), 2);
+
+    settings.Clear();
+    ASSERT_EQ(settings.GetIntValue(SETTING_VK_KEY, value), RET_OK);
+    EXPECT_EQ(backend.GetQueries(), 3);
+}
+
+/**
+ * @tc.name: PullThrowSettingsTest003
+ * @tc.desc: Verify failed queries are not cached, and settings without a source fail.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(PullThrowSettingsTest, PullThrowSettingsTest003, TestSize.Level0)
+{
+    FakeSettingsBackend backend;
+    PullThrowSettings settings(backend.GetQueryFunc());
+    std::string value;
+    EXPECT_EQ(settings.GetStringValue(SETTING_MISSING_KEY, value), RET_ERR);
+    EXPECT_EQ(settings.GetStringValue(SETTING_MISSING_KEY, value), RET_ERR);
+    EXPECT_EQ(backend.GetQueries(), 2);
+
+    backend.Put(SETTING_MISSING_KEY, "ready");
+    ASSERT_EQ(settings.GetStringValue(SETTING_MISSING_KEY, value), RET_OK);
+    EXPECT_EQ(value, "ready");
+
+    PullThrowSettings noSource(nullptr);
+    EXPECT_EQ(noSource.GetStringValue(SETTING_VK_KEY, value), RET_ERR);
+}
+
+/**
+ * @tc.name: PullThrowSettingsTest004
+ * @tc.desc: Verify queries run without the lock held, and a value invalidated while being queried is not kept.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(PullThrowSettingsTest, PullThrowSettingsTest004, TestSize.Level0)
+{
+    int32_t queries = 0;
+    PullThrowSettings *self = nullptr;
+    PullThrowSettings settings([&queries, &self](const std::string &key, std::string &value) {
+        if ((++queries == 1) && (self != nullptr)) {
+            self->Invalidate(key);
+        }
+        value = "1";
+        return RET_OK;
+    });
+    self = &settings;
+    int32_t value = -1;
+    ASSERT_EQ(settings.GetIntValue(SETTING_VK_KEY, value), RET_OK);
+    EXPECT_EQ(value, 1);
+    ASSERT_EQ(settings.GetIntValue(SETTING_VK_KEY, value), RET_OK);
+    ASSERT_EQ(settings.GetIntValue(SETTING_VK_KEY, value), RET_OK);
+    EXPECT_EQ(queries, 2);
+    EXPECT_EQ(settings.GetQueryCount(), 2U);
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
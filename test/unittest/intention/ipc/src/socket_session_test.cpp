@@ -15,8 +15,11 @@
 
 #include "socket_session_test.h"
 
+#include <sys/socket.h>
+
 #include "ipc_skeleton.h"
 #include "message_parcel.h"
+#include "securec.h"
 
 #include "devicestatus_define.h"
 #include "i_context.h"
@@ -41,6 +44,9 @@ IContext *g_context { nullptr };
 Intention g_intention { Intention::UNKNOWN_INTENTION };
 constexpr int32_t TIME_WAIT_FOR_OP_MS { 20 };
 constexpr uint64_t DOMAIN_ID { 0xD002220 };
+constexpr int32_t SMALL_BUFFER_SIZE { 4096 };
+constexpr int32_t MESSAGE_COUNT { 2000 };
+constexpr int32_t MAX_SEND_TIME_MS { 1000 };
 } // namespace
 
 void SocketSessionTest::SetUpTestCase() {}
@@ -398,6 +404,83 @@ HWTEST_F(SocketSessionTest, SocketSessionTest34, TestSize.Level0)
     g_client->Stop();
     g_client->OnDisconnected();
 }
+
+/**
+ * @tc.name: SocketSessionTest35
+ * @tc.desc: Producers never block on a client that stops reading, queued messages follow their send policy
+ *           and are drained in order once the client reads again
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(SocketSessionTest, SocketSessionTest35, TestSize.Level0)
+{
+    CALL_TEST_DEBUG;
+    int32_t sockFds[2] { -1, -1 };
+    ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, sockFds), 0);
+    int32_t bufSize = SMALL_BUFFER_SIZE;
+    ::setsockopt(sockFds[0], SOL_SOCKET, SO_SNDBUF, &bufSize, sizeof(bufSize));
+    ::setsockopt(sockFds[1], SOL_SOCKET, SO_RCVBUF, &bufSize, sizeof(bufSize));
+    fdsan_exchange_owner_tag(sockFds[0], 0, DOMAIN_ID);
+    auto session = std::make_shared<SocketSession>("test", 1, TokenType::TOKEN_HAP, sockFds[0],
+        IPCSkeleton::GetCallingUid(), IPCSkeleton::GetCallingPid());
+    int32_t nWatched = 0;
+    session->SetWritableWatcher([&nWatched] { ++nWatched; });
+
+    auto begin = std::chrono::steady_clock::now();
+    int32_t nAccepted = 0;
+    for (int32_t index = 0; index < MESSAGE_COUNT; ++index) {
+        NetPacket pkt(MessageId::COORDINATION_MESSAGE);
+        pkt << index;
+        nAccepted += (session->SendMsg(pkt) ? 1 : 0);
+        NetPacket hotArea(MessageId::HOT_AREA_ADD_LISTENER);
+        hotArea << index;
+        EXPECT_TRUE(session->SendMsg(hotArea));
+    }
+    EXPECT_LT(std::chrono::steady_clock::now() - begin, std::chrono::milliseconds(MAX_SEND_TIME_MS));
+    EXPECT_EQ(nAccepted, MESSAGE_COUNT);
+    EXPECT_EQ(nWatched, 1);
+    EXPECT_TRUE(session->GetEvents() & EPOLLOUT);
+    SocketSessionStats stats = session->GetStats();
+    EXPECT_GT(stats.depth, 0u);
+    EXPECT_GT(stats.coalesced, 0u);
+    const char buf[] { "backpressure" };
+    EXPECT_EQ(session->TrySendMsg(buf, sizeof(buf)), SEND_BACKPRESSURE);
+
+    std::string received;
+    char rbuf[SMALL_BUFFER_SIZE] {};
+    for (bool drained = false; !drained;) {
+        drained = session->Flush();
+        ssize_t count = 0;
+        while ((count = ::recv(sockFds[1], rbuf, sizeof(rbuf), MSG_DONTWAIT)) > 0) {
+            received.append(rbuf, count);
+        }
+    }
+    int32_t nHotArea = 0;
+    int32_t lastSeq = -1;
+    size_t pos = 0;
+    while (pos + sizeof(PackHead) <= received.size()) {
+        PackHead head {};
+        ASSERT_EQ(memcpy_s(&head, sizeof(head), received.data() + pos, sizeof(head)), EOK);
+        pos += sizeof(head);
+        int32_t seq = -1;
+        ASSERT_EQ(memcpy_s(&seq, sizeof(seq), received.data() + pos, sizeof(seq)), EOK);
+        pos += static_cast<size_t>(head.size);
+        if (head.idMsg == MessageId::COORDINATION_MESSAGE) {
+            EXPECT_EQ(seq, lastSeq + 1);
+            lastSeq = seq;
+        } else {
+            ++nHotArea;
+        }
+    }
+    EXPECT_EQ(pos, received.size());
+    EXPECT_EQ(lastSeq, MESSAGE_COUNT - 1);
+    EXPECT_LT(nHotArea, MESSAGE_COUNT);
+    EXPECT_EQ(session->GetStats().depth, 0u);
+    EXPECT_FALSE(session->GetEvents() & EPOLLOUT);
+    if (fdsan_close_with_tag(sockFds[1], 0) != 0) {
+        FI_HILOGE("close(%{public}d) failed:%{public}s", sockFds[1], ::strerror(errno));
+    }
+}
 } // namespace DeviceStatus
 } // namespace Msdp
 } // namespace OHOS
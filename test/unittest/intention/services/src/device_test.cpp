@@ -16,6 +16,7 @@
 #include <gtest/gtest.h>
 
 #include "device.h"
+#include "device_capability_cache.h"
 #include "device_manager.h"
 #include "devicestatus_define.h"
 #include "fi_log.h"
@@ -41,6 +42,7 @@ constexpr int32_t NUM_SIXTY_FOUR { 64 };
 constexpr int32_t NUM_HUNDRED_TWENTY_EIGHT { 128 };
 constexpr int32_t NUM_THIRTY_TWO { 32 };
 constexpr int32_t NUM_TWO { 2 };
+const std::string CAPABILITY_CACHE_PATH { "/data/test/device_capability.cache" };
 int32_t deviceId_ = devmg_.ParseDeviceId(devNode_);
 
 class DeviceTest : public testing::Test {
@@ -376,6 +378,90 @@ HWTEST_F(DeviceTest, JudgeKeyboardTypeTest006, TestSize.Level0)
     dev.keyBitmask_[INDEX_TWENTY_THREE] = NUM_SIXTY_FOUR;
     ASSERT_NO_FATAL_FAILURE(dev.JudgeKeyboardType());
 }
+
+/**
+ * @tc.name: CapabilityCacheTest001
+ * @tc.desc: Test persistence of device capability cache
+ * @tc.type: FUNC
+ */
+HWTEST_F(DeviceTest, CapabilityCacheTest001, TestSize.Level0)
+{
+    CALL_TEST_DEBUG;
+    DeviceCapabilityKey key {
+        .bus = BUS_USB,
+        .vendor = NUM_SIXTY_FOUR,
+        .product = NUM_THIRTY_TWO,
+        .version = NUM_ONE,
+        .name = "Test Keyboard",
+        .phys = "usb-0000:00:14.0-1/input0",
+    };
+    DeviceCapability capability {
+        .caps = (1ULL << IDevice::DEVICE_CAP_KEYBOARD),
+        .keyboardType = IDevice::KEYBOARD_TYPE_ALPHABETICKEYBOARD,
+    };
+    capability.evBitmask[0] = NUM_TWO;
+    capability.keyBitmask[INDEX_TWO] = NUM_HUNDRED_TWENTY_EIGHT;
+    {
+        DeviceCapabilityCache cache(CAPABILITY_CACHE_PATH);
+        cache.Store(key, capability);
+        DeviceCapabilityKey other = key;
+        other.name = "Bad\tName";
+        cache.Store(other, capability);
+        EXPECT_EQ(cache.GetSize(), 1u);
+        ASSERT_EQ(cache.Save(), RET_OK);
+    }
+    DeviceCapabilityCache cache(CAPABILITY_CACHE_PATH);
+    ASSERT_EQ(cache.Load(), RET_OK);
+    DeviceCapability restored;
+    ASSERT_TRUE(cache.Find(key, restored));
+    EXPECT_EQ(restored.caps, capability.caps);
+    EXPECT_EQ(restored.keyboardType, capability.keyboardType);
+    EXPECT_EQ(restored.evBitmask, capability.evBitmask);
+    EXPECT_EQ(restored.keyBitmask, capability.keyBitmask);
+    key.configMtime = NUM_ONE;
+    EXPECT_FALSE(cache.Find(key, restored));
+    EXPECT_EQ(cache.GetStats().hits, 1u);
+    EXPECT_EQ(cache.GetStats().misses, 1u);
+    unlink(CAPABILITY_CACHE_PATH.c_str());
+}
+
+/**
+ * @tc.name: CapabilityCacheTest002
+ * @tc.desc: Test device reopened with capability cache skips the capability queries
+ * @tc.type: FUNC
+ */
+HWTEST_F(DeviceTest, CapabilityCacheTest002, TestSize.Level0)
+{
+    CALL_TEST_DEBUG;
+    DeviceCapabilityCache cache(CAPABILITY_CACHE_PATH);
+    Device first(deviceId_);
+    first.SetDevPath(devPath_);
+    first.SetCapabilityCache(&cache);
+    ASSERT_EQ(first.Open(), RET_OK);
+    EXPECT_EQ(cache.GetStats().misses, 1u);
+    EXPECT_EQ(cache.GetSize(), 1u);
+
+    Device second(deviceId_);
+    second.SetDevPath(devPath_);
+    second.SetCapabilityCache(&cache);
+    ASSERT_EQ(second.Open(), RET_OK);
+    EXPECT_EQ(cache.GetStats().hits, 1u);
+    EXPECT_EQ(second.caps_, first.caps_);
+    EXPECT_EQ(second.GetKeyboardType(), first.GetKeyboardType());
+    EXPECT_EQ(memcmp(second.keyBitmask_, first.keyBitmask_, sizeof(first.keyBitmask_)), 0);
+
+    DeviceCapabilityKey key = first.MakeCapabilityKey();
+    DeviceCapability capability;
+    ASSERT_TRUE(cache.Find(key, capability));
+    capability.evBitmask[0] ^= NUM_ONE;
+    cache.Store(key, capability);
+    Device third(deviceId_);
+    third.SetDevPath(devPath_);
+    third.SetCapabilityCache(&cache);
+    ASSERT_EQ(third.Open(), RET_OK);
+    EXPECT_EQ(cache.GetStats().invalidated, 1u);
+    EXPECT_EQ(third.caps_, first.caps_);
+}
 } // namespace DeviceStatus
 } // namespace Msdp
 } // namespace OHOS
\ No newline at end of file
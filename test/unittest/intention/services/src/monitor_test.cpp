@@ -16,6 +16,8 @@
 #include <vector>
 #include <memory>
 
+#include <fcntl.h>
+#include <poll.h>
 #include <unistd.h>
 
 #include "device_manager.h"
@@ -35,6 +37,8 @@ using namespace testing::ext;
 namespace {
 constexpr int32_t TIME_WAIT_FOR_OP_MS { 20 };
 const std::string TEST_DEV_NODE {"TestDeviceNode"};
+constexpr int32_t SETTLE_TIMEOUT_MS { 1000 };
+constexpr int32_t MAX_DISPATCH_TIMES { 16 };
 } // namespace
 
 class MonitorTest : public testing::Test {
@@ -71,6 +75,81 @@ private:
     DeviceManager devMgr_;
 };
 
+class BatchRecorder : public IDeviceMgr {
+public:
+    struct Batch {
+        std::vector<std::string> added;
+        std::vector<std::string> removed;
+    };
+
+    void AddDevice(const std::string &devNode) override
+    {
+        batches_.push_back(Batch { .added = { devNode } });
+    }
+    void RemoveDevice(const std::string &devNode) override
+    {
+        batches_.push_back(Batch { .removed = { devNode } });
+    }
+    void ApplyChanges(const std::vector<std::string> &added, const std::vector<std::string> &removed) override
+    {
+        batches_.push_back(Batch { .added = added, .removed = removed });
+    }
+
+    std::vector<Batch> batches_;
+};
+
+class FakeInputDir {
+public:
+    FakeInputDir()
+    {
+        char dirTemplate[] { "/data/local/tmp/monitor_test_XXXXXX" };
+        if (mkdtemp(dirTemplate) != nullptr) {
+            path_ = std::string(dirTemplate) + "/";
+        }
+    }
+    ~FakeInputDir()
+    {
+        if (path_.empty()) {
+            return;
+        }
+        for (const auto &devNode : nodes_) {
+            unlink((path_ + devNode).c_str());
+        }
+        rmdir(path_.c_str());
+    }
+
+    const std::string &GetPath() const
+    {
+        return path_;
+    }
+    void Create(const std::string &devNode)
+    {
+        int32_t fd = open((path_ + devNode).c_str(), O_CREAT | O_WRONLY | O_CLOEXEC, S_IRUSR | S_IWUSR);
+        if (fd >= 0) {
+            close(fd);
+        }
+        nodes_.push_back(devNode);
+    }
+    void Remove(const std::string &devNode)
+    {
+        unlink((path_ + devNode).c_str());
+    }
+
+private:
+    std::string path_;
+    std::vector<std::string> nodes_;
+};
+
+void DrainEvents(Monitor &monitor)
+{
+    struct epoll_event ev {};
+    ev.events = EPOLLIN;
+    struct pollfd pfd { .fd = monitor.GetFd(), .events = POLLIN };
+    for (int32_t n = 0; (n < MAX_DISPATCH_TIMES) && (poll(&pfd, 1, 0) > 0); ++n) {
+        monitor.Dispatch(ev);
+    }
+}
+
 /**
  * @tc.name: MonitorTest01
  * @tc.desc: test Dispatch event
@@ -201,6 +280,74 @@ HWTEST_F(MonitorTest, MonitorTest08, TestSize.Level1)
     event->mask = IN_DELETE;
     ASSERT_NO_FATAL_FAILURE(monitor.HandleInotifyEvent(event));
 }
+/**
+ * @tc.name: MonitorTest09
+ * @tc.desc: test that hot-plug events are coalesced and transient nodes dropped
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(MonitorTest, MonitorTest09, TestSize.Level1)
+{
+    FakeInputDir inputDir;
+    ASSERT_FALSE(inputDir.GetPath().empty());
+    BatchRecorder recorder;
+    Monitor monitor;
+    monitor.SetDeviceMgr(&recorder);
+    monitor.SetWatchPath(inputDir.GetPath());
+    ASSERT_EQ(monitor.Enable(), RET_OK);
+
+    inputDir.Create("event1");
+    inputDir.Create("event2");
+    inputDir.Remove("event2");
+    DrainEvents(monitor);
+    EXPECT_TRUE(recorder.batches_.empty());
+    monitor.Flush();
+    ASSERT_EQ(recorder.batches_.size(), 1);
+    EXPECT_EQ(recorder.batches_[0].added, std::vector<std::string> { "event1" });
+    EXPECT_TRUE(recorder.batches_[0].removed.empty());
+
+    inputDir.Remove("event1");
+    inputDir.Create("event1");
+    DrainEvents(monitor);
+    monitor.Flush();
+    ASSERT_EQ(recorder.batches_.size(), 2);
+    EXPECT_EQ(recorder.batches_[1].added, std::vector<std::string> { "event1" });
+    EXPECT_EQ(recorder.batches_[1].removed, std::vector<std::string> { "event1" });
+    monitor.Disable();
+}
+
+/**
+ * @tc.name: MonitorTest10
+ * @tc.desc: test that pending hot-plug events are handed over when the settle timer expires
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(MonitorTest, MonitorTest10, TestSize.Level1)
+{
+    FakeInputDir inputDir;
+    ASSERT_FALSE(inputDir.GetPath().empty());
+    BatchRecorder recorder;
+    Monitor monitor;
+    monitor.SetDeviceMgr(&recorder);
+    monitor.SetWatchPath(inputDir.GetPath());
+    ASSERT_EQ(monitor.Enable(), RET_OK);
+    auto settleTimer = monitor.GetSettleTimer();
+    ASSERT_NE(settleTimer, nullptr);
+    ASSERT_GE(settleTimer->GetFd(), 0);
+
+    inputDir.Create("event3");
+    inputDir.Create("event4");
+    DrainEvents(monitor);
+    EXPECT_TRUE(recorder.batches_.empty());
+    struct pollfd pfd { .fd = settleTimer->GetFd(), .events = POLLIN };
+    ASSERT_EQ(poll(&pfd, 1, SETTLE_TIMEOUT_MS), 1);
+    struct epoll_event ev {};
+    ev.events = EPOLLIN;
+    settleTimer->Dispatch(ev);
+    ASSERT_EQ(recorder.batches_.size(), 1);
+    EXPECT_EQ(recorder.batches_[0].added, (std::vector<std::string> { "event3", "event4" }));
+    monitor.Disable();
+}
 } // namespace DeviceStatus
 } // namespace Msdp
 } // namespace OHOS
\ No newline at end of file
@@ -563,6 +563,104 @@ HWTEST_F(DeviceStatusMsdpMocKTest, DeviceStatusMsdpMocKTest030, TestSize.Level1)
     deviceStatusMsdpMock.callbacks_.clear();
     EXPECT_TRUE(deviceStatusMsdpMock.alive_);
 }
+
+/**
+ * @tc.name: DeviceStatusMsdpMocKTest031
+ * @tc.desc: test mock data is parsed once into the typed table
+ * @tc.type: FUNC
+ */
+HWTEST_F(DeviceStatusMsdpMocKTest, DeviceStatusMsdpMocKTest031, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    DeviceStatusDataParse dataParse;
+    std::string fileData = R"({"still": [1, 2], "relativeStill": ["x"]})";
+    EXPECT_TRUE(dataParse.LoadDeviceStatusData(fileData));
+    dataParse.dirty_ = false;
+    dataParse.DisableCount(Type::TYPE_STILL);
+    Data data;
+    EXPECT_TRUE(dataParse.ParseDeviceStatusData(Type::TYPE_STILL, data));
+    EXPECT_EQ(data.value, OnChangedValue::VALUE_ENTER);
+    EXPECT_TRUE(dataParse.ParseDeviceStatusData(Type::TYPE_STILL, data));
+    EXPECT_EQ(data.value, OnChangedValue::VALUE_EXIT);
+    EXPECT_TRUE(dataParse.ParseDeviceStatusData(Type::TYPE_STILL, data));
+    EXPECT_EQ(data.value, OnChangedValue::VALUE_ENTER);
+    EXPECT_FALSE(dataParse.ParseDeviceStatusData(Type::TYPE_RELATIVE_STILL, data));
+    EXPECT_FALSE(dataParse.ParseDeviceStatusData(Type::TYPE_CAR_BLUETOOTH, data));
+    EXPECT_EQ(data.value, OnChangedValue::VALUE_INVALID);
+    dataParse.InvalidateData();
+    EXPECT_TRUE(dataParse.dirty_);
+}
+
+/**
+ * @tc.name: DeviceStatusMsdpMocKTest032
+ * @tc.desc: test scripted timeline parsing of mock data
+ * @tc.type: FUNC
+ */
+HWTEST_F(DeviceStatusMsdpMocKTest, DeviceStatusMsdpMocKTest032, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    DeviceStatusDataParse dataParse;
+    std::string fileData = R"({"timeline": {"loop": true, "events": [
+        {"time": 0, "type": 3, "value": 1},
+        {"time": 20, "type": 3, "value": 2},
+        {"time": 10, "type": 3, "value": 1},
+        {"time": 30, "type": 100, "value": 1},
+        {"time": 40, "type": 4}]}})";
+    EXPECT_TRUE(dataParse.LoadDeviceStatusData(fileData));
+    dataParse.dirty_ = false;
+    EXPECT_TRUE(dataParse.HasTimeline());
+    EXPECT_TRUE(dataParse.IsTimelineLoop());
+    auto timeline = dataParse.GetTimeline();
+    ASSERT_EQ(timeline.size(), 2u);
+    EXPECT_EQ(timeline[1].timeMs, 20);
+    EXPECT_EQ(timeline[1].type, Type::TYPE_STILL);
+    EXPECT_EQ(timeline[1].value, OnChangedValue::VALUE_EXIT);
+}
+
+/**
+ * @tc.name: DeviceStatusMsdpMocKTest033
+ * @tc.desc: test a looped timeline with all events at time 0 does not restart at once
+ * @tc.type: FUNC
+ */
+HWTEST_F(DeviceStatusMsdpMocKTest, DeviceStatusMsdpMocKTest033, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    DeviceStatusMsdpMock deviceStatusMsdpMock;
+    deviceStatusMsdpMock.timeline_ = { MockTimelineEvent { .timeMs = 0, .type = Type::TYPE_STILL,
+        .value = OnChangedValue::VALUE_ENTER } };
+    deviceStatusMsdpMock.timelineLoop_ = true;
+    deviceStatusMsdpMock.timelineIndex_ = deviceStatusMsdpMock.timeline_.size();
+    deviceStatusMsdpMock.timelineStart_ = std::chrono::steady_clock::now();
+    deviceStatusMsdpMock.EmitTimeline();
+    EXPECT_EQ(deviceStatusMsdpMock.timelineIndex_, 1u);
+    EXPECT_EQ(deviceStatusMsdpMock.timeline_.size(), 1u);
+
+    constexpr int64_t elapsedMs = 200;
+    deviceStatusMsdpMock.timelineStart_ = std::chrono::steady_clock::now() - std::chrono::milliseconds(elapsedMs);
+    deviceStatusMsdpMock.EmitTimeline();
+    EXPECT_EQ(deviceStatusMsdpMock.timelineIndex_, 0u);
+}
+
+/**
+ * @tc.name: DeviceStatusMsdpMocKTest034
+ * @tc.desc: test initializing inotify again replaces the previous fd instead of leaking it
+ * @tc.type: FUNC
+ */
+HWTEST_F(DeviceStatusMsdpMocKTest, DeviceStatusMsdpMocKTest034, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    DeviceStatusMsdpMock deviceStatusMsdpMock;
+    deviceStatusMsdpMock.InitInotify();
+    deviceStatusMsdpMock.InitInotify();
+    if (deviceStatusMsdpMock.inotifyFd_ >= 0) {
+        EXPECT_EQ(deviceStatusMsdpMock.callbacks_.size(), 1u);
+        EXPECT_EQ(deviceStatusMsdpMock.callbacks_.count(deviceStatusMsdpMock.inotifyFd_), 1u);
+    } else {
+        EXPECT_TRUE(deviceStatusMsdpMock.callbacks_.empty());
+    }
+    deviceStatusMsdpMock.CloseInotify();
+    EXPECT_TRUE(deviceStatusMsdpMock.callbacks_.empty());
+}
 } // namespace DeviceStatus
 } // namespace Msdp
 } // namespace OHOS
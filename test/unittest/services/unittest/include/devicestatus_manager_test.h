@@ -16,6 +16,10 @@
 #ifndef DEVICESTATUS_MANAGER_TEST_H
 #define DEVICESTATUS_MANAGER_TEST_H
 
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
 #include <gtest/gtest.h>
 
 #include "boomerang_callback_stub.h"
@@ -46,6 +50,19 @@ public:
         virtual ~StationaryModuleTestCallback() {};
         void OnDeviceStatusChanged(const Data &value) override;
     };
+    class BlockingStationaryTestCallback : public DeviceStatusCallbackStub {
+    public:
+        BlockingStationaryTestCallback() {};
+        virtual ~BlockingStationaryTestCallback() {};
+        void OnDeviceStatusChanged(const Data &value) override;
+        void Release();
+        bool WaitCalled(int32_t count);
+        std::atomic<int32_t> calledCount_ { 0 };
+    private:
+        std::mutex mutex_;
+        std::condition_variable cv_;
+        bool released_ { false };
+    };
     static inline sptr<IRemoteBoomerangCallback> boomerangCallback_ = nullptr;
     static inline sptr<IRemoteDevStaCallback> stationaryCallback_ = nullptr;
 };
@@ -52,6 +52,8 @@ namespace {
     const int32_t SYSTEM_BAR_HIDDEN = 0;
     const int32_t COMMON_PARAMETER_ERROR = 401;
 #endif
+    constexpr int32_t NOTIFY_TIMES { 100 };
+    constexpr int32_t WAIT_DELIVERY_TIMEOUT_MS { 5000 };
 } // namespace
 
 void DeviceStatusManagerTest::SetUpTestCase()
@@ -97,6 +99,30 @@ void DeviceStatusManagerTest::StationaryModuleTestCallback::OnDeviceStatusChange
         devicestatusData.value <= OnChangedValue::VALUE_EXIT) << "StationaryModuleTestCallback failed";
 }
 
+void DeviceStatusManagerTest::BlockingStationaryTestCallback::OnDeviceStatusChanged(const Data& devicestatusData)
+{
+    std::unique_lock lock(mutex_);
+    calledCount_++;
+    cv_.notify_all();
+    cv_.wait(lock, [this] { return released_; });
+}
+
+void DeviceStatusManagerTest::BlockingStationaryTestCallback::Release()
+{
+    {
+        std::lock_guard lock(mutex_);
+        released_ = true;
+    }
+    cv_.notify_all();
+}
+
+bool DeviceStatusManagerTest::BlockingStationaryTestCallback::WaitCalled(int32_t count)
+{
+    std::unique_lock lock(mutex_);
+    return cv_.wait_for(lock, std::chrono::milliseconds(WAIT_DELIVERY_TIMEOUT_MS),
+        [this, count] { return calledCount_.load() >= count; });
+}
+
 namespace {
 /**
  * @tc.name: HandlerPageScrollerEventTest
@@ -549,6 +575,41 @@ HWTEST_F(DeviceStatusManagerTest, GetLatestDeviceStatusDataTest, TestSize.Level0
     EXPECT_EQ(data.value, OnChangedValue::VALUE_INVALID);
     GTEST_LOG_(INFO) << "GetLatestDeviceStatusDataTest end";
 }
+
+/**
+ * @tc.name: NotifyWithBlockingListenerTest
+ * @tc.desc: test a blocking listener does not stall the other DeviceStatusManager APIs
+ * @tc.type: FUNC
+ */
+HWTEST_F(DeviceStatusManagerTest, NotifyWithBlockingListenerTest, TestSize.Level1) {
+    GTEST_LOG_(INFO) << "NotifyWithBlockingListenerTest start";
+    auto manager = std::make_shared<DeviceStatusManager>();
+    sptr<BlockingStationaryTestCallback> blockingCallback = new (std::nothrow) BlockingStationaryTestCallback();
+    ASSERT_NE(blockingCallback, nullptr);
+    manager->Subscribe(Type::TYPE_VERTICAL_POSITION, ActivityEvent::ENTER_EXIT, ReportLatencyNs::LONG,
+        blockingCallback);
+    Data data = { Type::TYPE_VERTICAL_POSITION, OnChangedValue::VALUE_ENTER };
+    EXPECT_EQ(manager->NotifyDeviceStatusChange(data), RET_OK);
+    ASSERT_TRUE(blockingCallback->WaitCalled(1));
+
+    // The listener stays blocked in its callback until released, so reaching the checks below
+    // means none of these calls waited for it.
+    for (int32_t i = 0; i < NOTIFY_TIMES; ++i) {
+        data.value = ((i % 2) == 0) ? OnChangedValue::VALUE_EXIT : OnChangedValue::VALUE_ENTER;
+        EXPECT_EQ(manager->NotifyDeviceStatusChange(data), RET_OK);
+    }
+    Data latest = manager->GetLatestDeviceStatusData(Type::TYPE_VERTICAL_POSITION);
+    EXPECT_EQ(latest.value, OnChangedValue::VALUE_INVALID);
+    EXPECT_EQ(manager->Subscribe(BOOMERANG_TYPE_BOOMERANG, "com.boomerang.test", boomerangCallback_), RET_OK);
+    EXPECT_EQ(manager->Unsubscribe(BOOMERANG_TYPE_BOOMERANG, "com.boomerang.test", boomerangCallback_), RET_OK);
+    EXPECT_EQ(blockingCallback->calledCount_.load(), 1);
+    EXPECT_EQ(manager->notifier_.GetDroppedCount(), static_cast<size_t>(NOTIFY_TIMES - 1));
+
+    blockingCallback->Release();
+    EXPECT_TRUE(blockingCallback->WaitCalled(2));
+    manager->Unsubscribe(Type::TYPE_VERTICAL_POSITION, ActivityEvent::ENTER_EXIT, blockingCallback);
+    GTEST_LOG_(INFO) << "NotifyWithBlockingListenerTest end";
+}
 } // namespace
 } // namespace DeviceStatus
 } // namespace Msdp
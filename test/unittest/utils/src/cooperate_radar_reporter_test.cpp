@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "cooperate_radar_reporter.h"
+#include "devicestatus_define.h"
+#include "util.h"
+
+#undef LOG_TAG
+#define LOG_TAG "CooperateRadarReporterTest"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+using namespace testing::ext;
+namespace {
+constexpr int32_t SAMPLE_NUM { 1000 };
+constexpr int32_t SPIKE_PERIOD { 100 };
+constexpr int64_t NORMAL_LATENCY { 2 };
+constexpr int64_t SPIKE_LATENCY { 40 };
+constexpr int32_t BURST_NUM { 100 };
+const std::string LOCAL_NETWORK_ID { "local1234567890network" };
+const std::string PEER_NETWORK_ID { "peer1234567890network" };
+
+class CountingRadarSink final : public IRadarSink {
+public:
+    void OnCooperateRadarInfo(CooperateRadarInfo &radarInfo) override
+    {
+        ++cooperateNum;
+    }
+
+    void OnTransmissionLatencySummary(TransmissionLatencySummary &summary) override
+    {
+        ++summaryNum;
+        lastSummary = summary;
+    }
+
+    int32_t cooperateNum { 0 };
+    int32_t summaryNum { 0 };
+    TransmissionLatencySummary lastSummary;
+};
+} // namespace
+
+class CooperateRadarReporterTest : public testing::Test {
+public:
+    void SetUp();
+    void TearDown();
+    static void SetUpTestCase();
+    static void TearDownTestCase(void);
+
+    std::shared_ptr<CountingRadarSink> sink_;
+};
+
+void CooperateRadarReporterTest::SetUpTestCase() {}
+
+void CooperateRadarReporterTest::TearDownTestCase() {}
+
+void CooperateRadarReporterTest::SetUp()
+{
+    // Flush anything left by a previous case before counting.
+    CooperateRadarReporter::GetInstance().SetSink(nullptr);
+    CooperateRadarReporter::GetInstance().Flush();
+    sink_ = std::make_shared<CountingRadarSink>();
+    CooperateRadarReporter::GetInstance().SetSink(sink_);
+}
+
+void CooperateRadarReporterTest::TearDown()
+{
+    CooperateRadarReporter::GetInstance().SetSink(nullptr);
+}
+
+/**
+ * @tc.name: CooperateRadarReporterTest_Latency_001
+ * @tc.desc: Latency samples of one window are reported as a single summary, not one event per spike.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(CooperateRadarReporterTest, CooperateRadarReporterTest_Latency_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    auto &reporter = CooperateRadarReporter::GetInstance();
+    reporter.BeginLatencySession(LOCAL_NETWORK_ID, PEER_NETWORK_ID, 1, 1);
+    for (int32_t index = 0; index < SAMPLE_NUM; ++index) {
+        reporter.RecordLatency(NORMAL_LATENCY, (index % SPIKE_PERIOD == 0) ? SPIKE_LATENCY : NORMAL_LATENCY);
+    }
+    reporter.Flush();
+    EXPECT_EQ(sink_->summaryNum, 1);
+    EXPECT_EQ(sink_->lastSummary.sampleCount, SAMPLE_NUM);
+    EXPECT_EQ(sink_->lastSummary.exceedCount, SAMPLE_NUM / SPIKE_PERIOD);
+    EXPECT_EQ(sink_->lastSummary.transmissionP50, NORMAL_LATENCY);
+    EXPECT_EQ(sink_->lastSummary.transmissionMax, SPIKE_LATENCY);
+    EXPECT_EQ(sink_->lastSummary.peerNetId.find(PEER_NETWORK_ID), std::string::npos);
+}
+
+/**
+ * @tc.name: CooperateRadarReporterTest_Latency_002
+ * @tc.desc: A window without any sample over threshold emits nothing.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(CooperateRadarReporterTest, CooperateRadarReporterTest_Latency_002, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    auto &reporter = CooperateRadarReporter::GetInstance();
+    for (int32_t index = 0; index < SAMPLE_NUM; ++index) {
+        reporter.RecordLatency(NORMAL_LATENCY, NORMAL_LATENCY);
+    }
+    reporter.Flush();
+    EXPECT_EQ(sink_->summaryNum, 0);
+}
+
+/**
+ * @tc.name: CooperateRadarReporterTest_RateLimit_001
+ * @tc.desc: A burst of stage events is rate limited and the excess is counted as dropped.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(CooperateRadarReporterTest, CooperateRadarReporterTest_RateLimit_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    auto &reporter = CooperateRadarReporter::GetInstance();
+    uint64_t dropCount = reporter.GetDropCount();
+    CooperateRadarInfo radarInfo {
+        .funcName = __FUNCTION__,
+        .bizState = static_cast<int32_t>(BizState::STATE_END),
+        .bizScene = static_cast<int32_t>(BizCooperateScene::SCENE_PASSIVE),
+    };
+    for (int32_t index = 0; index < BURST_NUM; ++index) {
+        reporter.Report(radarInfo);
+    }
+    reporter.Flush();
+    uint64_t dropped = reporter.GetDropCount() - dropCount;
+    EXPECT_LE(sink_->cooperateNum, static_cast<int32_t>(CooperateRadarReporter::MAX_EVENTS_PER_SECOND));
+    EXPECT_EQ(sink_->cooperateNum + static_cast<int32_t>(dropped), BURST_NUM);
+}
+
+/**
+ * @tc.name: CooperateRadarReporterTest_Queue_001
+ * @tc.desc: The bounded queue rejects pushes when full and hands out items in order.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(CooperateRadarReporterTest, CooperateRadarReporterTest_Queue_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    constexpr size_t capacity { 4 };
+    RadarEventQueue<int32_t, capacity> queue;
+    for (size_t index = 0; index < capacity; ++index) {
+        EXPECT_TRUE(queue.Push(static_cast<int32_t>(index)));
+    }
+    EXPECT_FALSE(queue.Push(static_cast<int32_t>(capacity)));
+    int32_t value = -1;
+    for (size_t index = 0; index < capacity; ++index) {
+        ASSERT_TRUE(queue.Pop(value));
+        EXPECT_EQ(value, static_cast<int32_t>(index));
+    }
+    EXPECT_FALSE(queue.Pop(value));
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
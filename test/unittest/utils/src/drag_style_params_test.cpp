@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <limits>
+
+#include <gtest/gtest.h>
+
+#include "devicestatus_define.h"
+#include "drag_data_packer.h"
+#include "drag_style_params.h"
+#include "message_parcel.h"
+
+#undef LOG_TAG
+#define LOG_TAG "DragStyleParamsTest"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+using namespace testing::ext;
+namespace {
+constexpr int32_t BENCHMARK_ROUNDS { 1000 };
+const std::string FILTER_INFO { "{\"dip_scale\":3.5,\"scale\":0.9,\"drag_corner_radius1\":8,"
+    "\"drag_corner_radius2\":8,\"drag_corner_radius3\":8,\"drag_corner_radius4\":8,\"drag_type\":\"text\","
+    "\"shadow_enable\":true,\"drag_shadow_offsetX\":2,\"drag_shadow_offsetY\":4,\"drag_shadow_argb\":872415231,"
+    "\"shadow_is_filled\":true,\"shadow_mask\":false,\"shadow_color_strategy\":1,"
+    "\"shadow_is_hardwareacceleration\":true,\"shadow_elevation\":12,\"drag_shadow_path\":\"M0 0 L10 10\","
+    "\"dip_opacity\":0.8,\"blur_coef1\":1.5,\"blur_coef2\":2.5,\"blur_radius\":20,\"blur_staturation\":1.2,"
+    "\"blur_brightness\":1.1,\"blur_color\":16777215,\"blur_style\":3,\"drag_node_gray_scale\":0.5,"
+    "\"event_id\":7,\"enable_animation\":true}" };
+const std::string EXTRA_INFO { "{\"drag_data_type\":\"image\",\"drag_blur_style\":2,\"drag_corner_radius\":12,"
+    "\"drag_allow_distributed\":false,\"blur_coef1\":0.5,\"blur_coef2\":0.25,\"dropArea\":[1,2,3,4]}" };
+} // namespace
+
+class DragStyleParamsTest : public testing::Test {
+public:
+    void SetUp();
+    void TearDown();
+    static void SetUpTestCase();
+    static void TearDownTestCase(void);
+};
+
+void DragStyleParamsTest::SetUpTestCase() {}
+
+void DragStyleParamsTest::TearDownTestCase() {}
+
+void DragStyleParamsTest::SetUp()
+{
+    DragStyleParamsCache::GetInstance().Clear();
+}
+
+void DragStyleParamsTest::TearDown()
+{
+    DragStyleParamsCache::GetInstance().Clear();
+}
+
+/**
+ * @tc.name: DragStyleParamsTest_Parse_001
+ * @tc.desc: Filter and extra info are parsed into their typed form, with present fields flagged.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DragStyleParamsTest, DragStyleParamsTest_Parse_001, TestSize.Level1)
+{
+    DragFilterParams filterParams;
+    ASSERT_EQ(DragStyleParamsParser::ParseFilterInfo(FILTER_INFO, filterParams), RET_OK);
+    EXPECT_EQ(filterParams.fieldMask,
+        DRAG_FILTER_DIP_SCALE | DRAG_FILTER_SCALE | DRAG_FILTER_BLUR_RADIUS | DRAG_FILTER_EVENT_ID);
+    EXPECT_FLOAT_EQ(filterParams.dipScale, 3.5f);
+    EXPECT_EQ(filterParams.dragType, "text");
+    EXPECT_TRUE(filterParams.shadowEnable);
+    EXPECT_TRUE(filterParams.isHardwareAcceleration);
+    EXPECT_FLOAT_EQ(filterParams.shadowElevation, 12.0f);
+    EXPECT_FLOAT_EQ(filterParams.shadowCorner, 0.0f);
+    EXPECT_EQ(filterParams.shadowPath, "M0 0 L10 10");
+    EXPECT_FLOAT_EQ(filterParams.opacity, 0.8f);
+    EXPECT_EQ(filterParams.blurStyle, 3);
+    EXPECT_EQ(filterParams.eventId, 7);
+
+    DragExtraParams extraParams;
+    ASSERT_EQ(DragStyleParamsParser::ParseExtraInfo(EXTRA_INFO, extraParams), RET_OK);
+    EXPECT_EQ(extraParams.componentType, "image");
+    EXPECT_FALSE(extraParams.allowDistributed);
+    EXPECT_TRUE(extraParams.hasDropArea);
+    EXPECT_EQ(extraParams.dropArea, std::vector<int32_t>({ 1, 2, 3, 4 }));
+
+    EXPECT_EQ(DragStyleParamsParser::ParseFilterInfo("", filterParams), RET_ERR);
+    EXPECT_EQ(DragStyleParamsParser::ParseExtraInfo("[1,2]", extraParams), RET_ERR);
+    ASSERT_EQ(DragStyleParamsParser::ParseFilterInfo("{\"dip_opacity\":1.5}", filterParams), RET_OK);
+    EXPECT_FLOAT_EQ(filterParams.opacity, 0.95f);
+    EXPECT_EQ(filterParams.fieldMask, 0U);
+}
+
+/**
+ * @tc.name: DragStyleParamsTest_RoundTrip_001
+ * @tc.desc: Style params parsed on the sending side come back through a parcel unchanged.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DragStyleParamsTest, DragStyleParamsTest_RoundTrip_001, TestSize.Level1)
+{
+    DragData dragData;
+    dragData.filterInfo = FILTER_INFO;
+    dragData.extraInfo = EXTRA_INFO;
+    MessageParcel parcel;
+    ASSERT_EQ(DragDataPacker::MarshallingStyleParams(dragData, parcel), RET_OK);
+
+    DragData received;
+    ASSERT_EQ(DragDataPacker::UnMarshallingStyleParams(parcel, received), RET_OK);
+    EXPECT_EQ(received.styleParamsVersion, DRAG_STYLE_PARAMS_VERSION);
+    DragStyleParamsParser::Parse(dragData);
+    EXPECT_EQ(received.filterParams, dragData.filterParams);
+    EXPECT_EQ(received.extraParams, dragData.extraParams);
+}
+
+/**
+ * @tc.name: DragStyleParamsTest_RoundTrip_002
+ * @tc.desc: Drag data from senders without style params falls back to the JSON strings.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DragStyleParamsTest, DragStyleParamsTest_RoundTrip_002, TestSize.Level1)
+{
+    MessageParcel emptyParcel;
+    DragData received;
+    EXPECT_EQ(DragDataPacker::UnMarshallingStyleParams(emptyParcel, received), RET_OK);
+    EXPECT_EQ(received.styleParamsVersion, 0);
+
+    MessageParcel parcel;
+    parcel.WriteInt32(DRAG_STYLE_PARAMS_VERSION + 1);
+    EXPECT_EQ(DragDataPacker::UnMarshallingStyleParams(parcel, received), RET_OK);
+    EXPECT_EQ(received.styleParamsVersion, 0);
+}
+
+/**
+ * @tc.name: DragStyleParamsTest_Cache_001
+ * @tc.desc: The same JSON string is parsed once, and then served from the cache.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DragStyleParamsTest, DragStyleParamsTest_Cache_001, TestSize.Level1)
+{
+    DragStyleParamsCache &cache = DragStyleParamsCache::GetInstance();
+    DragFilterParams first;
+    ASSERT_EQ(cache.GetFilterParams(FILTER_INFO, first), RET_OK);
+    EXPECT_EQ(cache.GetHitCount(), 0U);
+    DragFilterParams second;
+    ASSERT_EQ(cache.GetFilterParams(FILTER_INFO, second), RET_OK);
+    EXPECT_EQ(cache.GetHitCount(), 1U);
+    EXPECT_EQ(first, second);
+
+    DragExtraParams extraParams;
+    ASSERT_EQ(cache.GetExtraParams(EXTRA_INFO, extraParams), RET_OK);
+    EXPECT_EQ(cache.GetHitCount(), 1U);
+    EXPECT_EQ(cache.GetExtraParams("not json", extraParams), RET_ERR);
+    EXPECT_EQ(cache.GetExtraParams("not json", extraParams), RET_ERR);
+    EXPECT_EQ(cache.GetHitCount(), 1U);
+}
+
+/**
+ * @tc.name: DragStyleParamsTest_Benchmark_001
+ * @tc.desc: Reading style params from a parcel is not slower than parsing the JSON strings.
+ * @tc.type: PERF
+ * @tc.require:
+ */
+HWTEST_F(DragStyleParamsTest, DragStyleParamsTest_Benchmark_001, TestSize.Level1)
+{
+    auto begin = std::chrono::steady_clock::now();
+    for (int32_t i = 0; i < BENCHMARK_ROUNDS; ++i) {
+        DragFilterParams filterParams;
+        DragExtraParams extraParams;
+        ASSERT_EQ(DragStyleParamsParser::ParseFilterInfo(FILTER_INFO, filterParams), RET_OK);
+        ASSERT_EQ(DragStyleParamsParser::ParseExtraInfo(EXTRA_INFO, extraParams), RET_OK);
+    }
+    auto parseCost = std::chrono::steady_clock::now() - begin;
+
+    DragData dragData;
+    dragData.filterInfo = FILTER_INFO;
+    dragData.extraInfo = EXTRA_INFO;
+    DragStyleParamsParser::Parse(dragData);
+    MessageParcel parcel;
+    ASSERT_EQ(DragDataPacker::MarshallingStyleParams(dragData, parcel), RET_OK);
+    begin = std::chrono::steady_clock::now();
+    for (int32_t i = 0; i < BENCHMARK_ROUNDS; ++i) {
+        parcel.RewindRead(0);
+        DragData received;
+        ASSERT_EQ(DragDataPacker::UnMarshallingStyleParams(parcel, received), RET_OK);
+    }
+    auto unmarshalCost = std::chrono::steady_clock::now() - begin;
+
+    using std::chrono::microseconds;
+    GTEST_LOG_(INFO) << "Rounds:" << BENCHMARK_ROUNDS
+        << ", parse:" << std::chrono::duration_cast<microseconds>(parseCost).count() << "us"
+        << ", unmarshal:" << std::chrono::duration_cast<microseconds>(unmarshalCost).count() << "us";
+    EXPECT_LE(unmarshalCost, parseCost);
+}
+
+/**
+ * @tc.name: DragStyleParamsTest_Sanitize_001
+ * @tc.desc: Typed params are put back to what parsing would yield before they are applied
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DragStyleParamsTest, DragStyleParamsTest_Sanitize_001, TestSize.Level1)
+{
+    DragFilterParams parsed;
+    ASSERT_EQ(DragStyleParamsParser::ParseFilterInfo(FILTER_INFO, parsed), RET_OK);
+    DragFilterParams sanitized = parsed;
+    DragStyleParamsParser::Sanitize(sanitized);
+    EXPECT_EQ(sanitized, parsed);
+
+    DragFilterParams filterParams = parsed;
+    filterParams.opacity = 1.5f;
+    filterParams.dragType = "image";
+    filterParams.shadowCorner = 6.0f;
+    filterParams.blurRadius = std::numeric_limits<float>::quiet_NaN();
+    DragStyleParamsParser::Sanitize(filterParams);
+    const DragFilterParams defaults;
+    EXPECT_EQ(filterParams.opacity, defaults.opacity);
+    EXPECT_TRUE(filterParams.shadowPath.empty());
+    EXPECT_EQ(filterParams.shadowCorner, defaults.shadowCorner);
+    EXPECT_EQ(filterParams.blurRadius, defaults.blurRadius);
+
+    filterParams = parsed;
+    filterParams.shadowEnable = false;
+    DragStyleParamsParser::Sanitize(filterParams);
+    EXPECT_TRUE(filterParams.shadowPath.empty());
+    EXPECT_EQ(filterParams.shadowElevation, defaults.shadowElevation);
+    EXPECT_EQ(filterParams.shadowArgb, defaults.shadowArgb);
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "devicestatus_define.h"
+#include "ipc_statistics.h"
+#include "latency_histogram.h"
+
+#undef LOG_TAG
+#define LOG_TAG "LatencyHistogramTest"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+using namespace testing::ext;
+namespace {
+constexpr int64_t SAMPLE_NUM { 1000 };
+constexpr int32_t THREAD_NUM { 4 };
+constexpr uint32_t TEST_CODE { 3 };
+constexpr uint32_t UNREGISTERED_CODE { 120 };
+constexpr int32_t TEST_ERROR { 401 };
+constexpr double MAX_RELATIVE_ERROR { 0.125 };
+} // namespace
+
+class LatencyHistogramTest : public testing::Test {
+public:
+    void SetUp();
+    void TearDown();
+    static void SetUpTestCase();
+    static void TearDownTestCase(void);
+};
+
+void LatencyHistogramTest::SetUpTestCase() {}
+
+void LatencyHistogramTest::TearDownTestCase() {}
+
+void LatencyHistogramTest::SetUp() {}
+
+void LatencyHistogramTest::TearDown()
+{
+    IpcStatistics::GetInstance().Reset();
+}
+
+/**
+ * @tc.name: LatencyHistogramTest_Percentile_001
+ * @tc.desc: Percentiles stay within the bucket error of the exact value.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(LatencyHistogramTest, LatencyHistogramTest_Percentile_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    LatencyHistogram histogram;
+    EXPECT_EQ(histogram.GetPercentile(50.0), 0);
+    for (int64_t value = 1; value <= SAMPLE_NUM; ++value) {
+        histogram.Record(value);
+    }
+    EXPECT_EQ(histogram.GetCount(), static_cast<uint64_t>(SAMPLE_NUM));
+    EXPECT_EQ(histogram.GetMin(), 1);
+    EXPECT_EQ(histogram.GetMax(), SAMPLE_NUM);
+    for (double percentile : { 50.0, 90.0, 99.0 }) {
+        double exact = percentile / 100.0 * SAMPLE_NUM;
+        double reported = static_cast<double>(histogram.GetPercentile(percentile));
+        EXPECT_GE(reported, exact);
+        EXPECT_LE(reported, exact * (1.0 + MAX_RELATIVE_ERROR));
+    }
+    EXPECT_EQ(histogram.GetPercentile(100.0), SAMPLE_NUM);
+    histogram.Reset();
+    EXPECT_EQ(histogram.GetCount(), 0u);
+    EXPECT_EQ(histogram.GetMax(), 0);
+}
+
+/**
+ * @tc.name: LatencyHistogramTest_Concurrent_001
+ * @tc.desc: Samples recorded from several threads are all counted.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(LatencyHistogramTest, LatencyHistogramTest_Concurrent_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    LatencyHistogram histogram;
+    ErrorCodeCounter errorCodes;
+    std::vector<std::thread> threads;
+    for (int32_t index = 0; index < THREAD_NUM; ++index) {
+        threads.emplace_back([&histogram, &errorCodes] {
+            for (int64_t value = 1; value <= SAMPLE_NUM; ++value) {
+                histogram.Record(value);
+                errorCodes.Record(TEST_ERROR);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(histogram.GetCount(), static_cast<uint64_t>(SAMPLE_NUM * THREAD_NUM));
+    auto counts = errorCodes.GetCounts();
+    ASSERT_EQ(counts.size(), 1u);
+    EXPECT_EQ(counts[0].first, TEST_ERROR);
+    EXPECT_EQ(counts[0].second, static_cast<uint64_t>(SAMPLE_NUM * THREAD_NUM));
+}
+
+/**
+ * @tc.name: LatencyHistogramTest_IpcStatistics_001
+ * @tc.desc: Requests are accounted to their method and server; unregistered codes go to the unknown server.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(LatencyHistogramTest, LatencyHistogramTest_IpcStatistics_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    auto &statistics = IpcStatistics::GetInstance();
+    statistics.RegisterMethod(TEST_CODE, "StartDrag", "Drag");
+    statistics.Record(TEST_CODE, SAMPLE_NUM, RET_OK);
+    statistics.Record(TEST_CODE, SAMPLE_NUM, TEST_ERROR);
+    statistics.Record(UNREGISTERED_CODE, SAMPLE_NUM, RET_OK);
+    statistics.Record(IpcStatistics::MAX_CODE, SAMPLE_NUM, RET_OK);
+
+    const LatencyHistogram *method = statistics.GetMethodHistogram(TEST_CODE);
+    ASSERT_NE(method, nullptr);
+    EXPECT_EQ(method->GetCount(), 2u);
+    const LatencyHistogram *server = statistics.GetServerHistogram("Drag");
+    ASSERT_NE(server, nullptr);
+    EXPECT_EQ(server->GetCount(), 2u);
+    EXPECT_EQ(statistics.GetMethodHistogram(IpcStatistics::MAX_CODE), nullptr);
+    EXPECT_EQ(statistics.GetServerHistogram("NoSuchServer"), nullptr);
+    statistics.Dump(STDOUT_FILENO);
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "devicestatus_define.h"
+#include "napi_event_dispatcher.h"
+
+#undef LOG_TAG
+#define LOG_TAG "NapiEventCoalescerTest"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+using namespace testing::ext;
+namespace {
+const std::string MODULE_MOTION { "motion" };
+const std::string MODULE_STATUS { "status" };
+constexpr int32_t TYPE_ONE { 1 };
+constexpr int32_t TYPE_TWO { 2 };
+constexpr int32_t EVENT_NUM { 10 };
+constexpr size_t QUEUE_CAPACITY { 3 };
+
+void RunBatch(NapiEventCoalescer &coalescer)
+{
+    for (auto &task : coalescer.TakeBatch()) {
+        task();
+    }
+}
+} // namespace
+
+class NapiEventCoalescerTest : public testing::Test {
+public:
+    void SetUp();
+    void TearDown();
+    static void SetUpTestCase();
+    static void TearDownTestCase(void);
+};
+
+void NapiEventCoalescerTest::SetUpTestCase() {}
+
+void NapiEventCoalescerTest::TearDownTestCase() {}
+
+void NapiEventCoalescerTest::SetUp() {}
+
+void NapiEventCoalescerTest::TearDown() {}
+
+/**
+ * @tc.name: NapiEventCoalescerTest_LatestWins_001
+ * @tc.desc: A burst of one (module, type) is delivered as its latest event, other keys are kept,
+ *           and only the first push of a batch asks for a delivery.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(NapiEventCoalescerTest, NapiEventCoalescerTest_LatestWins_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    NapiEventCoalescer coalescer;
+    std::vector<int32_t> delivered;
+    EXPECT_TRUE(coalescer.Push(MODULE_MOTION, TYPE_ONE, [&delivered] { delivered.push_back(0); }));
+    for (int32_t index = 1; index <= EVENT_NUM; ++index) {
+        EXPECT_FALSE(coalescer.Push(MODULE_MOTION, TYPE_ONE, [&delivered, index] { delivered.push_back(index); }));
+    }
+    EXPECT_FALSE(coalescer.Push(MODULE_MOTION, TYPE_TWO, [&delivered] { delivered.push_back(-TYPE_TWO); }));
+    EXPECT_FALSE(coalescer.Push(MODULE_STATUS, TYPE_ONE, [&delivered] { delivered.push_back(-TYPE_ONE); }));
+    RunBatch(coalescer);
+    EXPECT_EQ(delivered, std::vector<int32_t>({ EVENT_NUM, -TYPE_TWO, -TYPE_ONE }));
+
+    NapiEventStats stats = coalescer.GetStats();
+    EXPECT_EQ(stats.posted, static_cast<uint64_t>(EVENT_NUM + 3));
+    EXPECT_EQ(stats.coalesced, static_cast<uint64_t>(EVENT_NUM));
+    EXPECT_EQ(stats.delivered, 3u);
+    EXPECT_EQ(stats.batches, 1u);
+    EXPECT_TRUE(coalescer.Push(MODULE_MOTION, TYPE_ONE, [] {}));
+}
+
+/**
+ * @tc.name: NapiEventCoalescerTest_BoundedQueue_001
+ * @tc.desc: Queued events are delivered in order, and the oldest are dropped once the queue is full.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(NapiEventCoalescerTest, NapiEventCoalescerTest_BoundedQueue_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    NapiEventCoalescer coalescer;
+    std::vector<int32_t> delivered;
+    for (int32_t index = 0; index < EVENT_NUM; ++index) {
+        coalescer.Push(MODULE_STATUS, TYPE_ONE, [&delivered, index] { delivered.push_back(index); },
+            CoalescePolicy::BOUNDED_QUEUE, QUEUE_CAPACITY);
+    }
+    RunBatch(coalescer);
+    EXPECT_EQ(delivered, std::vector<int32_t>({ EVENT_NUM - 3, EVENT_NUM - 2, EVENT_NUM - 1 }));
+    NapiEventStats stats = coalescer.GetStats();
+    EXPECT_EQ(stats.dropped, static_cast<uint64_t>(EVENT_NUM) - QUEUE_CAPACITY);
+    EXPECT_EQ(stats.coalesced, 0u);
+}
+
+/**
+ * @tc.name: NapiEventCoalescerTest_Discard_001
+ * @tc.desc: Discarded events are counted as dropped and the next push schedules a new delivery.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(NapiEventCoalescerTest, NapiEventCoalescerTest_Discard_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    NapiEventCoalescer coalescer;
+    bool called = false;
+    EXPECT_TRUE(coalescer.Push(MODULE_MOTION, TYPE_ONE, [&called] { called = true; }));
+    EXPECT_FALSE(coalescer.Push(MODULE_STATUS, TYPE_ONE, [&called] { called = true; }));
+    coalescer.Discard();
+    EXPECT_TRUE(coalescer.TakeBatch().empty());
+    EXPECT_FALSE(called);
+    EXPECT_EQ(coalescer.GetStats().dropped, 2u);
+    EXPECT_TRUE(coalescer.Push(MODULE_MOTION, TYPE_ONE, [] {}));
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
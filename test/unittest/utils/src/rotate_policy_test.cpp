@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "dm_common.h"
+
+#include "rotate_policy.h"
+
+#undef LOG_TAG
+#define LOG_TAG "RotatePolicyTest"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+using namespace testing::ext;
+namespace {
+constexpr int32_t ROTATE_POLICY_WINDOW_ROTATE { 0 };
+constexpr int32_t ROTATE_POLICY_SCREEN_ROTATE { 1 };
+constexpr int32_t ROTATE_POLICY_FOLD_MODE { 2 };
+const std::string FOLD_SCREEN_TYPE_PRIMARY { "0,0,0,0" };
+const std::string FOLD_SCREEN_TYPE_SECONDARY { "6,1,0,0" };
+} // namespace
+
+class RotatePolicyTest : public testing::Test {
+public:
+    void SetUp() {}
+    void TearDown() {}
+    static void SetUpTestCase() {}
+    static void TearDownTestCase(void) {}
+};
+
+/**
+ * @tc.name: RotatePolicyTest_NotFoldable_001
+ * @tc.desc: Devices that do not fold follow the rotate policy, whatever the posture.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RotatePolicyTest, RotatePolicyTest_NotFoldable_001, TestSize.Level1)
+{
+    RotatePolicy screenRotate(ROTATE_POLICY_SCREEN_ROTATE, "", FOLD_SCREEN_TYPE_PRIMARY);
+    EXPECT_TRUE(screenRotate.IsScreenRotation());
+    EXPECT_TRUE(screenRotate.IsScreenRotation(false, FoldPosture::UNKNOWN));
+    EXPECT_TRUE(screenRotate.IsScreenRotation(false, FoldPosture::EXPANDED));
+    EXPECT_FALSE(screenRotate.IsFoldPolicyValid());
+
+    RotatePolicy windowRotate(ROTATE_POLICY_WINDOW_ROTATE, "1,1", FOLD_SCREEN_TYPE_PRIMARY);
+    EXPECT_FALSE(windowRotate.IsScreenRotation());
+    EXPECT_FALSE(windowRotate.IsScreenRotation(false, FoldPosture::UNKNOWN));
+    EXPECT_FALSE(windowRotate.IsScreenRotation(true, FoldPosture::EXPANDED));
+    EXPECT_FALSE(windowRotate.IsFoldPolicyValid());
+}
+
+/**
+ * @tc.name: RotatePolicyTest_Foldable_001
+ * @tc.desc: Foldable devices look up the fold rotate policy of their posture.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RotatePolicyTest, RotatePolicyTest_Foldable_001, TestSize.Level1)
+{
+    RotatePolicy policy(ROTATE_POLICY_FOLD_MODE, "0,1", FOLD_SCREEN_TYPE_PRIMARY);
+    ASSERT_TRUE(policy.IsFoldPolicyValid());
+    EXPECT_FALSE(policy.IsScreenRotation());
+    EXPECT_FALSE(policy.IsSecondaryDevice());
+    EXPECT_EQ(policy.GetFoldPosture(Rosen::FoldStatus::EXPAND), FoldPosture::EXPANDED);
+    EXPECT_EQ(policy.GetFoldPosture(Rosen::FoldStatus::HALF_FOLD), FoldPosture::EXPANDED);
+    EXPECT_EQ(policy.GetFoldPosture(Rosen::FoldStatus::FOLDED), FoldPosture::FOLDED);
+    EXPECT_EQ(policy.GetFoldPosture(Rosen::FoldStatus::FOLD_STATE_EXPAND_WITH_SECOND_EXPAND),
+        FoldPosture::UNKNOWN);
+    EXPECT_TRUE(policy.IsScreenRotation(true, FoldPosture::EXPANDED));
+    EXPECT_FALSE(policy.IsScreenRotation(true, FoldPosture::FOLDED));
+    EXPECT_FALSE(policy.IsScreenRotation(true, FoldPosture::UNKNOWN));
+
+    RotatePolicy invalid(ROTATE_POLICY_FOLD_MODE, "1", FOLD_SCREEN_TYPE_PRIMARY);
+    EXPECT_FALSE(invalid.IsFoldPolicyValid());
+    EXPECT_FALSE(invalid.IsScreenRotation(true, FoldPosture::FOLDED));
+}
+
+/**
+ * @tc.name: RotatePolicyTest_Secondary_001
+ * @tc.desc: Devices with a second fold map their extra fold states to postures.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RotatePolicyTest, RotatePolicyTest_Secondary_001, TestSize.Level1)
+{
+    RotatePolicy policy(ROTATE_POLICY_FOLD_MODE, "1,0", FOLD_SCREEN_TYPE_SECONDARY);
+    ASSERT_TRUE(policy.IsSecondaryDevice());
+    EXPECT_EQ(policy.GetFoldPosture(Rosen::FoldStatus::FOLD_STATE_HALF_FOLDED_WITH_SECOND_EXPAND),
+        FoldPosture::EXPANDED);
+    EXPECT_EQ(policy.GetFoldPosture(Rosen::FoldStatus::FOLD_STATE_FOLDED_WITH_SECOND_HALF_FOLDED),
+        FoldPosture::FOLDED);
+    EXPECT_TRUE(policy.IsScreenRotation(true,
+        policy.GetFoldPosture(Rosen::FoldStatus::FOLD_STATE_FOLDED_WITH_SECOND_EXPAND)));
+    EXPECT_FALSE(policy.IsScreenRotation(true,
+        policy.GetFoldPosture(Rosen::FoldStatus::FOLD_STATE_EXPAND_WITH_SECOND_EXPAND)));
+
+    RotatePolicy malformed(ROTATE_POLICY_FOLD_MODE, "1,0", "6,1");
+    EXPECT_FALSE(malformed.IsSecondaryDevice());
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
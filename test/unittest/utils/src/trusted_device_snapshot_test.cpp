@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "devicestatus_define.h"
+#include "trusted_device_snapshot.h"
+
+#undef LOG_TAG
+#define LOG_TAG "TrustedDeviceSnapshotTest"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+using namespace testing::ext;
+namespace {
+const std::string FIRST_NETWORK_ID { "first_network_id" };
+const std::string SECOND_NETWORK_ID { "second_network_id" };
+constexpr std::chrono::milliseconds SHORT_STALENESS { 1 };
+constexpr std::chrono::milliseconds SLEEP_TIME { 10 };
+} // namespace
+
+class TrustedDeviceSnapshotTest : public testing::Test {
+public:
+    void SetUp();
+    void TearDown();
+    static void SetUpTestCase();
+    static void TearDownTestCase(void);
+};
+
+void TrustedDeviceSnapshotTest::SetUpTestCase() {}
+
+void TrustedDeviceSnapshotTest::TearDownTestCase() {}
+
+void TrustedDeviceSnapshotTest::SetUp() {}
+
+void TrustedDeviceSnapshotTest::TearDown() {}
+
+/**
+ * @tc.name: TrustedDeviceSnapshotTest_Lookup_001
+ * @tc.desc: The snapshot answers only while tracking and after a full sync, then follows state callbacks.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TrustedDeviceSnapshotTest, TrustedDeviceSnapshotTest_Lookup_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    TrustedDeviceSnapshot snapshot;
+    bool trusted = false;
+    snapshot.Sync(snapshot.GetGeneration(), { FIRST_NETWORK_ID });
+    EXPECT_FALSE(snapshot.Lookup(FIRST_NETWORK_ID, trusted));
+
+    snapshot.StartTracking();
+    EXPECT_FALSE(snapshot.Lookup(FIRST_NETWORK_ID, trusted));
+    snapshot.Sync(snapshot.GetGeneration(), { FIRST_NETWORK_ID });
+    ASSERT_TRUE(snapshot.Lookup(FIRST_NETWORK_ID, trusted));
+    EXPECT_TRUE(trusted);
+    ASSERT_TRUE(snapshot.Lookup(SECOND_NETWORK_ID, trusted));
+    EXPECT_FALSE(trusted);
+
+    snapshot.OnDeviceOnline(SECOND_NETWORK_ID);
+    snapshot.OnDeviceOffline(FIRST_NETWORK_ID);
+    ASSERT_TRUE(snapshot.Lookup(SECOND_NETWORK_ID, trusted));
+    EXPECT_TRUE(trusted);
+    ASSERT_TRUE(snapshot.Lookup(FIRST_NETWORK_ID, trusted));
+    EXPECT_FALSE(trusted);
+
+    snapshot.StopTracking();
+    EXPECT_FALSE(snapshot.Lookup(SECOND_NETWORK_ID, trusted));
+}
+
+/**
+ * @tc.name: TrustedDeviceSnapshotTest_Sync_001
+ * @tc.desc: A list queried while a state callback arrived is not allowed to overwrite the snapshot.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TrustedDeviceSnapshotTest, TrustedDeviceSnapshotTest_Sync_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    TrustedDeviceSnapshot snapshot;
+    snapshot.StartTracking();
+    snapshot.Sync(snapshot.GetGeneration(), { FIRST_NETWORK_ID });
+    uint64_t generation = snapshot.GetGeneration();
+    snapshot.OnDeviceOffline(FIRST_NETWORK_ID);
+    snapshot.Sync(generation, { FIRST_NETWORK_ID });
+    bool trusted = true;
+    ASSERT_TRUE(snapshot.Lookup(FIRST_NETWORK_ID, trusted));
+    EXPECT_FALSE(trusted);
+}
+
+/**
+ * @tc.name: TrustedDeviceSnapshotTest_Staleness_001
+ * @tc.desc: A snapshot older than the staleness bound defers to the live query.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TrustedDeviceSnapshotTest, TrustedDeviceSnapshotTest_Staleness_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    TrustedDeviceSnapshot snapshot;
+    snapshot.SetMaxStaleness(SHORT_STALENESS);
+    snapshot.StartTracking();
+    snapshot.Sync(snapshot.GetGeneration(), { FIRST_NETWORK_ID });
+    std::this_thread::sleep_for(SLEEP_TIME);
+    bool trusted = false;
+    EXPECT_FALSE(snapshot.Lookup(FIRST_NETWORK_ID, trusted));
+    snapshot.SetMaxStaleness(std::chrono::milliseconds(0));
+    EXPECT_TRUE(snapshot.Lookup(FIRST_NETWORK_ID, trusted));
+    EXPECT_TRUE(trusted);
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
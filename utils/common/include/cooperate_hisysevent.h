@@ -108,11 +108,34 @@ struct TransmissionLatencyRadarInfo {
     int32_t touchPadSpeed { -1 };
 };
 
+struct TransmissionLatencySummary {
+    std::string funcName;
+    int32_t bizState { -1 };
+    int32_t bizStage { -1 };
+    int32_t stageRes { -1 };
+    int32_t bizScene { -1 };
+    std::string localNetId;
+    std::string peerNetId;
+    int64_t windowMs { -1 };
+    int64_t sampleCount { -1 };
+    int64_t exceedCount { -1 };
+    int64_t driveInterceptorP50 { -1 };
+    int64_t driveInterceptorP99 { -1 };
+    int64_t driveInterceptorMax { -1 };
+    int64_t transmissionP50 { -1 };
+    int64_t transmissionP99 { -1 };
+    int64_t transmissionMax { -1 };
+    int64_t dropCount { -1 };
+    int32_t pointerSpeed { -1 };
+    int32_t touchPadSpeed { -1 };
+};
+
 class CooperateRadar {
 public:
     static void ReportCooperateRadarInfo(struct CooperateRadarInfo &cooperateRadarInfo);
     static void ReportTransmissionLatencyRadarInfo(
         struct TransmissionLatencyRadarInfo &transmissionLatencyRadarInfo);
+    static void ReportTransmissionLatencySummary(struct TransmissionLatencySummary &summary);
 };
 } // namespace DeviceStatus
 } // namespace Msdp
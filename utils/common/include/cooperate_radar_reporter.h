@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef COOPERATE_RADAR_REPORTER_H
+#define COOPERATE_RADAR_REPORTER_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+
+#include "nocopyable.h"
+
+#include "cooperate_hisysevent.h"
+#include "latency_histogram.h"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+// Bounded multi-producer queue after Dmitry Vyukov's design: every cell carries a sequence
+// number, so producers and the consumer only contend on one atomic position each.
+template<typename T, size_t Capacity>
+class RadarEventQueue final {
+    static_assert((Capacity >= 2) && ((Capacity & (Capacity - 1)) == 0), "Capacity must be a power of two");
+
+public:
+    RadarEventQueue()
+    {
+        for (size_t index = 0; index < Capacity; ++index) {
+            cells_[index].sequence.store(index, std::memory_order_relaxed);
+        }
+    }
+    ~RadarEventQueue() = default;
+    DISALLOW_COPY_AND_MOVE(RadarEventQueue);
+
+    bool Push(const T &value)
+    {
+        size_t pos = tail_.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell &cell = cells_[pos & (Capacity - 1)];
+            size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.value = value;
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = tail_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool Pop(T &value)
+    {
+        size_t pos = head_.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell &cell = cells_[pos & (Capacity - 1)];
+            size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    value = std::move(cell.value);
+                    cell.sequence.store(pos + Capacity, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = head_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence { 0 };
+        T value {};
+    };
+
+    std::array<Cell, Capacity> cells_ {};
+    std::atomic<size_t> tail_ { 0 };
+    std::atomic<size_t> head_ { 0 };
+};
+
+// Destination of radar events. The default sink writes HiSysEvents; tests install a counting one.
+class IRadarSink {
+public:
+    IRadarSink() = default;
+    virtual ~IRadarSink() = default;
+
+    virtual void OnCooperateRadarInfo(CooperateRadarInfo &radarInfo) = 0;
+    virtual void OnTransmissionLatencySummary(TransmissionLatencySummary &summary) = 0;
+};
+
+class HiSysEventRadarSink final : public IRadarSink {
+public:
+    HiSysEventRadarSink() = default;
+    ~HiSysEventRadarSink() = default;
+    DISALLOW_COPY_AND_MOVE(HiSysEventRadarSink);
+
+    void OnCooperateRadarInfo(CooperateRadarInfo &radarInfo) override;
+    void OnTransmissionLatencySummary(TransmissionLatencySummary &summary) override;
+};
+
+// Moves cooperate radar reporting off the cooperate worker. Stage events go through a bounded
+// queue and are rate limited; transmission latency samples are only aggregated on the hot path
+// and summarized once per window, and only when some sample exceeded its threshold.
+class CooperateRadarReporter final {
+public:
+    static constexpr size_t QUEUE_CAPACITY { 64 };
+    static constexpr uint32_t MAX_EVENTS_PER_SECOND { 20 };
+    static constexpr int64_t DRIVE_INTERCEPTOR_LATENCY { 5 };
+    static constexpr int64_t INTERCEPTOR_TRANSMISSION_LATENCY { 20 };
+
+    static CooperateRadarReporter& GetInstance();
+
+    ~CooperateRadarReporter();
+    DISALLOW_COPY_AND_MOVE(CooperateRadarReporter);
+
+    void SetSink(std::shared_ptr<IRadarSink> sink);
+    void Report(const CooperateRadarInfo &radarInfo);
+    void BeginLatencySession(const std::string &localNetworkId, const std::string &peerNetworkId,
+        int32_t pointerSpeed, int32_t touchPadSpeed);
+    void RecordLatency(int64_t driveToInterceptor, int64_t interceptorToTransmission);
+    void Flush();
+    uint64_t GetDropCount() const;
+
+private:
+    CooperateRadarReporter() = default;
+    void StartWorker();
+    void Worker();
+    void Drain();
+    // Called with mutex_ held; the summary is handed to the sink with EmitLatencySummary() after it is released.
+    std::optional<TransmissionLatencySummary> CollectLatencySummary(bool force);
+    static void EmitLatencySummary(std::shared_ptr<IRadarSink> sink,
+        std::optional<TransmissionLatencySummary> &summary);
+    bool AcquireToken();
+
+    RadarEventQueue<CooperateRadarInfo, QUEUE_CAPACITY> queue_;
+    std::atomic<int64_t> rateWindowStart_ { 0 };
+    std::atomic<uint32_t> rateWindowCount_ { 0 };
+    std::atomic<uint64_t> dropCount_ { 0 };
+    uint64_t loggedDropCount_ { 0 };
+    uint64_t reportedDropCount_ { 0 };
+
+    LatencyHistogram driveToInterceptor_;
+    LatencyHistogram interceptorToTransmission_;
+    std::atomic<uint64_t> exceedCount_ { 0 };
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::shared_ptr<IRadarSink> sink_ { std::make_shared<HiSysEventRadarSink>() };
+    std::string localNetId_;
+    std::string peerNetId_;
+    int32_t pointerSpeed_ { -1 };
+    int32_t touchPadSpeed_ { -1 };
+    std::chrono::steady_clock::time_point windowStart_ { std::chrono::steady_clock::now() };
+
+    std::once_flag workerFlag_;
+    std::thread worker_;
+    std::atomic<bool> running_ { false };
+};
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+#endif // COOPERATE_RADAR_REPORTER_H
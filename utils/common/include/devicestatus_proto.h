@@ -78,6 +78,10 @@ enum class MessageId : int32_t {
     DSOFTBUS_RELAY_COOPERATE_WITHOPTIONS,
     DSOFTBUS_RELAY_COOPERATE_WITHOPTIONS_FINISHED,
     DRAG_STOP_DRAG_END,
+    DSOFTBUS_INPUT_DEV_DIGEST,
+    DSOFTBUS_INPUT_DEV_PULL,
+    DSOFTBUS_INPUT_DEV_DELTA,
+    DRAG_DROP_BUNDLE,
     MAX_MESSAGE_ID,
 };
 
@@ -44,6 +44,16 @@ public:
     static int32_t UnMarshallingMaterialFilter(Parcel &data, DragData &dragData);
     static int32_t MarshallingDragAnimationType(const DragData &dragData, Parcel &data);
     static int32_t UnMarshallingDragAnimationType(Parcel &data, DragData &dragData);
+    static int32_t MarshallingStyleParams(const DragData &dragData, Parcel &data);
+    static int32_t UnMarshallingStyleParams(Parcel &data, DragData &dragData);
+};
+
+class DragStyleParamsPacker {
+public:
+    static int32_t Marshalling(const DragFilterParams &filterParams, Parcel &data);
+    static int32_t UnMarshalling(Parcel &data, DragFilterParams &filterParams);
+    static int32_t Marshalling(const DragExtraParams &extraParams, Parcel &data);
+    static int32_t UnMarshalling(Parcel &data, DragExtraParams &extraParams);
 };
 
 class ShadowPacker {
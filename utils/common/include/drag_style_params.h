@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DRAG_STYLE_PARAMS_H
+#define DRAG_STYLE_PARAMS_H
+
+#include <list>
+#include <mutex>
+#include <string>
+
+#include "drag_data.h"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+// Parses the JSON strings DragData::filterInfo and DragData::extraInfo into their typed form.
+class DragStyleParamsParser {
+public:
+    static int32_t ParseFilterInfo(const std::string &filterInfo, DragFilterParams &filterParams);
+    static int32_t ParseExtraInfo(const std::string &extraInfo, DragExtraParams &extraParams);
+    // Fills in filterParams and extraParams of @dragData, unless they already are.
+    static void Parse(DragData &dragData);
+    // Puts back to default what parsing would never yield: out of range or non-finite values, shadow
+    // fields with the shadow disabled, and a shadow path for other than text. Typed params come from
+    // the app as they are, so whoever applies them runs this first.
+    static void Sanitize(DragFilterParams &filterParams);
+};
+
+// Results of parsing, keyed by content hash, for drag data that arrives as JSON only. Apps tend to
+// send the same strings drag after drag.
+class DragStyleParamsCache {
+public:
+    static DragStyleParamsCache& GetInstance();
+    static uint64_t HashString(const std::string &str);
+
+    int32_t GetFilterParams(const std::string &filterInfo, DragFilterParams &filterParams);
+    int32_t GetExtraParams(const std::string &extraInfo, DragExtraParams &extraParams);
+    size_t GetHitCount();
+    void Clear();
+
+private:
+    template<typename Params>
+    struct Entry {
+        uint64_t hash { 0 };
+        std::string json;
+        Params params;
+    };
+    template<typename Params>
+    using Entries = std::list<Entry<Params>>;
+
+    DragStyleParamsCache() = default;
+    template<typename Params>
+    int32_t Get(Entries<Params> &entries, const std::string &json, Params &params,
+        int32_t (*parse)(const std::string&, Params&));
+
+    std::mutex mutex_;
+    Entries<DragFilterParams> filterEntries_;
+    Entries<DragExtraParams> extraEntries_;
+    size_t hitCount_ { 0 };
+};
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+#endif // DRAG_STYLE_PARAMS_H
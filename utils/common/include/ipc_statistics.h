@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IPC_STATISTICS_H
+#define IPC_STATISTICS_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+#include "nocopyable.h"
+
+#include "latency_histogram.h"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+// Latency histograms and error counters of incoming IPC requests, per method and per server.
+// Methods are registered once at start-up; recording afterwards does not take any lock.
+class IpcStatistics final {
+public:
+    static constexpr uint32_t MAX_CODE { 128 };
+    static constexpr size_t MAX_SERVER_NUM { 16 };
+
+    static IpcStatistics& GetInstance();
+
+    void RegisterMethod(uint32_t code, const std::string &method, const std::string &server);
+    void Record(uint32_t code, int64_t costTime, int32_t result);
+    void Dump(int32_t fd);
+    void Reset();
+    const LatencyHistogram* GetMethodHistogram(uint32_t code) const;
+    const LatencyHistogram* GetServerHistogram(const std::string &server);
+
+private:
+    struct MethodSlot {
+        std::string method;
+        std::atomic<size_t> server { 0 };
+        LatencyHistogram costTime;
+        ErrorCodeCounter errorCodes;
+    };
+
+    struct ServerSlot {
+        std::string server;
+        LatencyHistogram costTime;
+    };
+
+    IpcStatistics() = default;
+    ~IpcStatistics() = default;
+    DISALLOW_COPY_AND_MOVE(IpcStatistics);
+
+    size_t FindServerLocked(const std::string &server) const;
+
+    std::mutex mutex_;
+    std::array<MethodSlot, MAX_CODE> methods_;
+    // Slot 0 collects requests of codes that were never registered.
+    std::array<ServerSlot, MAX_SERVER_NUM> servers_;
+    size_t serverNum_ { 1 };
+};
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+#endif // IPC_STATISTICS_H
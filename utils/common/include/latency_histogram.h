@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LATENCY_HISTOGRAM_H
+#define LATENCY_HISTOGRAM_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "nocopyable.h"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+// Log-linear latency histogram: every power of two is split into 8 buckets, which bounds the
+// relative error of a reported percentile to 12.5%. Recording only touches relaxed atomics.
+class LatencyHistogram final {
+public:
+    static constexpr size_t SUB_BUCKET_BITS { 3 };
+    static constexpr size_t SUB_BUCKET_NUM { 1 << SUB_BUCKET_BITS };
+    static constexpr size_t MAX_EXPONENT { 36 };
+    static constexpr size_t BUCKET_NUM { (MAX_EXPONENT - SUB_BUCKET_BITS + 2) * SUB_BUCKET_NUM };
+
+    LatencyHistogram() = default;
+    ~LatencyHistogram() = default;
+    DISALLOW_COPY_AND_MOVE(LatencyHistogram);
+
+    void Record(int64_t value);
+    void Reset();
+    uint64_t GetCount() const;
+    int64_t GetTotal() const;
+    int64_t GetMin() const;
+    int64_t GetMax() const;
+    int64_t GetPercentile(double percentile) const;
+
+    static size_t GetBucketIndex(int64_t value);
+    static int64_t GetBucketUpperBound(size_t index);
+
+private:
+    std::array<std::atomic<uint64_t>, BUCKET_NUM> buckets_ {};
+    std::atomic<uint64_t> count_ { 0 };
+    std::atomic<int64_t> total_ { 0 };
+    std::atomic<int64_t> min_ { std::numeric_limits<int64_t>::max() };
+    std::atomic<int64_t> max_ { 0 };
+};
+
+// Counts non-zero error codes in a fixed number of slots claimed on first use.
+// Codes arriving after all slots are taken are accumulated as overflow.
+class ErrorCodeCounter final {
+public:
+    static constexpr size_t SLOT_NUM { 8 };
+
+    ErrorCodeCounter() = default;
+    ~ErrorCodeCounter() = default;
+    DISALLOW_COPY_AND_MOVE(ErrorCodeCounter);
+
+    void Record(int32_t errCode);
+    void Reset();
+    uint64_t GetOverflow() const;
+    std::vector<std::pair<int32_t, uint64_t>> GetCounts() const;
+
+private:
+    static constexpr int32_t EMPTY_CODE { 0 };
+
+    std::array<std::atomic<int32_t>, SLOT_NUM> codes_ {};
+    std::array<std::atomic<uint64_t>, SLOT_NUM> counts_ {};
+    std::atomic<uint64_t> overflow_ { 0 };
+};
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+#endif // LATENCY_HISTOGRAM_H
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NAPI_EVENT_DISPATCHER_H
+#define NAPI_EVENT_DISPATCHER_H
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "napi/native_api.h"
+#include "napi/native_node_api.h"
+#include "nocopyable.h"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+enum class CoalescePolicy : int32_t {
+    // Only the most recent pending event of a (module, type) is delivered.
+    LATEST_WINS,
+    // Pending events of a (module, type) are delivered in order, the oldest dropped when full.
+    BOUNDED_QUEUE,
+};
+
+struct NapiEventStats {
+    uint64_t posted { 0 };
+    uint64_t coalesced { 0 };
+    uint64_t dropped { 0 };
+    uint64_t delivered { 0 };
+    uint64_t batches { 0 };
+};
+
+// Thread-safe pending set of JS tasks keyed by (module, type), independent of napi so it can
+// be exercised without a JS engine. Keys keep the order in which they first became pending.
+class NapiEventCoalescer final {
+public:
+    using Task = std::function<void()>;
+    static constexpr size_t DEFAULT_QUEUE_CAPACITY { 16 };
+
+    NapiEventCoalescer() = default;
+    ~NapiEventCoalescer() = default;
+    DISALLOW_COPY_AND_MOVE(NapiEventCoalescer);
+
+    // Returns true when the caller has to schedule a delivery, i.e. nothing was pending before.
+    bool Push(const std::string &module, int32_t type, Task task,
+        CoalescePolicy policy = CoalescePolicy::LATEST_WINS, size_t capacity = DEFAULT_QUEUE_CAPACITY);
+    std::vector<Task> TakeBatch();
+    // Drops everything pending, e.g. when the delivery could not be scheduled.
+    void Discard();
+    NapiEventStats GetStats() const;
+
+private:
+    mutable std::mutex mutex_;
+    std::map<std::pair<std::string, int32_t>, size_t> index_;
+    std::vector<std::deque<Task>> slots_;
+    bool scheduled_ { false };
+    NapiEventStats stats_;
+};
+
+// One dispatcher per napi_env shared by all awareness modules loaded into that env. Native
+// callbacks post into it from any thread, and a whole batch is handed to the JS thread with a
+// single napi_send_event, so event storms cost one JS queue entry instead of one per callback.
+class NapiEventDispatcher final : public std::enable_shared_from_this<NapiEventDispatcher> {
+public:
+    // Must be called on the JS thread of env, typically when a listener is created.
+    static std::shared_ptr<NapiEventDispatcher> GetInstance(napi_env env);
+
+    explicit NapiEventDispatcher(napi_env env);
+    ~NapiEventDispatcher() = default;
+    DISALLOW_COPY_AND_MOVE(NapiEventDispatcher);
+
+    bool Post(const std::string &module, int32_t type, NapiEventCoalescer::Task task,
+        CoalescePolicy policy = CoalescePolicy::LATEST_WINS,
+        size_t capacity = NapiEventCoalescer::DEFAULT_QUEUE_CAPACITY);
+    NapiEventStats GetStats() const;
+
+private:
+    static void OnEnvCleanup(void *arg);
+    void Deliver();
+
+    napi_env env_ { nullptr };
+    // Makes checking closed_ and scheduling a delivery atomic with respect to env teardown.
+    std::mutex postMutex_;
+    std::atomic_bool closed_ { false };
+    NapiEventCoalescer coalescer_;
+};
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+#endif // NAPI_EVENT_DISPATCHER_H
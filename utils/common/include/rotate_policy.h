@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ROTATE_POLICY_H
+#define ROTATE_POLICY_H
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+enum class FoldPosture : uint8_t {
+    UNKNOWN = 0,
+    FOLDED,
+    EXPANDED,
+    POSTURE_COUNT,
+};
+
+// Rotate policy of the device, parsed once from system parameters. Whether the screen, rather than
+// the drag window, rotates is then a table lookup by foldable and fold posture.
+class RotatePolicy final {
+public:
+    static const RotatePolicy& GetInstance();
+
+    RotatePolicy(int32_t rotatePolicy, const std::string &foldRotatePolicy, const std::string &foldScreenType);
+    ~RotatePolicy() = default;
+
+    // Rotate policy is screen rotation, whatever the device.
+    bool IsScreenRotation() const;
+    bool IsScreenRotation(bool isFoldable, FoldPosture posture) const;
+    // Fold rotate policy has an entry for each posture.
+    bool IsFoldPolicyValid() const;
+    bool IsSecondaryDevice() const;
+
+    // Takes Rosen::FoldStatus, and keeps this header free of window manager.
+    template<typename FoldStatus>
+    FoldPosture GetFoldPosture(FoldStatus foldStatus) const;
+
+private:
+    using PostureTable = std::array<bool, static_cast<size_t>(FoldPosture::POSTURE_COUNT)>;
+
+    bool isScreenRotation_ { false };
+    bool isFoldPolicyValid_ { false };
+    bool isSecondaryDevice_ { false };
+    // Indexed by foldable, then by posture.
+    std::array<PostureTable, 2> screenRotation_ {};
+};
+
+template<typename FoldStatus>
+FoldPosture RotatePolicy::GetFoldPosture(FoldStatus foldStatus) const
+{
+    switch (foldStatus) {
+        case FoldStatus::EXPAND:
+        case FoldStatus::HALF_FOLD: {
+            return FoldPosture::EXPANDED;
+        }
+        case FoldStatus::FOLDED: {
+            return FoldPosture::FOLDED;
+        }
+        case FoldStatus::FOLD_STATE_EXPAND_WITH_SECOND_EXPAND:
+        case FoldStatus::FOLD_STATE_EXPAND_WITH_SECOND_HALF_FOLDED:
+        case FoldStatus::FOLD_STATE_HALF_FOLDED_WITH_SECOND_EXPAND:
+        case FoldStatus::FOLD_STATE_HALF_FOLDED_WITH_SECOND_HALF_FOLDED: {
+            return isSecondaryDevice_ ? FoldPosture::EXPANDED : FoldPosture::UNKNOWN;
+        }
+        case FoldStatus::FOLD_STATE_FOLDED_WITH_SECOND_EXPAND:
+        case FoldStatus::FOLD_STATE_FOLDED_WITH_SECOND_HALF_FOLDED: {
+            return isSecondaryDevice_ ? FoldPosture::FOLDED : FoldPosture::UNKNOWN;
+        }
+        default: {
+            return FoldPosture::UNKNOWN;
+        }
+    }
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+#endif // ROTATE_POLICY_H
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TRUSTED_DEVICE_SNAPSHOT_H
+#define TRUSTED_DEVICE_SNAPSHOT_H
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "nocopyable.h"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+// Local copy of the trusted device list of the distributed device manager, keyed by networkId.
+// It is only consulted while the device state callback is registered (tracking), and a full
+// list synced from a live query is discarded if any state change raced with that query.
+class TrustedDeviceSnapshot final {
+public:
+    static constexpr std::chrono::milliseconds DEFAULT_MAX_STALENESS { 300000 };
+
+    static TrustedDeviceSnapshot& GetInstance();
+
+    TrustedDeviceSnapshot() = default;
+    ~TrustedDeviceSnapshot() = default;
+    DISALLOW_COPY_AND_MOVE(TrustedDeviceSnapshot);
+
+    void StartTracking();
+    void StopTracking();
+    uint64_t GetGeneration();
+    void Sync(uint64_t generation, const std::vector<std::string> &networkIds);
+    void OnDeviceOnline(const std::string &networkId);
+    void OnDeviceOffline(const std::string &networkId);
+    bool Lookup(const std::string &networkId, bool &trusted);
+    // A zero bound disables the staleness check.
+    void SetMaxStaleness(std::chrono::milliseconds maxStaleness);
+
+private:
+    std::mutex mutex_;
+    bool tracking_ { false };
+    bool synced_ { false };
+    uint64_t generation_ { 0 };
+    std::chrono::steady_clock::time_point syncTime_ {};
+    std::chrono::milliseconds maxStaleness_ { DEFAULT_MAX_STALENESS };
+    std::unordered_set<std::string> networkIds_;
+};
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+#endif // TRUSTED_DEVICE_SNAPSHOT_H
@@ -164,8 +164,6 @@ bool IsValidPath(const std::string &rootDir, const std::string &filePath);
 bool IsValidSvgPath(const std::string &filePath);
 bool IsValidSvgFile(const std::string &filePath);
 bool IsNum(const std::string &str);
-void GetRotatePolicy(bool &isScreenRotation, std::vector<std::string> &foldRotatePolicys);
-bool IsSecondaryDevice();
 bool IsValidJsonPath(const std::string &filePath);
 bool IsFileExists(const std::string &fileName);
 std::string ReadFile(const std::string &filePath);
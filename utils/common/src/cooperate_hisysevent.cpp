@@ -77,6 +77,38 @@ void CooperateRadar::ReportTransmissionLatencyRadarInfo(
         "TOUCHPAD_SPEED_EVET", transmissionLatencyRadarInfo.touchPadSpeed);
 }
 
+void CooperateRadar::ReportTransmissionLatencySummary(struct TransmissionLatencySummary &summary)
+{
+    if (summary.sampleCount <= 0) {
+        FI_HILOGD("No transmission latency samples in window");
+        return;
+    }
+    HiSysEventWrite(
+        OHOS::HiviewDFX::HiSysEvent::Domain::MSDP,
+        COOPERTATE_BEHAVIOR,
+        HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+        "ORG_PKG", ORG_PKG_NAME,
+        "FUNC", summary.funcName,
+        "BIZ_STATE", summary.bizState,
+        "BIZ_STAGE", summary.bizStage,
+        "STAGE_RES", summary.stageRes,
+        "BIZ_SCENE", summary.bizScene,
+        "LOCAL_NET_ID", summary.localNetId,
+        "PEER_NET_ID", summary.peerNetId,
+        "LATENCY_WINDOW", summary.windowMs,
+        "LATENCY_SAMPLE_CNT", summary.sampleCount,
+        "LATENCY_EXCEED_CNT", summary.exceedCount,
+        "DRIVE_INTERCEPTOR_P50", summary.driveInterceptorP50,
+        "DRIVE_INTERCEPTOR_P99", summary.driveInterceptorP99,
+        "DRIVE_INTERCEPTOR_MAX", summary.driveInterceptorMax,
+        "TRANSMISSION_P50", summary.transmissionP50,
+        "TRANSMISSION_P99", summary.transmissionP99,
+        "TRANSMISSION_MAX", summary.transmissionMax,
+        "RADAR_DROP_CNT", summary.dropCount,
+        "POINTER_SPEED_EVENT", summary.pointerSpeed,
+        "TOUCHPAD_SPEED_EVET", summary.touchPadSpeed);
+}
+
 } // namespace DeviceStatus
 } // namespace Msdp
 } // namespace OHOS
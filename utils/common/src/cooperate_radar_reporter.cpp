@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cooperate_radar_reporter.h"
+
+#include <cinttypes>
+
+#include "devicestatus_define.h"
+#include "util.h"
+#include "utility.h"
+
+#undef LOG_TAG
+#define LOG_TAG "CooperateRadarReporter"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace {
+constexpr std::chrono::milliseconds DRAIN_INTERVAL { 1000 };
+constexpr std::chrono::milliseconds LATENCY_WINDOW { 60000 };
+constexpr int64_t RATE_WINDOW_MS { 1000 };
+constexpr double MEDIAN { 50.0 };
+constexpr double P99 { 99.0 };
+constexpr char LATENCY_SUMMARY_FUNC[] { "CheckLatency" };
+
+int64_t GetSteadyTimeMs()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+} // namespace
+
+void HiSysEventRadarSink::OnCooperateRadarInfo(CooperateRadarInfo &radarInfo)
+{
+    CooperateRadar::ReportCooperateRadarInfo(radarInfo);
+}
+
+void HiSysEventRadarSink::OnTransmissionLatencySummary(TransmissionLatencySummary &summary)
+{
+    CooperateRadar::ReportTransmissionLatencySummary(summary);
+}
+
+CooperateRadarReporter& CooperateRadarReporter::GetInstance()
+{
+    static CooperateRadarReporter instance;
+    return instance;
+}
+
+CooperateRadarReporter::~CooperateRadarReporter()
+{
+    running_.store(false);
+    cv_.notify_all();
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+}
+
+void CooperateRadarReporter::SetSink(std::shared_ptr<IRadarSink> sink)
+{
+    std::lock_guard guard(mutex_);
+    sink_ = sink;
+}
+
+void CooperateRadarReporter::Report(const CooperateRadarInfo &radarInfo)
+{
+    if (!AcquireToken() || !queue_.Push(radarInfo)) {
+        dropCount_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    StartWorker();
+}
+
+void CooperateRadarReporter::BeginLatencySession(const std::string &localNetworkId,
+    const std::string &peerNetworkId, int32_t pointerSpeed, int32_t touchPadSpeed)
+{
+    std::string localNetId = Utility::DFXRadarAnonymize(localNetworkId.c_str());
+    std::string peerNetId = Utility::DFXRadarAnonymize(peerNetworkId.c_str());
+    std::optional<TransmissionLatencySummary> summary;
+    std::shared_ptr<IRadarSink> sink;
+    {
+        std::lock_guard guard(mutex_);
+        // Samples of the previous peer are summarized under the identities they were taken with.
+        summary = CollectLatencySummary(true);
+        sink = sink_;
+        localNetId_ = std::move(localNetId);
+        peerNetId_ = std::move(peerNetId);
+        pointerSpeed_ = pointerSpeed;
+        touchPadSpeed_ = touchPadSpeed;
+    }
+    EmitLatencySummary(sink, summary);
+    StartWorker();
+}
+
+void CooperateRadarReporter::RecordLatency(int64_t driveToInterceptor, int64_t interceptorToTransmission)
+{
+    driveToInterceptor_.Record(driveToInterceptor);
+    interceptorToTransmission_.Record(interceptorToTransmission);
+    if ((driveToInterceptor > DRIVE_INTERCEPTOR_LATENCY) ||
+        (interceptorToTransmission > INTERCEPTOR_TRANSMISSION_LATENCY)) {
+        exceedCount_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void CooperateRadarReporter::Flush()
+{
+    std::optional<TransmissionLatencySummary> summary;
+    std::shared_ptr<IRadarSink> sink;
+    {
+        std::lock_guard guard(mutex_);
+        Drain();
+        summary = CollectLatencySummary(true);
+        sink = sink_;
+    }
+    EmitLatencySummary(sink, summary);
+}
+
+uint64_t CooperateRadarReporter::GetDropCount() const
+{
+    return dropCount_.load(std::memory_order_relaxed);
+}
+
+void CooperateRadarReporter::StartWorker()
+{
+    std::call_once(workerFlag_, [this] {
+        running_.store(true);
+        worker_ = std::thread([this] { Worker(); });
+    });
+}
+
+void CooperateRadarReporter::Worker()
+{
+    SetThreadName("os_radar_reporter");
+    std::unique_lock lock(mutex_);
+    while (running_.load()) {
+        cv_.wait_for(lock, DRAIN_INTERVAL);
+        Drain();
+        std::optional<TransmissionLatencySummary> summary = CollectLatencySummary(false);
+        if (summary.has_value()) {
+            std::shared_ptr<IRadarSink> sink = sink_;
+            lock.unlock();
+            EmitLatencySummary(sink, summary);
+            lock.lock();
+        }
+    }
+}
+
+void CooperateRadarReporter::Drain()
+{
+    CooperateRadarInfo radarInfo;
+    while (queue_.Pop(radarInfo)) {
+        if (sink_ != nullptr) {
+            sink_->OnCooperateRadarInfo(radarInfo);
+        }
+    }
+    uint64_t dropCount = dropCount_.load(std::memory_order_relaxed);
+    if (dropCount != loggedDropCount_) {
+        FI_HILOGW("%{public}" PRIu64 " radar events dropped", dropCount - loggedDropCount_);
+        loggedDropCount_ = dropCount;
+    }
+}
+
+std::optional<TransmissionLatencySummary> CooperateRadarReporter::CollectLatencySummary(bool force)
+{
+    auto now = std::chrono::steady_clock::now();
+    if (!force && (now - windowStart_ < LATENCY_WINDOW)) {
+        return std::nullopt;
+    }
+    auto windowMs = std::chrono::duration_cast<std::chrono::milliseconds>(now - windowStart_).count();
+    windowStart_ = now;
+    uint64_t exceedCount = exceedCount_.exchange(0, std::memory_order_relaxed);
+    if (exceedCount == 0) {
+        driveToInterceptor_.Reset();
+        interceptorToTransmission_.Reset();
+        return std::nullopt;
+    }
+    uint64_t dropCount = dropCount_.load(std::memory_order_relaxed);
+    TransmissionLatencySummary summary {
+        .funcName = LATENCY_SUMMARY_FUNC,
+        .bizState = static_cast<int32_t>(BizState::STATE_END),
+        .bizStage = static_cast<int32_t>(BizCooperateStage::STAGE_CLIENT_ON_MESSAGE_RCVD),
+        .stageRes = static_cast<int32_t>(BizCooperateStageRes::RES_IDLE),
+        .bizScene = static_cast<int32_t>(BizCooperateScene::SCENE_LATENCY),
+        .localNetId = localNetId_,
+        .peerNetId = peerNetId_,
+        .windowMs = windowMs,
+        .sampleCount = static_cast<int64_t>(driveToInterceptor_.GetCount()),
+        .exceedCount = static_cast<int64_t>(exceedCount),
+        .driveInterceptorP50 = driveToInterceptor_.GetPercentile(MEDIAN),
+        .driveInterceptorP99 = driveToInterceptor_.GetPercentile(P99),
+        .driveInterceptorMax = driveToInterceptor_.GetMax(),
+        .transmissionP50 = interceptorToTransmission_.GetPercentile(MEDIAN),
+        .transmissionP99 = interceptorToTransmission_.GetPercentile(P99),
+        .transmissionMax = interceptorToTransmission_.GetMax(),
+        .dropCount = static_cast<int64_t>(dropCount - reportedDropCount_),
+        .pointerSpeed = pointerSpeed_,
+        .touchPadSpeed = touchPadSpeed_,
+    };
+    // Samples recorded while the window is being read may land in either window; the
+    // summary is statistical, so the cooperate worker is never made to wait for it.
+    driveToInterceptor_.Reset();
+    interceptorToTransmission_.Reset();
+    reportedDropCount_ = dropCount;
+    return summary;
+}
+
+void CooperateRadarReporter::EmitLatencySummary(std::shared_ptr<IRadarSink> sink,
+    std::optional<TransmissionLatencySummary> &summary)
+{
+    if ((sink != nullptr) && summary.has_value()) {
+        sink->OnTransmissionLatencySummary(summary.value());
+    }
+}
+
+bool CooperateRadarReporter::AcquireToken()
+{
+    int64_t now = GetSteadyTimeMs();
+    int64_t windowStart = rateWindowStart_.load(std::memory_order_relaxed);
+    if ((now - windowStart >= RATE_WINDOW_MS) &&
+        rateWindowStart_.compare_exchange_strong(windowStart, now, std::memory_order_relaxed)) {
+        rateWindowCount_.store(0, std::memory_order_relaxed);
+    }
+    return (rateWindowCount_.fetch_add(1, std::memory_order_relaxed) < MAX_EVENTS_PER_SECOND);
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
@@ -18,6 +18,7 @@
 #include "devicestatus_common.h"
 #include "devicestatus_define.h"
 #include "devicestatus_errors.h"
+#include "drag_style_params.h"
 
 #undef LOG_TAG
 #define LOG_TAG "DragDataPacker"
@@ -26,6 +27,16 @@ namespace OHOS {
 namespace Msdp {
 namespace DeviceStatus {
 constexpr int32_t MAX_BUF_SIZE { 1024 };
+constexpr size_t MAX_DROP_AREA_SIZE { 100 };
+constexpr size_t N_FILTER_FLOATS { 17 };
+
+enum DragFilterFlag : uint32_t {
+    FLAG_SHADOW_ENABLE = 1U << 0,
+    FLAG_SHADOW_IS_FILLED = 1U << 1,
+    FLAG_SHADOW_MASK = 1U << 2,
+    FLAG_HARDWARE_ACCELERATION = 1U << 3,
+    FLAG_ENABLE_ANIMATION = 1U << 4,
+};
 
 int32_t DragDataPacker::MarshallingDetailedSummarys(const DragData &dragData, Parcel &data)
 {
@@ -111,6 +122,50 @@ int32_t DragDataPacker::UnMarshallingDragAnimationType(Parcel &data, DragData &d
     return RET_OK;
 }
 
+int32_t DragDataPacker::MarshallingStyleParams(const DragData &dragData, Parcel &data)
+{
+    const DragData *parsed = &dragData;
+    DragData copy;
+    if (dragData.styleParamsVersion != DRAG_STYLE_PARAMS_VERSION) {
+        copy.filterInfo = dragData.filterInfo;
+        copy.extraInfo = dragData.extraInfo;
+        DragStyleParamsParser::Parse(copy);
+        parsed = &copy;
+    }
+    WRITEINT32(data, DRAG_STYLE_PARAMS_VERSION, RET_ERR);
+    if (DragStyleParamsPacker::Marshalling(parsed->filterParams, data) != RET_OK) {
+        FI_HILOGE("Marshalling filterParams failed");
+        return RET_ERR;
+    }
+    if (DragStyleParamsPacker::Marshalling(parsed->extraParams, data) != RET_OK) {
+        FI_HILOGE("Marshalling extraParams failed");
+        return RET_ERR;
+    }
+    return RET_OK;
+}
+
+int32_t DragDataPacker::UnMarshallingStyleParams(Parcel &data, DragData &dragData)
+{
+    dragData.styleParamsVersion = 0;
+    if (data.GetReadableBytes() == 0) {
+        FI_HILOGD("No style params, fall back to filterInfo and extraInfo");
+        return RET_OK;
+    }
+    int32_t version = 0;
+    READINT32(data, version, RET_ERR);
+    if (version != DRAG_STYLE_PARAMS_VERSION) {
+        FI_HILOGW("Unsupported style params version:%{public}d", version);
+        return RET_OK;
+    }
+    if ((DragStyleParamsPacker::UnMarshalling(data, dragData.filterParams) != RET_OK) ||
+        (DragStyleParamsPacker::UnMarshalling(data, dragData.extraParams) != RET_OK)) {
+        FI_HILOGE("UnMarshalling style params failed");
+        return RET_ERR;
+    }
+    dragData.styleParamsVersion = version;
+    return RET_OK;
+}
+
 int32_t DragDataPacker::MarshallingMaterialFilter(const DragData &dragData, Parcel &data)
 {
     if (!(data).WriteBool(dragData.isSetMaterialFilter)) {
@@ -234,6 +289,101 @@ int32_t DragDataPacker::CheckDragData(const DragData &dragData)
     return RET_OK;
 }
 
+int32_t DragStyleParamsPacker::Marshalling(const DragFilterParams &filterParams, Parcel &data)
+{
+    uint32_t flags = (filterParams.shadowEnable ? FLAG_SHADOW_ENABLE : 0U) |
+        (filterParams.shadowIsFilled ? FLAG_SHADOW_IS_FILLED : 0U) |
+        (filterParams.shadowMask ? FLAG_SHADOW_MASK : 0U) |
+        (filterParams.isHardwareAcceleration ? FLAG_HARDWARE_ACCELERATION : 0U) |
+        (filterParams.enableAnimation ? FLAG_ENABLE_ANIMATION : 0U);
+    WRITESTRING(data, filterParams.dragType, RET_ERR);
+    WRITESTRING(data, filterParams.shadowPath, RET_ERR);
+    WRITEUINT32(data, filterParams.fieldMask, RET_ERR);
+    WRITEUINT32(data, flags, RET_ERR);
+    WRITEINT32(data, filterParams.shadowColorStrategy, RET_ERR);
+    WRITEINT32(data, filterParams.blurStyle, RET_ERR);
+    WRITEINT32(data, filterParams.eventId, RET_ERR);
+    WRITEUINT32(data, filterParams.shadowArgb, RET_ERR);
+    WRITEUINT32(data, filterParams.blurColor, RET_ERR);
+    std::vector<float> values {
+        filterParams.dipScale, filterParams.scale, filterParams.cornerRadius1, filterParams.cornerRadius2,
+        filterParams.cornerRadius3, filterParams.cornerRadius4, filterParams.opacity, filterParams.shadowOffsetX,
+        filterParams.shadowOffsetY, filterParams.shadowCorner, filterParams.shadowElevation, filterParams.blurCoef1,
+        filterParams.blurCoef2, filterParams.blurRadius, filterParams.blurSaturation, filterParams.blurBrightness,
+        filterParams.dragNodeGrayscale,
+    };
+    WRITEFLOATVECTOR(data, values, RET_ERR);
+    return RET_OK;
+}
+
+int32_t DragStyleParamsPacker::UnMarshalling(Parcel &data, DragFilterParams &filterParams)
+{
+    uint32_t flags = 0;
+    READSTRING(data, filterParams.dragType, RET_ERR);
+    READSTRING(data, filterParams.shadowPath, RET_ERR);
+    READUINT32(data, filterParams.fieldMask, RET_ERR);
+    READUINT32(data, flags, RET_ERR);
+    READINT32(data, filterParams.shadowColorStrategy, RET_ERR);
+    READINT32(data, filterParams.blurStyle, RET_ERR);
+    READINT32(data, filterParams.eventId, RET_ERR);
+    READUINT32(data, filterParams.shadowArgb, RET_ERR);
+    READUINT32(data, filterParams.blurColor, RET_ERR);
+    std::vector<float> values;
+    READFLOATVECTOR(data, values, RET_ERR);
+    if (values.size() != N_FILTER_FLOATS) {
+        FI_HILOGE("Unexpected number of filter values:%{public}zu", values.size());
+        return RET_ERR;
+    }
+    filterParams.shadowEnable = ((flags & FLAG_SHADOW_ENABLE) != 0);
+    filterParams.shadowIsFilled = ((flags & FLAG_SHADOW_IS_FILLED) != 0);
+    filterParams.shadowMask = ((flags & FLAG_SHADOW_MASK) != 0);
+    filterParams.isHardwareAcceleration = ((flags & FLAG_HARDWARE_ACCELERATION) != 0);
+    filterParams.enableAnimation = ((flags & FLAG_ENABLE_ANIMATION) != 0);
+    size_t index = 0;
+    for (float *value : { &filterParams.dipScale, &filterParams.scale, &filterParams.cornerRadius1,
+        &filterParams.cornerRadius2, &filterParams.cornerRadius3, &filterParams.cornerRadius4, &filterParams.opacity,
+        &filterParams.shadowOffsetX, &filterParams.shadowOffsetY, &filterParams.shadowCorner,
+        &filterParams.shadowElevation, &filterParams.blurCoef1, &filterParams.blurCoef2, &filterParams.blurRadius,
+        &filterParams.blurSaturation, &filterParams.blurBrightness, &filterParams.dragNodeGrayscale }) {
+        *value = values[index++];
+    }
+    return RET_OK;
+}
+
+int32_t DragStyleParamsPacker::Marshalling(const DragExtraParams &extraParams, Parcel &data)
+{
+    if (extraParams.dropArea.size() > MAX_DROP_AREA_SIZE) {
+        FI_HILOGE("Too large dropArea, size:%{public}zu", extraParams.dropArea.size());
+        return RET_ERR;
+    }
+    WRITESTRING(data, extraParams.componentType, RET_ERR);
+    WRITEBOOL(data, extraParams.hasDropArea, RET_ERR);
+    WRITEINT32VECTOR(data, extraParams.dropArea, RET_ERR);
+    WRITEBOOL(data, extraParams.allowDistributed, RET_ERR);
+    WRITEINT32(data, extraParams.blurStyle, RET_ERR);
+    WRITEFLOAT(data, extraParams.cornerRadius, RET_ERR);
+    WRITEFLOAT(data, extraParams.blurCoef1, RET_ERR);
+    WRITEFLOAT(data, extraParams.blurCoef2, RET_ERR);
+    return RET_OK;
+}
+
+int32_t DragStyleParamsPacker::UnMarshalling(Parcel &data, DragExtraParams &extraParams)
+{
+    READSTRING(data, extraParams.componentType, RET_ERR);
+    READBOOL(data, extraParams.hasDropArea, RET_ERR);
+    READINT32VECTOR(data, extraParams.dropArea, RET_ERR);
+    if (extraParams.dropArea.size() > MAX_DROP_AREA_SIZE) {
+        FI_HILOGE("Too large dropArea, size:%{public}zu", extraParams.dropArea.size());
+        return RET_ERR;
+    }
+    READBOOL(data, extraParams.allowDistributed, RET_ERR);
+    READINT32(data, extraParams.blurStyle, RET_ERR);
+    READFLOAT(data, extraParams.cornerRadius, RET_ERR);
+    READFLOAT(data, extraParams.blurCoef1, RET_ERR);
+    READFLOAT(data, extraParams.blurCoef2, RET_ERR);
+    return RET_OK;
+}
+
 int32_t ShadowPacker::Marshalling(const std::vector<ShadowInfo> &shadowInfos, Parcel &data, bool isCross)
 {
     CALL_DEBUG_ENTER;
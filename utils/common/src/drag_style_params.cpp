@@ -0,0 +1,327 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "drag_style_params.h"
+
+#include <cmath>
+#include <memory>
+
+#include "cJSON.h"
+
+#include "devicestatus_define.h"
+
+#undef LOG_TAG
+#define LOG_TAG "DragStyleParams"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace {
+constexpr uint64_t FNV_OFFSET_BASIS { 0xcbf29ce484222325ULL };
+constexpr uint64_t FNV_PRIME { 0x100000001b3ULL };
+constexpr size_t MAX_CACHE_ENTRIES { 16 };
+constexpr int32_t MAX_DROP_AREA_SIZE { 100 };
+constexpr double MIN_OPACITY { 0.0 };
+constexpr double MAX_OPACITY { 1.0 };
+
+using JsonPtr = std::unique_ptr<cJSON, decltype(&cJSON_Delete)>;
+
+bool GetFloat(const cJSON *json, const char *key, float &value)
+{
+    cJSON *item = cJSON_GetObjectItemCaseSensitive(json, key);
+    if (!cJSON_IsNumber(item)) {
+        return false;
+    }
+    value = static_cast<float>(item->valuedouble);
+    return true;
+}
+
+bool GetInt32(const cJSON *json, const char *key, int32_t &value)
+{
+    cJSON *item = cJSON_GetObjectItemCaseSensitive(json, key);
+    if (!cJSON_IsNumber(item)) {
+        return false;
+    }
+    value = item->valueint;
+    return true;
+}
+
+void GetUint32(const cJSON *json, const char *key, uint32_t &value)
+{
+    cJSON *item = cJSON_GetObjectItemCaseSensitive(json, key);
+    if (cJSON_IsNumber(item)) {
+        value = static_cast<uint32_t>(item->valueint);
+    }
+}
+
+void GetBool(const cJSON *json, const char *key, bool &value)
+{
+    cJSON *item = cJSON_GetObjectItemCaseSensitive(json, key);
+    if (cJSON_IsBool(item)) {
+        value = cJSON_IsTrue(item);
+    }
+}
+
+void GetString(const cJSON *json, const char *key, std::string &value)
+{
+    cJSON *item = cJSON_GetObjectItemCaseSensitive(json, key);
+    if (cJSON_IsString(item)) {
+        value = item->valuestring;
+    }
+}
+
+bool GetInt32Array(const cJSON *json, const char *key, std::vector<int32_t> &value)
+{
+    cJSON *array = cJSON_GetObjectItemCaseSensitive(json, key);
+    if (!cJSON_IsArray(array) || (cJSON_GetArraySize(array) > MAX_DROP_AREA_SIZE)) {
+        return false;
+    }
+    std::vector<int32_t> values;
+    cJSON *item = nullptr;
+    cJSON_ArrayForEach(item, array) {
+        if (!cJSON_IsNumber(item) || (std::trunc(item->valuedouble) != item->valuedouble)) {
+            return false;
+        }
+        values.push_back(item->valueint);
+    }
+    value = std::move(values);
+    return true;
+}
+
+void ParseShadow(const cJSON *json, DragFilterParams &filterParams)
+{
+    GetFloat(json, "drag_shadow_offsetX", filterParams.shadowOffsetX);
+    GetFloat(json, "drag_shadow_offsetY", filterParams.shadowOffsetY);
+    GetUint32(json, "drag_shadow_argb", filterParams.shadowArgb);
+    GetBool(json, "shadow_is_filled", filterParams.shadowIsFilled);
+    GetBool(json, "shadow_mask", filterParams.shadowMask);
+    GetInt32(json, "shadow_color_strategy", filterParams.shadowColorStrategy);
+    GetBool(json, "shadow_is_hardwareacceleration", filterParams.isHardwareAcceleration);
+    if (filterParams.isHardwareAcceleration) {
+        GetFloat(json, "shadow_elevation", filterParams.shadowElevation);
+    } else {
+        GetFloat(json, "shadow_corner", filterParams.shadowCorner);
+    }
+    if (filterParams.dragType == "text") {
+        GetString(json, "drag_shadow_path", filterParams.shadowPath);
+    }
+}
+
+void ParseBlur(const cJSON *json, DragFilterParams &filterParams)
+{
+    cJSON *opacity = cJSON_GetObjectItemCaseSensitive(json, "dip_opacity");
+    if (cJSON_IsNumber(opacity)) {
+        if ((opacity->valuedouble > MAX_OPACITY) || (opacity->valuedouble <= MIN_OPACITY)) {
+            FI_HILOGE("Parser opacity limits abnormal, opacity:%{public}f", opacity->valuedouble);
+        } else {
+            filterParams.opacity = static_cast<float>(opacity->valuedouble);
+        }
+    }
+    GetFloat(json, "blur_coef1", filterParams.blurCoef1);
+    GetFloat(json, "blur_coef2", filterParams.blurCoef2);
+    if (GetFloat(json, "blur_radius", filterParams.blurRadius)) {
+        filterParams.fieldMask |= DRAG_FILTER_BLUR_RADIUS;
+    }
+    GetFloat(json, "blur_staturation", filterParams.blurSaturation);
+    GetFloat(json, "blur_brightness", filterParams.blurBrightness);
+    GetUint32(json, "blur_color", filterParams.blurColor);
+    GetInt32(json, "blur_style", filterParams.blurStyle);
+}
+} // namespace
+
+int32_t DragStyleParamsParser::ParseFilterInfo(const std::string &filterInfo, DragFilterParams &filterParams)
+{
+    FI_HILOGD("FilterInfo size:%{public}zu, filterInfo:%{private}s", filterInfo.size(), filterInfo.c_str());
+    if (filterInfo.empty()) {
+        return RET_ERR;
+    }
+    JsonPtr json(cJSON_Parse(filterInfo.c_str()), cJSON_Delete);
+    if (!cJSON_IsObject(json.get())) {
+        FI_HILOGE("FilterInfo is not json object");
+        return RET_ERR;
+    }
+    DragFilterParams params;
+    if (GetFloat(json.get(), "dip_scale", params.dipScale)) {
+        params.fieldMask |= DRAG_FILTER_DIP_SCALE;
+    }
+    if (GetFloat(json.get(), "scale", params.scale)) {
+        params.fieldMask |= DRAG_FILTER_SCALE;
+    }
+    GetFloat(json.get(), "drag_corner_radius1", params.cornerRadius1);
+    GetFloat(json.get(), "drag_corner_radius2", params.cornerRadius2);
+    GetFloat(json.get(), "drag_corner_radius3", params.cornerRadius3);
+    GetFloat(json.get(), "drag_corner_radius4", params.cornerRadius4);
+    GetString(json.get(), "drag_type", params.dragType);
+    GetBool(json.get(), "shadow_enable", params.shadowEnable);
+    if (params.shadowEnable) {
+        ParseShadow(json.get(), params);
+    }
+    ParseBlur(json.get(), params);
+    GetFloat(json.get(), "drag_node_gray_scale", params.dragNodeGrayscale);
+    if (GetInt32(json.get(), "event_id", params.eventId)) {
+        params.fieldMask |= DRAG_FILTER_EVENT_ID;
+    }
+    GetBool(json.get(), "enable_animation", params.enableAnimation);
+    Sanitize(params);
+    filterParams = std::move(params);
+    return RET_OK;
+}
+
+int32_t DragStyleParamsParser::ParseExtraInfo(const std::string &extraInfo, DragExtraParams &extraParams)
+{
+    FI_HILOGD("ExtraInfo size:%{public}zu, extraInfo:%{private}s", extraInfo.size(), extraInfo.c_str());
+    if (extraInfo.empty()) {
+        return RET_ERR;
+    }
+    JsonPtr json(cJSON_Parse(extraInfo.c_str()), cJSON_Delete);
+    if (!cJSON_IsObject(json.get())) {
+        FI_HILOGE("ExtraInfo is not json object");
+        return RET_ERR;
+    }
+    DragExtraParams params;
+    GetString(json.get(), "drag_data_type", params.componentType);
+    GetInt32(json.get(), "drag_blur_style", params.blurStyle);
+    GetFloat(json.get(), "drag_corner_radius", params.cornerRadius);
+    GetBool(json.get(), "drag_allow_distributed", params.allowDistributed);
+    GetFloat(json.get(), "blur_coef1", params.blurCoef1);
+    GetFloat(json.get(), "blur_coef2", params.blurCoef2);
+    params.hasDropArea = GetInt32Array(json.get(), "dropArea", params.dropArea);
+    extraParams = std::move(params);
+    return RET_OK;
+}
+
+void DragStyleParamsParser::Parse(DragData &dragData)
+{
+    if (dragData.styleParamsVersion == DRAG_STYLE_PARAMS_VERSION) {
+        return;
+    }
+    dragData.filterParams = {};
+    dragData.extraParams = {};
+    if (!dragData.filterInfo.empty() && (ParseFilterInfo(dragData.filterInfo, dragData.filterParams) != RET_OK)) {
+        FI_HILOGW("No valid filterInfo");
+    }
+    if (!dragData.extraInfo.empty() && (ParseExtraInfo(dragData.extraInfo, dragData.extraParams) != RET_OK)) {
+        FI_HILOGW("No valid extraInfo");
+    }
+    dragData.styleParamsVersion = DRAG_STYLE_PARAMS_VERSION;
+}
+
+void DragStyleParamsParser::Sanitize(DragFilterParams &filterParams)
+{
+    const DragFilterParams defaults;
+    if (!filterParams.shadowEnable) {
+        filterParams.shadowOffsetX = defaults.shadowOffsetX;
+        filterParams.shadowOffsetY = defaults.shadowOffsetY;
+        filterParams.shadowArgb = defaults.shadowArgb;
+        filterParams.shadowIsFilled = defaults.shadowIsFilled;
+        filterParams.shadowMask = defaults.shadowMask;
+        filterParams.shadowColorStrategy = defaults.shadowColorStrategy;
+        filterParams.isHardwareAcceleration = defaults.isHardwareAcceleration;
+        filterParams.shadowElevation = defaults.shadowElevation;
+        filterParams.shadowCorner = defaults.shadowCorner;
+        filterParams.shadowPath.clear();
+    } else if (filterParams.isHardwareAcceleration) {
+        filterParams.shadowCorner = defaults.shadowCorner;
+    } else {
+        filterParams.shadowElevation = defaults.shadowElevation;
+    }
+    if (filterParams.dragType != "text") {
+        filterParams.shadowPath.clear();
+    }
+    if (!std::isfinite(filterParams.opacity) || (filterParams.opacity > MAX_OPACITY) ||
+        (filterParams.opacity <= MIN_OPACITY)) {
+        FI_HILOGE("Opacity limits abnormal, opacity:%{public}f", filterParams.opacity);
+        filterParams.opacity = defaults.opacity;
+    }
+    for (float DragFilterParams::*field : { &DragFilterParams::dipScale, &DragFilterParams::scale,
+        &DragFilterParams::cornerRadius1, &DragFilterParams::cornerRadius2, &DragFilterParams::cornerRadius3,
+        &DragFilterParams::cornerRadius4, &DragFilterParams::shadowOffsetX, &DragFilterParams::shadowOffsetY,
+        &DragFilterParams::shadowCorner, &DragFilterParams::shadowElevation, &DragFilterParams::blurCoef1,
+        &DragFilterParams::blurCoef2, &DragFilterParams::blurRadius, &DragFilterParams::blurSaturation,
+        &DragFilterParams::blurBrightness, &DragFilterParams::dragNodeGrayscale }) {
+        if (!std::isfinite(filterParams.*field)) {
+            filterParams.*field = defaults.*field;
+        }
+    }
+}
+
+DragStyleParamsCache& DragStyleParamsCache::GetInstance()
+{
+    static DragStyleParamsCache instance;
+    return instance;
+}
+
+uint64_t DragStyleParamsCache::HashString(const std::string &str)
+{
+    uint64_t hash = FNV_OFFSET_BASIS;
+    for (unsigned char ch : str) {
+        hash = (hash ^ ch) * FNV_PRIME;
+    }
+    return hash;
+}
+
+int32_t DragStyleParamsCache::GetFilterParams(const std::string &filterInfo, DragFilterParams &filterParams)
+{
+    return Get(filterEntries_, filterInfo, filterParams, &DragStyleParamsParser::ParseFilterInfo);
+}
+
+int32_t DragStyleParamsCache::GetExtraParams(const std::string &extraInfo, DragExtraParams &extraParams)
+{
+    return Get(extraEntries_, extraInfo, extraParams, &DragStyleParamsParser::ParseExtraInfo);
+}
+
+template<typename Params>
+int32_t DragStyleParamsCache::Get(Entries<Params> &entries, const std::string &json, Params &params,
+    int32_t (*parse)(const std::string&, Params&))
+{
+    uint64_t hash = HashString(json);
+    {
+        std::lock_guard lock(mutex_);
+        for (auto iter = entries.begin(); iter != entries.end(); ++iter) {
+            if ((iter->hash == hash) && (iter->json == json)) {
+                entries.splice(entries.begin(), entries, iter);
+                params = entries.front().params;
+                ++hitCount_;
+                return RET_OK;
+            }
+        }
+    }
+    if (parse(json, params) != RET_OK) {
+        return RET_ERR;
+    }
+    std::lock_guard lock(mutex_);
+    entries.push_front(Entry<Params> { .hash = hash, .json = json, .params = params });
+    if (entries.size() > MAX_CACHE_ENTRIES) {
+        entries.pop_back();
+    }
+    return RET_OK;
+}
+
+size_t DragStyleParamsCache::GetHitCount()
+{
+    std::lock_guard lock(mutex_);
+    return hitCount_;
+}
+
+void DragStyleParamsCache::Clear()
+{
+    std::lock_guard lock(mutex_);
+    filterEntries_.clear();
+    extraEntries_.clear();
+    hitCount_ = 0;
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
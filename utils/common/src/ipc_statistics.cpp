@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ipc_statistics.h"
+
+#include <unistd.h>
+
+#include "devicestatus_define.h"
+
+#undef LOG_TAG
+#define LOG_TAG "IpcStatistics"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace {
+constexpr double P50 { 50.0 };
+constexpr double P90 { 90.0 };
+constexpr double P99 { 99.0 };
+constexpr char UNKNOWN_SERVER[] { "Unknown" };
+
+void DumpHistogram(int32_t fd, const std::string &name, const LatencyHistogram &histogram)
+{
+    dprintf(fd, "  %-36s | count:%-8llu | p50:%-8lld | p90:%-8lld | p99:%-8lld | max:%lld\n", name.c_str(),
+        static_cast<unsigned long long>(histogram.GetCount()),
+        static_cast<long long>(histogram.GetPercentile(P50)),
+        static_cast<long long>(histogram.GetPercentile(P90)),
+        static_cast<long long>(histogram.GetPercentile(P99)),
+        static_cast<long long>(histogram.GetMax()));
+}
+} // namespace
+
+IpcStatistics& IpcStatistics::GetInstance()
+{
+    static IpcStatistics instance;
+    return instance;
+}
+
+void IpcStatistics::RegisterMethod(uint32_t code, const std::string &method, const std::string &server)
+{
+    if (code >= MAX_CODE) {
+        FI_HILOGE("Code:%{public}u of %{public}s is out of range", code, method.c_str());
+        return;
+    }
+    std::lock_guard lock(mutex_);
+    size_t index = FindServerLocked(server);
+    if (index == 0) {
+        if (serverNum_ >= MAX_SERVER_NUM) {
+            FI_HILOGW("Too many servers, %{public}s is counted as unknown", server.c_str());
+        } else {
+            index = serverNum_++;
+            servers_[index].server = server;
+        }
+    }
+    methods_[code].method = method;
+    methods_[code].server.store(index, std::memory_order_relaxed);
+}
+
+void IpcStatistics::Record(uint32_t code, int64_t costTime, int32_t result)
+{
+    if (code >= MAX_CODE) {
+        return;
+    }
+    MethodSlot &slot = methods_[code];
+    slot.costTime.Record(costTime);
+    slot.errorCodes.Record(result);
+    servers_[slot.server.load(std::memory_order_relaxed)].costTime.Record(costTime);
+}
+
+void IpcStatistics::Dump(int32_t fd)
+{
+    std::lock_guard lock(mutex_);
+    dprintf(fd, "IPC latency per method(us):\n");
+    for (uint32_t code = 0; code < MAX_CODE; ++code) {
+        const MethodSlot &slot = methods_[code];
+        if (slot.costTime.GetCount() == 0) {
+            continue;
+        }
+        DumpHistogram(fd, (slot.method.empty() ? std::to_string(code) : slot.method), slot.costTime);
+        for (const auto &[errCode, count] : slot.errorCodes.GetCounts()) {
+            dprintf(fd, "    error:%d count:%llu\n", errCode, static_cast<unsigned long long>(count));
+        }
+        if (uint64_t overflow = slot.errorCodes.GetOverflow(); overflow > 0) {
+            dprintf(fd, "    other errors count:%llu\n", static_cast<unsigned long long>(overflow));
+        }
+    }
+    dprintf(fd, "IPC latency per server(us):\n");
+    for (size_t index = 0; index < serverNum_; ++index) {
+        if (servers_[index].costTime.GetCount() > 0) {
+            DumpHistogram(fd, (index == 0 ? UNKNOWN_SERVER : servers_[index].server), servers_[index].costTime);
+        }
+    }
+}
+
+void IpcStatistics::Reset()
+{
+    for (auto &slot : methods_) {
+        slot.costTime.Reset();
+        slot.errorCodes.Reset();
+    }
+    for (auto &slot : servers_) {
+        slot.costTime.Reset();
+    }
+}
+
+const LatencyHistogram* IpcStatistics::GetMethodHistogram(uint32_t code) const
+{
+    return (code < MAX_CODE ? &methods_[code].costTime : nullptr);
+}
+
+const LatencyHistogram* IpcStatistics::GetServerHistogram(const std::string &server)
+{
+    std::lock_guard lock(mutex_);
+    size_t index = FindServerLocked(server);
+    return (index == 0 ? nullptr : &servers_[index].costTime);
+}
+
+size_t IpcStatistics::FindServerLocked(const std::string &server) const
+{
+    for (size_t index = 1; index < serverNum_; ++index) {
+        if (servers_[index].server == server) {
+            return index;
+        }
+    }
+    return 0;
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "latency_histogram.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace {
+constexpr double PERCENT { 100.0 };
+constexpr int32_t BITS_OF_INT64 { 64 };
+} // namespace
+
+void LatencyHistogram::Record(int64_t value)
+{
+    value = std::max<int64_t>(value, 0);
+    buckets_[GetBucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    total_.fetch_add(value, std::memory_order_relaxed);
+
+    int64_t current = max_.load(std::memory_order_relaxed);
+    while ((value > current) && !max_.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+    current = min_.load(std::memory_order_relaxed);
+    while ((value < current) && !min_.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+}
+
+void LatencyHistogram::Reset()
+{
+    for (auto &bucket : buckets_) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    count_.store(0, std::memory_order_relaxed);
+    total_.store(0, std::memory_order_relaxed);
+    min_.store(std::numeric_limits<int64_t>::max(), std::memory_order_relaxed);
+    max_.store(0, std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::GetCount() const
+{
+    return count_.load(std::memory_order_relaxed);
+}
+
+int64_t LatencyHistogram::GetTotal() const
+{
+    return total_.load(std::memory_order_relaxed);
+}
+
+int64_t LatencyHistogram::GetMin() const
+{
+    int64_t min = min_.load(std::memory_order_relaxed);
+    return (min == std::numeric_limits<int64_t>::max() ? 0 : min);
+}
+
+int64_t LatencyHistogram::GetMax() const
+{
+    return max_.load(std::memory_order_relaxed);
+}
+
+int64_t LatencyHistogram::GetPercentile(double percentile) const
+{
+    std::array<uint64_t, BUCKET_NUM> snapshot {};
+    uint64_t count = 0;
+    for (size_t index = 0; index < BUCKET_NUM; ++index) {
+        snapshot[index] = buckets_[index].load(std::memory_order_relaxed);
+        count += snapshot[index];
+    }
+    if (count == 0) {
+        return 0;
+    }
+    percentile = std::clamp(percentile, 0.0, PERCENT);
+    uint64_t target = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(percentile / PERCENT * count)));
+    uint64_t accumulated = 0;
+    for (size_t index = 0; index < BUCKET_NUM; ++index) {
+        accumulated += snapshot[index];
+        if (accumulated >= target) {
+            return std::min(GetBucketUpperBound(index), GetMax());
+        }
+    }
+    return GetMax();
+}
+
+size_t LatencyHistogram::GetBucketIndex(int64_t value)
+{
+    if (value < static_cast<int64_t>(SUB_BUCKET_NUM)) {
+        return static_cast<size_t>(std::max<int64_t>(value, 0));
+    }
+    size_t exponent = static_cast<size_t>(BITS_OF_INT64 - 1 - __builtin_clzll(static_cast<uint64_t>(value)));
+    if (exponent > MAX_EXPONENT) {
+        return BUCKET_NUM - 1;
+    }
+    size_t shift = exponent - SUB_BUCKET_BITS;
+    size_t subBucket = static_cast<size_t>(static_cast<uint64_t>(value) >> shift) & (SUB_BUCKET_NUM - 1);
+    return (exponent - SUB_BUCKET_BITS + 1) * SUB_BUCKET_NUM + subBucket;
+}
+
+int64_t LatencyHistogram::GetBucketUpperBound(size_t index)
+{
+    if (index < SUB_BUCKET_NUM) {
+        return static_cast<int64_t>(index);
+    }
+    index = std::min(index, BUCKET_NUM - 1);
+    size_t shift = index / SUB_BUCKET_NUM - 1;
+    uint64_t lower = static_cast<uint64_t>(SUB_BUCKET_NUM + index % SUB_BUCKET_NUM) << shift;
+    return static_cast<int64_t>(lower + (1ULL << shift) - 1);
+}
+
+void ErrorCodeCounter::Record(int32_t errCode)
+{
+    if (errCode == EMPTY_CODE) {
+        return;
+    }
+    for (size_t index = 0; index < SLOT_NUM; ++index) {
+        int32_t code = codes_[index].load(std::memory_order_acquire);
+        // On failure the exchange leaves the code claimed by another thread in code.
+        if ((code == EMPTY_CODE) &&
+            codes_[index].compare_exchange_strong(code, errCode, std::memory_order_acq_rel)) {
+            code = errCode;
+        }
+        if (code == errCode) {
+            counts_[index].fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    }
+    overflow_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void ErrorCodeCounter::Reset()
+{
+    for (size_t index = 0; index < SLOT_NUM; ++index) {
+        counts_[index].store(0, std::memory_order_relaxed);
+        codes_[index].store(EMPTY_CODE, std::memory_order_release);
+    }
+    overflow_.store(0, std::memory_order_relaxed);
+}
+
+uint64_t ErrorCodeCounter::GetOverflow() const
+{
+    return overflow_.load(std::memory_order_relaxed);
+}
+
+std::vector<std::pair<int32_t, uint64_t>> ErrorCodeCounter::GetCounts() const
+{
+    std::vector<std::pair<int32_t, uint64_t>> counts;
+    for (size_t index = 0; index < SLOT_NUM; ++index) {
+        int32_t code = codes_[index].load(std::memory_order_acquire);
+        uint64_t count = counts_[index].load(std::memory_order_relaxed);
+        if ((code != EMPTY_CODE) && (count > 0)) {
+            counts.emplace_back(code, count);
+        }
+    }
+    return counts;
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "napi_event_dispatcher.h"
+
+#include <algorithm>
+#include <iterator>
+
+#include "devicestatus_define.h"
+
+#undef LOG_TAG
+#define LOG_TAG "NapiEventDispatcher"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace {
+constexpr char BATCH_EVENT_NAME[] { "deviceStatus.batch" };
+// Only touched when a dispatcher is created or its env is torn down, never per event.
+std::mutex g_dispatchersMutex;
+std::map<napi_env, std::shared_ptr<NapiEventDispatcher>> g_dispatchers;
+} // namespace
+
+bool NapiEventCoalescer::Push(const std::string &module, int32_t type, Task task,
+    CoalescePolicy policy, size_t capacity)
+{
+    std::lock_guard guard(mutex_);
+    auto key = std::make_pair(module, type);
+    auto iter = index_.find(key);
+    if (iter == index_.end()) {
+        iter = index_.emplace(std::move(key), slots_.size()).first;
+        slots_.emplace_back();
+    }
+    auto &slot = slots_[iter->second];
+    if (policy == CoalescePolicy::LATEST_WINS) {
+        stats_.coalesced += slot.size();
+        slot.clear();
+    } else if (slot.size() >= std::max<size_t>(capacity, 1)) {
+        ++stats_.dropped;
+        slot.pop_front();
+    }
+    slot.push_back(std::move(task));
+    ++stats_.posted;
+    if (scheduled_) {
+        return false;
+    }
+    scheduled_ = true;
+    return true;
+}
+
+std::vector<NapiEventCoalescer::Task> NapiEventCoalescer::TakeBatch()
+{
+    std::vector<Task> batch;
+    std::lock_guard guard(mutex_);
+    for (auto &slot : slots_) {
+        std::move(slot.begin(), slot.end(), std::back_inserter(batch));
+    }
+    index_.clear();
+    slots_.clear();
+    scheduled_ = false;
+    if (!batch.empty()) {
+        ++stats_.batches;
+        stats_.delivered += batch.size();
+    }
+    return batch;
+}
+
+void NapiEventCoalescer::Discard()
+{
+    std::lock_guard guard(mutex_);
+    for (const auto &slot : slots_) {
+        stats_.dropped += slot.size();
+    }
+    index_.clear();
+    slots_.clear();
+    scheduled_ = false;
+}
+
+NapiEventStats NapiEventCoalescer::GetStats() const
+{
+    std::lock_guard guard(mutex_);
+    return stats_;
+}
+
+std::shared_ptr<NapiEventDispatcher> NapiEventDispatcher::GetInstance(napi_env env)
+{
+    CHKPP(env);
+    std::lock_guard guard(g_dispatchersMutex);
+    if (auto iter = g_dispatchers.find(env); iter != g_dispatchers.end()) {
+        return iter->second;
+    }
+    auto dispatcher = std::make_shared<NapiEventDispatcher>(env);
+    if (napi_add_env_cleanup_hook(env, &NapiEventDispatcher::OnEnvCleanup, env) != napi_ok) {
+        FI_HILOGE("Failed to add env cleanup hook");
+        return nullptr;
+    }
+    g_dispatchers.emplace(env, dispatcher);
+    return dispatcher;
+}
+
+NapiEventDispatcher::NapiEventDispatcher(napi_env env) : env_(env) {}
+
+bool NapiEventDispatcher::Post(const std::string &module, int32_t type, NapiEventCoalescer::Task task,
+    CoalescePolicy policy, size_t capacity)
+{
+    std::lock_guard guard(postMutex_);
+    if (closed_.load()) {
+        FI_HILOGW("Env of %{public}s has been torn down", module.c_str());
+        return false;
+    }
+    if (!coalescer_.Push(module, type, std::move(task), policy, capacity)) {
+        return true;
+    }
+    std::weak_ptr<NapiEventDispatcher> weakSelf = weak_from_this();
+    auto deliver = [weakSelf]() {
+        if (auto self = weakSelf.lock(); self != nullptr) {
+            self->Deliver();
+        }
+    };
+    if (napi_send_event(env_, deliver, napi_eprio_immediate, BATCH_EVENT_NAME) != napi_status::napi_ok) {
+        FI_HILOGE("Failed to SendEvent");
+        coalescer_.Discard();
+        return false;
+    }
+    return true;
+}
+
+NapiEventStats NapiEventDispatcher::GetStats() const
+{
+    return coalescer_.GetStats();
+}
+
+void NapiEventDispatcher::OnEnvCleanup(void *arg)
+{
+    std::shared_ptr<NapiEventDispatcher> dispatcher;
+    {
+        std::lock_guard guard(g_dispatchersMutex);
+        auto iter = g_dispatchers.find(static_cast<napi_env>(arg));
+        if (iter == g_dispatchers.end()) {
+            return;
+        }
+        dispatcher = iter->second;
+        g_dispatchers.erase(iter);
+    }
+    {
+        std::lock_guard guard(dispatcher->postMutex_);
+        dispatcher->closed_.store(true);
+        dispatcher->coalescer_.Discard();
+    }
+    NapiEventStats stats = dispatcher->coalescer_.GetStats();
+    FI_HILOGI("posted:%{public}" PRIu64 ", coalesced:%{public}" PRIu64 ", dropped:%{public}" PRIu64
+        ", batches:%{public}" PRIu64, stats.posted, stats.coalesced, stats.dropped, stats.batches);
+}
+
+void NapiEventDispatcher::Deliver()
+{
+    if (closed_.load()) {
+        return;
+    }
+    auto batch = coalescer_.TakeBatch();
+    FI_HILOGD("Deliver %{public}zu events", batch.size());
+    for (auto &task : batch) {
+        if (task) {
+            task();
+        }
+    }
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "rotate_policy.h"
+
+#include <regex>
+
+#ifndef OHOS_BUILD_ENABLE_ARKUI_X
+#include "parameters.h"
+#endif // OHOS_BUILD_ENABLE_ARKUI_X
+
+#include "devicestatus_define.h"
+#include "util.h"
+
+#undef LOG_TAG
+#define LOG_TAG "RotatePolicy"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace {
+constexpr int32_t ROTATE_POLICY_SCREEN_ROTATE { 1 };
+constexpr int32_t ROTATE_POLICY_FOLD_MODE { 2 };
+constexpr size_t INDEX_FOLDED { 0 };
+constexpr size_t INDEX_EXPAND { 1 };
+constexpr size_t POLICY_VEC_SIZE { 2 };
+const std::string SCREEN_ROTATION { "1" };
+const std::string SECONDARY_FOLD_DISPLAY { "6" };
+const std::string SECONDARY_FOLD_DISPLAY_TYPE_8 { "8" };
+
+size_t ToIndex(FoldPosture posture)
+{
+    return static_cast<size_t>(posture);
+}
+
+bool ParseSecondaryDevice(const std::string &foldScreenType)
+{
+    std::regex reg("^([0-9],){3}[0-9]{1}$");
+    if (!std::regex_match(foldScreenType, reg)) {
+        return false;
+    }
+    std::vector<std::string> foldTypes;
+    if (StringSplit(foldScreenType, ",", foldTypes) == 0) {
+        return false;
+    }
+    return (foldTypes[0] == SECONDARY_FOLD_DISPLAY) || (foldTypes[0] == SECONDARY_FOLD_DISPLAY_TYPE_8);
+}
+} // namespace
+
+const RotatePolicy& RotatePolicy::GetInstance()
+{
+#ifndef OHOS_BUILD_ENABLE_ARKUI_X
+    static const RotatePolicy instance(OHOS::system::GetIntParameter("const.window.device.rotate_policy", 0),
+        OHOS::system::GetParameter("const.window.foldabledevice.rotate_policy", "0,0"),
+        OHOS::system::GetParameter("const.window.foldscreen.type", "0,0,0,0"));
+#else
+    static const RotatePolicy instance(0, "", "");
+#endif // OHOS_BUILD_ENABLE_ARKUI_X
+    return instance;
+}
+
+RotatePolicy::RotatePolicy(int32_t rotatePolicy, const std::string &foldRotatePolicy,
+    const std::string &foldScreenType)
+{
+    isScreenRotation_ = (rotatePolicy == ROTATE_POLICY_SCREEN_ROTATE);
+    screenRotation_[false].fill(isScreenRotation_);
+    isSecondaryDevice_ = ParseSecondaryDevice(foldScreenType);
+    if (rotatePolicy != ROTATE_POLICY_FOLD_MODE) {
+        return;
+    }
+    std::vector<std::string> foldRotatePolicys;
+    StringSplit(foldRotatePolicy, ",", foldRotatePolicys);
+    if (foldRotatePolicys.size() < POLICY_VEC_SIZE) {
+        FI_HILOGE("Fold rotate policy is invalid");
+        return;
+    }
+    isFoldPolicyValid_ = true;
+    screenRotation_[true][ToIndex(FoldPosture::FOLDED)] = (foldRotatePolicys[INDEX_FOLDED] == SCREEN_ROTATION);
+    screenRotation_[true][ToIndex(FoldPosture::EXPANDED)] = (foldRotatePolicys[INDEX_EXPAND] == SCREEN_ROTATION);
+    FI_HILOGI("Fold rotate policy, folded:%{public}d, expanded:%{public}d, secondary:%{public}d",
+        screenRotation_[true][ToIndex(FoldPosture::FOLDED)], screenRotation_[true][ToIndex(FoldPosture::EXPANDED)],
+        isSecondaryDevice_);
+}
+
+bool RotatePolicy::IsScreenRotation() const
+{
+    return isScreenRotation_;
+}
+
+bool RotatePolicy::IsScreenRotation(bool isFoldable, FoldPosture posture) const
+{
+    if (posture >= FoldPosture::POSTURE_COUNT) {
+        return false;
+    }
+    return screenRotation_[isFoldable][ToIndex(posture)];
+}
+
+bool RotatePolicy::IsFoldPolicyValid() const
+{
+    return isFoldPolicyValid_;
+}
+
+bool RotatePolicy::IsSecondaryDevice() const
+{
+    return isSecondaryDevice_;
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
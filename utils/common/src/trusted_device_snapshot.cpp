@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "trusted_device_snapshot.h"
+
+#include "devicestatus_define.h"
+
+#undef LOG_TAG
+#define LOG_TAG "TrustedDeviceSnapshot"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+
+TrustedDeviceSnapshot& TrustedDeviceSnapshot::GetInstance()
+{
+    static TrustedDeviceSnapshot instance;
+    return instance;
+}
+
+void TrustedDeviceSnapshot::StartTracking()
+{
+    std::lock_guard guard(mutex_);
+    tracking_ = true;
+    synced_ = false;
+    ++generation_;
+}
+
+void TrustedDeviceSnapshot::StopTracking()
+{
+    std::lock_guard guard(mutex_);
+    tracking_ = false;
+    synced_ = false;
+    ++generation_;
+    networkIds_.clear();
+}
+
+uint64_t TrustedDeviceSnapshot::GetGeneration()
+{
+    std::lock_guard guard(mutex_);
+    return generation_;
+}
+
+void TrustedDeviceSnapshot::Sync(uint64_t generation, const std::vector<std::string> &networkIds)
+{
+    std::lock_guard guard(mutex_);
+    if (!tracking_ || (generation != generation_)) {
+        FI_HILOGD("Device state changed during query, drop synced list");
+        return;
+    }
+    networkIds_ = std::unordered_set<std::string>(networkIds.cbegin(), networkIds.cend());
+    synced_ = true;
+    syncTime_ = std::chrono::steady_clock::now();
+}
+
+void TrustedDeviceSnapshot::OnDeviceOnline(const std::string &networkId)
+{
+    std::lock_guard guard(mutex_);
+    ++generation_;
+    networkIds_.insert(networkId);
+}
+
+void TrustedDeviceSnapshot::OnDeviceOffline(const std::string &networkId)
+{
+    std::lock_guard guard(mutex_);
+    ++generation_;
+    networkIds_.erase(networkId);
+}
+
+bool TrustedDeviceSnapshot::Lookup(const std::string &networkId, bool &trusted)
+{
+    std::lock_guard guard(mutex_);
+    if (!tracking_ || !synced_) {
+        return false;
+    }
+    if ((maxStaleness_.count() > 0) && (std::chrono::steady_clock::now() - syncTime_ > maxStaleness_)) {
+        FI_HILOGD("Trusted device snapshot is stale");
+        return false;
+    }
+    trusted = (networkIds_.find(networkId) != networkIds_.cend());
+    return true;
+}
+
+void TrustedDeviceSnapshot::SetMaxStaleness(std::chrono::milliseconds maxStaleness)
+{
+    std::lock_guard guard(mutex_);
+    maxStaleness_ = maxStaleness;
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
@@ -15,7 +15,6 @@
 
 #include "include/util.h"
 
-#include <regex>
 #include <string>
 
 #ifndef OHOS_BUILD_ENABLE_ARKUI_X
@@ -25,9 +24,6 @@
 #include <sys/syscall.h>
 #include <unistd.h>
 
-#ifndef OHOS_BUILD_ENABLE_ARKUI_X
-#include "parameters.h"
-#endif // OHOS_BUILD_ENABLE_ARKUI_X
 #include "securec.h"
 
 #include "devicestatus_define.h"
@@ -49,16 +45,8 @@ constexpr uint32_t MS_NS { 1000000 };
 constexpr int32_t FILE_SIZE_MAX { 0x5000 };
 constexpr size_t SHORT_KEY_LENGTH { 20 };
 constexpr size_t PLAINTEXT_LENGTH { 4 };
-constexpr int32_t ROTATE_POLICY_WINDOW_ROTATE { 0 };
-constexpr int32_t ROTATE_POLICY_SCREEN_ROTATE { 1 };
-constexpr int32_t ROTATE_POLICY_FOLD_MODE { 2 };
 #ifndef OHOS_BUILD_ENABLE_ARKUI_X
 constexpr int32_t MAX_THREAD_NAME_LEN { 15 };
-const int32_t ROTATE_POLICY = OHOS::system::GetIntParameter("const.window.device.rotate_policy", 0);
-const std::string FOLD_ROTATE_POLICY = OHOS::system::GetParameter("const.window.foldabledevice.rotate_policy", "0,0");
-const std::string FOLD_SCREEN_TYPE = OHOS::system::GetParameter("const.window.foldscreen.type", "0,0,0,0");
-const std::string SECONDARY_FOLD_DISPLAY = "6";
-const std::string SECONDARY_FOLD_DISPLAY_TYPE_8 = "8";
 #endif // OHOS_BUILD_ENABLE_ARKUI_X
 const std::string SVG_PATH { "/system/etc/device_status/drag_icon/" };
 } // namespace
@@ -331,25 +319,6 @@ bool IsNum(const std::string &str)
     return (sin >> num) && sin.eof();
 }
 
-void GetRotatePolicy(bool &isScreenRotation, std::vector<std::string> &foldRotatePolicys)
-{
-#ifndef OHOS_BUILD_ENABLE_ARKUI_X
-    if (ROTATE_POLICY == ROTATE_POLICY_WINDOW_ROTATE) {
-        isScreenRotation = false;
-        return;
-    }
-    if (ROTATE_POLICY == ROTATE_POLICY_SCREEN_ROTATE) {
-        isScreenRotation = true;
-        return;
-    }
-    if (ROTATE_POLICY == ROTATE_POLICY_FOLD_MODE) {
-        isScreenRotation = false;
-        StringSplit(FOLD_ROTATE_POLICY, ",", foldRotatePolicys);
-        return;
-    }
-#endif // OHOS_BUILD_ENABLE_ARKUI_X
-}
-
 std::vector<std::string> StringSplit(const std::string& str, char delim)
 {
 #ifndef OHOS_BUILD_ENABLE_ARKUI_X
@@ -371,22 +340,6 @@ std::vector<std::string> StringSplit(const std::string& str, char delim)
     return {};
 }
 
-bool IsSecondaryDevice()
-{
-#ifndef OHOS_BUILD_ENABLE_ARKUI_X
-    std::regex reg("^([0-9],){3}[0-9]{1}$");
-    if (!std::regex_match(FOLD_SCREEN_TYPE, reg)) {
-        return false;
-    }
-    std::vector<std::string> foldTypes = StringSplit(FOLD_SCREEN_TYPE, ',');
-    if (foldTypes.empty()) {
-        return false;
-    }
-    return foldTypes[0] == SECONDARY_FOLD_DISPLAY || foldTypes[0] == SECONDARY_FOLD_DISPLAY_TYPE_8;
-#endif // OHOS_BUILD_ENABLE_ARKUI_X
-    return false;
-}
-
 bool IsValidJsonPath(const std::string &filePath)
 {
     return IsValidPath("/system/etc/multimodalinput/", filePath);